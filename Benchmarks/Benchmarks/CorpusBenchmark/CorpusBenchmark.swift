@@ -12,6 +12,7 @@
 // ===----------------------------------------------------------------------===//
 
 import Benchmark
+import BenchmarkCorpus
 import Foundation
 import FuzzyMatch
 import Synchronization
@@ -63,53 +64,37 @@ final class CorpusHolder: Sendable {
     private func ensureLoaded(_ state: inout State) {
         guard state.instruments == nil else { return }
 
-        // Load instruments
-        let instrumentsPath = "\(Self.resourcesDir)/instruments-export.tsv"
-        let instrumentsData: String
+        // Load instruments and queries. Either file may be TSV or an .fmbench table from
+        // Comparison/make-binary-corpus.py; the environment can point at other corpora.
+        let environment = ProcessInfo.processInfo.environment
+        let instrumentsPath = environment["FUZZYMATCH_BENCH_CORPUS"] ?? "\(Self.resourcesDir)/instruments-export.tsv"
+        let instrumentsTable: BenchmarkTable
         do {
-            instrumentsData = try String(contentsOfFile: instrumentsPath, encoding: .utf8)
+            instrumentsTable = try BenchmarkTable(contentsOf: instrumentsPath, kind: .instruments)
         } catch {
             fatalError("Failed to load instruments: \(error)")
         }
-        var instruments: [Instrument] = []
-        instruments.reserveCapacity(272_000)
-
-        for (index, line) in instrumentsData.split(separator: "\n", omittingEmptySubsequences: false).enumerated() {
-            if index == 0 { continue } // skip header
-            if line.isEmpty { continue }
-            let fields = line.split(separator: "\t", omittingEmptySubsequences: false)
-            guard fields.count >= 3 else { continue }
-            instruments.append(Instrument(
-                symbol: String(fields[0]),
-                name: String(fields[1]),
-                isin: String(fields[2])
-            ))
+        let instruments = (0..<instrumentsTable.rowCount).map { row in
+            Instrument(
+                symbol: instrumentsTable.columns[0][row],
+                name: instrumentsTable.columns[1][row],
+                isin: instrumentsTable.columns[2][row]
+            )
         }
         state.instruments = instruments
-        state.symbolCandidates = instruments.map(\.symbol)
-        state.nameCandidates = instruments.map(\.name)
-        state.isinCandidates = instruments.map(\.isin)
+        state.symbolCandidates = instrumentsTable.columns[0]
+        state.nameCandidates = instrumentsTable.columns[1]
+        state.isinCandidates = instrumentsTable.columns[2]
 
-        // Load queries
-        let queriesPath = "\(Self.resourcesDir)/queries.tsv"
-        let queriesData: String
+        let queriesPath = environment["FUZZYMATCH_BENCH_QUERIES"] ?? "\(Self.resourcesDir)/queries.tsv"
+        let queriesTable: BenchmarkTable
         do {
-            queriesData = try String(contentsOfFile: queriesPath, encoding: .utf8)
+            queriesTable = try BenchmarkTable(contentsOf: queriesPath, kind: .queries)
         } catch {
             fatalError("Failed to load queries: \(error)")
         }
-        var queries: [TestQuery] = []
-        queries.reserveCapacity(200)
-
-        for line in queriesData.split(separator: "\n", omittingEmptySubsequences: false) {
-            if line.isEmpty { continue }
-            let fields = line.split(separator: "\t", omittingEmptySubsequences: false)
-            guard fields.count >= 3 else { continue }
-            queries.append(TestQuery(
-                text: String(fields[0]),
-                field: String(fields[1]),
-                category: String(fields[2])
-            ))
+        let queries = (0..<queriesTable.rowCount).map { row in
+            TestQuery(text: queriesTable.columns[0][row], field: queriesTable.columns[1][row], category: queriesTable.columns[2][row])
         }
         state.queries = queries
         state.queriesByCategory = Dictionary(grouping: queries, by: \.category)
@@ -175,6 +160,43 @@ func runCycling(
     }
 }
 
+/// Prints the scoring statistics of each per-category benchmark once per process.
+///
+/// Only has anything to print when FuzzyMatch was built with the `ScoringStatistics`
+/// trait (`FUZZYMATCH_SCORING_STATISTICS=1 swift package benchmark`). Statistics
+/// collection and its timing samples add work to every candidate, so those runs are
+/// for tuning prefilters, not for comparing instruction counts.
+final class ScoringStatisticsReporter: Sendable {
+    static let shared = ScoringStatisticsReporter()
+
+    /// Time one candidate in this many.
+    static let timingSampleInterval = 64
+
+    private let reported = Mutex(Set<String>())
+
+    func report(_ name: String, _ statistics: ScoringStatistics) {
+        guard ScoringStatistics.isEnabled, reported.withLock({ $0.insert(name).inserted }) else { return }
+
+        var lines = ["", "Scoring statistics: \(name) (\(statistics.candidates) candidates, \(statistics.matches) matches)"]
+        lines.append("Stage".padding(toLength: 16, withPad: " ", startingAt: 0)
+            + pad("Entered", 12) + pad("Passed", 12) + pad("Pass %", 9) + pad("ns/timed", 10))
+        for stage in ScoringStatistics.Stage.allCases {
+            let counts = statistics[stage]
+            guard counts.entered > 0 else { continue }
+            lines.append(String(describing: stage).padding(toLength: 16, withPad: " ", startingAt: 0)
+                + pad("\(counts.entered)", 12)
+                + pad("\(counts.passed)", 12)
+                + pad(counts.passRate.map { String(format: "%.1f", $0 * 100) } ?? "-", 9)
+                + pad(counts.meanNanoseconds.map { String(format: "%.0f", $0) } ?? "-", 10))
+        }
+        print(lines.joined(separator: "\n"))
+    }
+
+    private func pad(_ text: String, _ width: Int) -> String {
+        String(repeating: " ", count: max(0, width - text.count)) + text
+    }
+}
+
 // MARK: - Benchmark Suite
 
 let benchmarks: @Sendable () -> Void = {
@@ -195,6 +217,7 @@ let benchmarks: @Sendable () -> Void = {
             let queries = holder.queries(forCategory: category)
             let matcher = FuzzyMatcher()
             var buffer = matcher.makeBuffer()
+            buffer.statistics.timingSampleInterval = ScoringStatisticsReporter.timingSampleInterval
 
             let prepared = queries.map { matcher.prepare($0.text) }
             let pools = queries.map { holder.candidates(for: $0.field) }
@@ -202,6 +225,7 @@ let benchmarks: @Sendable () -> Void = {
             runCycling(benchmark, pools: pools, queryCount: prepared.count) { candidate, qi in
                 matcher.score(candidate, against: prepared[qi], buffer: &buffer)
             }
+            ScoringStatisticsReporter.shared.report("ED - \(category)", buffer.statistics)
         }
     }
 
@@ -267,4 +291,324 @@ let benchmarks: @Sendable () -> Void = {
             matcher.score(candidate, against: prepared[qi], buffer: &buffer)
         }
     }
+
+    // MARK: - Batch Benchmarks
+
+    // Both run every query over its candidate pool sorted by UTF-8 length, so the
+    // only difference is per-candidate versus eight-lane batched Smith-Waterman.
+    Benchmark(
+        "SW - length-bucketed pool (per candidate)",
+        configuration: .init(
+            metrics: [.instructions, .mallocCountTotal, .objectAllocCount, .retainCount, .releaseCount],
+            warmupIterations: 1
+        )
+    ) { benchmark in
+        let queries = holder.allQueries
+        let matcher = FuzzyMatcher(config: .smithWaterman)
+        var buffer = matcher.makeBuffer()
+
+        let prepared = queries.map { matcher.prepare($0.text) }
+        let pools = queries.map { holder.candidates(for: $0.field).sorted { $0.utf8.count < $1.utf8.count } }
+
+        for _ in benchmark.scaledIterations {
+            for qi in prepared.indices {
+                for candidate in pools[qi] {
+                    blackHole(matcher.score(candidate, against: prepared[qi], buffer: &buffer))
+                }
+            }
+        }
+    }
+
+    Benchmark(
+        "SW - length-bucketed pool (scoreBatch)",
+        configuration: .init(
+            metrics: [.instructions, .mallocCountTotal, .objectAllocCount, .retainCount, .releaseCount],
+            warmupIterations: 1
+        )
+    ) { benchmark in
+        let queries = holder.allQueries
+        let matcher = FuzzyMatcher(config: .smithWaterman)
+        var buffer = matcher.makeBuffer()
+
+        let prepared = queries.map { matcher.prepare($0.text) }
+        let pools = queries.map { holder.candidates(for: $0.field).sorted { $0.utf8.count < $1.utf8.count } }
+
+        for _ in benchmark.scaledIterations {
+            for qi in prepared.indices {
+                blackHole(matcher.scoreBatch(pools[qi].span, against: prepared[qi], buffer: &buffer))
+            }
+        }
+    }
+
+    // MARK: - Type-Ahead Benchmarks
+
+    // Each iteration types every query one character at a time and takes the top 10
+    // after each keystroke, either re-searching the corpus or refining a session.
+    for (prefix, config) in [("ED", MatchConfig.editDistance), ("SW", MatchConfig.smithWaterman)] {
+        Benchmark(
+            "\(prefix) - type-ahead (full search per keystroke)",
+            configuration: .init(
+                metrics: [.instructions, .mallocCountTotal, .objectAllocCount, .retainCount, .releaseCount],
+                warmupIterations: 1
+            )
+        ) { benchmark in
+            let queries = holder.allQueries
+            let matcher = FuzzyMatcher(config: config)
+            let corpora = queries.map { FuzzyCorpus(holder.candidates(for: $0.field)) }
+
+            for _ in benchmark.scaledIterations {
+                for qi in queries.indices {
+                    let text = queries[qi].text
+                    for length in 1...max(1, text.count) {
+                        let typed = matcher.prepare(String(text.prefix(length)))
+                        blackHole(matcher.topMatches(corpora[qi], against: typed, limit: 10))
+                    }
+                }
+            }
+        }
+
+        Benchmark(
+            "\(prefix) - type-ahead (FuzzySearchSession)",
+            configuration: .init(
+                metrics: [.instructions, .mallocCountTotal, .objectAllocCount, .retainCount, .releaseCount],
+                warmupIterations: 1
+            )
+        ) { benchmark in
+            let queries = holder.allQueries
+            let matcher = FuzzyMatcher(config: config)
+            let corpora = queries.map { FuzzyCorpus(holder.candidates(for: $0.field)) }
+
+            for _ in benchmark.scaledIterations {
+                for qi in queries.indices {
+                    let text = queries[qi].text
+                    var session = FuzzySearchSession(corpus: corpora[qi], matcher: matcher)
+                    for length in 1...max(1, text.count) {
+                        session.update(String(text.prefix(length)))
+                        blackHole(session.topMatches(limit: 10))
+                    }
+                }
+            }
+        }
+    }
+
+    // MARK: - Corpus Result Benchmarks
+
+    // Same searches over prebuilt corpora; one decodes a String per retained match,
+    // the other returns corpus indices.
+    Benchmark(
+        "ED - corpus topMatches limit 100",
+        configuration: .init(
+            metrics: [.instructions, .mallocCountTotal, .objectAllocCount, .retainCount, .releaseCount],
+            warmupIterations: 1
+        )
+    ) { benchmark in
+        let queries = holder.allQueries
+        let matcher = FuzzyMatcher()
+
+        let prepared = queries.map { matcher.prepare($0.text) }
+        let corpora = queries.map { FuzzyCorpus(holder.candidates(for: $0.field)) }
+
+        for _ in benchmark.scaledIterations {
+            for qi in prepared.indices {
+                blackHole(matcher.topMatches(corpora[qi], against: prepared[qi], limit: 100))
+            }
+        }
+    }
+
+    Benchmark(
+        "ED - corpus topMatchIndices limit 100",
+        configuration: .init(
+            metrics: [.instructions, .mallocCountTotal, .objectAllocCount, .retainCount, .releaseCount],
+            warmupIterations: 1
+        )
+    ) { benchmark in
+        let queries = holder.allQueries
+        let matcher = FuzzyMatcher()
+
+        let prepared = queries.map { matcher.prepare($0.text) }
+        let corpora = queries.map { FuzzyCorpus(holder.candidates(for: $0.field)) }
+
+        for _ in benchmark.scaledIterations {
+            for qi in prepared.indices {
+                blackHole(matcher.topMatchIndices(corpora[qi], against: prepared[qi], limit: 100))
+            }
+        }
+    }
+
+    // Every query of a field against that field's corpus, one query after another
+    // or as one multi-query pass that walks the corpus in cache-sized tiles.
+    Benchmark(
+        "ED - per-query corpus topMatches limit 10",
+        configuration: .init(
+            metrics: [.instructions, .mallocCountTotal, .objectAllocCount, .retainCount, .releaseCount],
+            warmupIterations: 1
+        )
+    ) { benchmark in
+        let matcher = FuzzyMatcher()
+        let fields = ["symbol", "name", "isin"]
+        let corpora = fields.map { FuzzyCorpus(holder.candidates(for: $0)) }
+        let prepared = fields.map { field in
+            holder.allQueries.filter { $0.field == field }.map { matcher.prepare($0.text) }
+        }
+
+        for _ in benchmark.scaledIterations {
+            for fi in fields.indices {
+                for query in prepared[fi] {
+                    blackHole(matcher.topMatches(corpora[fi], against: query, limit: 10))
+                }
+            }
+        }
+    }
+
+    Benchmark(
+        "ED - multi-query corpus topMatches limit 10",
+        configuration: .init(
+            metrics: [.instructions, .mallocCountTotal, .objectAllocCount, .retainCount, .releaseCount],
+            warmupIterations: 1
+        )
+    ) { benchmark in
+        let matcher = FuzzyMatcher()
+        let fields = ["symbol", "name", "isin"]
+        let corpora = fields.map { FuzzyCorpus(holder.candidates(for: $0)) }
+        let prepared = fields.map { field in
+            holder.allQueries.filter { $0.field == field }.map { matcher.prepare($0.text) }
+        }
+
+        for _ in benchmark.scaledIterations {
+            for fi in fields.indices {
+                blackHole(matcher.topMatches(corpora[fi], against: prepared[fi], limit: 10))
+            }
+        }
+    }
+
+    // MARK: - Multi-Field Benchmarks
+
+    // Every query searches symbol, name and ISIN together for the top 10 records:
+    // either one corpus per field with the per-field results merged afterwards
+    // (without de-duplicating records), or one multi-field pass.
+    Benchmark(
+        "ED - all fields (per-field corpora)",
+        configuration: .init(
+            metrics: [.instructions, .mallocCountTotal, .objectAllocCount, .retainCount, .releaseCount],
+            warmupIterations: 1
+        )
+    ) { benchmark in
+        let queries = holder.allQueries
+        let matcher = FuzzyMatcher()
+
+        let prepared = queries.map { matcher.prepare($0.text) }
+        let corpora = ["symbol", "name", "isin"].map { FuzzyCorpus(holder.candidates(for: $0)) }
+
+        for _ in benchmark.scaledIterations {
+            for query in prepared {
+                var top = TopKCollector<Int>(limit: 10)
+                for corpus in corpora {
+                    for result in matcher.topMatchIndices(corpus, against: query, limit: 10) {
+                        top.insert(result.item, score: result.match.score, ordinal: result.item)
+                    }
+                }
+                blackHole(top.sortedElements())
+            }
+        }
+    }
+
+    Benchmark(
+        "ED - all fields (MultiFieldCorpus)",
+        configuration: .init(
+            metrics: [.instructions, .mallocCountTotal, .objectAllocCount, .retainCount, .releaseCount],
+            warmupIterations: 1
+        )
+    ) { benchmark in
+        let queries = holder.allQueries
+        let matcher = FuzzyMatcher()
+
+        let prepared = queries.map { matcher.prepare($0.text) }
+        let corpus = MultiFieldCorpus(columns: ["symbol", "name", "isin"].map { holder.candidates(for: $0) })
+
+        for _ in benchmark.scaledIterations {
+            for query in prepared {
+                blackHole(matcher.topMatches(corpus, against: query, limit: 10))
+            }
+        }
+    }
+
+    // MARK: - Corpus Startup Benchmarks
+
+    // Both produce the same name-field corpus with a trigram index: one builds it
+    // from strings, the other loads a snapshot that was encoded once up front.
+    Benchmark(
+        "Corpus - build name field",
+        configuration: .init(
+            metrics: [.instructions, .mallocCountTotal, .objectAllocCount, .retainCount, .releaseCount],
+            warmupIterations: 1
+        )
+    ) { benchmark in
+        let candidates = holder.candidates(for: "name")
+
+        for _ in benchmark.scaledIterations {
+            blackHole(FuzzyCorpus(candidates, buildTrigramIndex: true))
+        }
+    }
+
+    Benchmark(
+        "Corpus - load name field snapshot",
+        configuration: .init(
+            metrics: [.instructions, .mallocCountTotal, .objectAllocCount, .retainCount, .releaseCount],
+            warmupIterations: 1
+        )
+    ) { benchmark in
+        let snapshot = FuzzyCorpus(holder.candidates(for: "name"), buildTrigramIndex: true).snapshot()
+
+        for _ in benchmark.scaledIterations {
+            do {
+                blackHole(try FuzzyCorpus(snapshot: snapshot))
+            } catch {
+                fatalError("Failed to load snapshot: \(error)")
+            }
+        }
+    }
+
+    // MARK: - Top-K Benchmarks
+
+    Benchmark(
+        "ED - topMatches limit 10",
+        configuration: .init(
+            metrics: [.instructions, .mallocCountTotal, .objectAllocCount, .retainCount, .releaseCount],
+            warmupIterations: 1
+        )
+    ) { benchmark in
+        let queries = holder.allQueries
+        let matcher = FuzzyMatcher()
+
+        let prepared = queries.map { matcher.prepare($0.text) }
+        let pools = queries.map { holder.candidates(for: $0.field) }
+
+        // Once the top 10 fills up, candidates that cannot beat it skip alignment
+        for _ in benchmark.scaledIterations {
+            for qi in prepared.indices {
+                blackHole(matcher.topMatches(pools[qi], against: prepared[qi], limit: 10))
+            }
+        }
+    }
+
+    Benchmark(
+        "ED - topMatches limit 100",
+        configuration: .init(
+            metrics: [.instructions, .mallocCountTotal, .objectAllocCount, .retainCount, .releaseCount],
+            warmupIterations: 1
+        )
+    ) { benchmark in
+        let queries = holder.allQueries
+        let matcher = FuzzyMatcher()
+
+        let prepared = queries.map { matcher.prepare($0.text) }
+        let pools = queries.map { holder.candidates(for: $0.field) }
+
+        // One iteration runs every query over its full candidate pool
+        for _ in benchmark.scaledIterations {
+            for qi in prepared.indices {
+                blackHole(matcher.topMatches(pools[qi], against: prepared[qi], limit: 100))
+            }
+        }
+    }
 }
@@ -396,6 +396,41 @@ let benchmarks: @Sendable () -> Void = {
         }
     }
 
+    // Long queries whose characters are common in the dataset: most candidates pass
+    // the bitmask and length prefilters, so the trigram membership probe dominates.
+    // Compare against a baseline to see the effect of trigram lookup changes.
+    Benchmark(
+        "Trigram prefilter - 16 char query",
+        configuration: configKilo
+    ) { benchmark in
+        let smallDataset = DatasetHolder.shared.smallDataset
+        let matcher = FuzzyMatcher()
+        let query = matcher.prepare("updateStatusList")
+        var buffer = matcher.makeBuffer()
+
+        for _ in benchmark.scaledIterations {
+            for candidate in smallDataset {
+                blackHole(matcher.score(candidate, against: query, buffer: &buffer))
+            }
+        }
+    }
+
+    Benchmark(
+        "Trigram prefilter - 24 char query",
+        configuration: configKilo
+    ) { benchmark in
+        let smallDataset = DatasetHolder.shared.smallDataset
+        let matcher = FuzzyMatcher()
+        let query = matcher.prepare("validateResponseMessages")
+        var buffer = matcher.makeBuffer()
+
+        for _ in benchmark.scaledIterations {
+            for candidate in smallDataset {
+                blackHole(matcher.score(candidate, against: query, buffer: &buffer))
+            }
+        }
+    }
+
     // MARK: - Full Scoring Benchmarks (Single-threaded)
 
     Benchmark(
@@ -484,6 +519,56 @@ let benchmarks: @Sendable () -> Void = {
         }
     }
 
+    // MARK: - Allocation-Free Scoring
+
+    // A fixed-capacity buffer is allocated before measurement starts, so every
+    // malloc counted here comes from scoring itself. The baseline is zero, and the
+    // absolute threshold fails `benchmark thresholds check` on any allocation.
+    let zeroAllocationThreshold: BenchmarkThresholds = .init(absolute: [.p0: 0, .p50: 0, .p100: 0])
+    var zeroAllocationThresholds = defaultThresholds
+    zeroAllocationThresholds[.mallocCountTotal] = zeroAllocationThreshold
+    let configKiloZeroAllocation = Benchmark.Configuration(
+        metrics: metrics, warmupIterations: 1, scalingFactor: .kilo, thresholds: zeroAllocationThresholds
+    )
+
+    Benchmark(
+        "Fixed-capacity buffer - edit distance, no allocations",
+        configuration: configKiloZeroAllocation
+    ) { benchmark in
+        let smallDataset = DatasetHolder.shared.smallDataset
+        let matcher = FuzzyMatcher()
+        let queries = (realisticQueries5Char + realisticQueries10Char).map { matcher.prepare($0) }
+        var buffer = matcher.makeBuffer(maxQueryLength: 64, maxCandidateLength: 256)
+
+        benchmark.startMeasurement()
+        for _ in benchmark.scaledIterations {
+            for query in queries {
+                for candidate in smallDataset {
+                    blackHole(matcher.score(candidate, against: query, buffer: &buffer))
+                }
+            }
+        }
+    }
+
+    Benchmark(
+        "Fixed-capacity buffer - Smith-Waterman, no allocations",
+        configuration: configKiloZeroAllocation
+    ) { benchmark in
+        let smallDataset = DatasetHolder.shared.smallDataset
+        let matcher = FuzzyMatcher(config: .smithWaterman)
+        let queries = (realisticQueries5Char + realisticQueries10Char).map { matcher.prepare($0) }
+        var buffer = matcher.makeBuffer(maxQueryLength: 64, maxCandidateLength: 256)
+
+        benchmark.startMeasurement()
+        for _ in benchmark.scaledIterations {
+            for query in queries {
+                for candidate in smallDataset {
+                    blackHole(matcher.score(candidate, against: query, buffer: &buffer))
+                }
+            }
+        }
+    }
+
     // MARK: - Concurrent Benchmarks
 
     Benchmark(
@@ -10,7 +10,13 @@ let package = Package(
         .visionOS(.v26)
     ],
     dependencies: [
-        .package(path: ".."),
+        // FUZZYMATCH_SCORING_STATISTICS=1 builds FuzzyMatch with per-stage statistics,
+        // which CorpusBenchmark then prints per query category
+        .package(
+            path: "..",
+            traits: Context.environment["FUZZYMATCH_SCORING_STATISTICS"] != nil ? ["ScoringStatistics"] : []
+        ),
+        .package(path: "../Comparison/BenchmarkCorpus"),
         .package(url: "https://github.com/ordo-one/package-benchmark.git", from: "1.0.0")
     ],
     targets: [
@@ -28,6 +34,7 @@ let package = Package(
         .executableTarget(
             name: "CorpusBenchmark",
             dependencies: [
+                .product(name: "BenchmarkCorpus", package: "BenchmarkCorpus"),
                 .product(name: "FuzzyMatch", package: "FuzzyMatch"),
                 .product(name: "Benchmark", package: "package-benchmark")
             ],
@@ -0,0 +1,15 @@
+// swift-tools-version: 5.9
+import PackageDescription
+
+// Corpus and query-set loading shared by the Swift harnesses and Benchmarks/CorpusBenchmark.
+// Tools version 5.9 so the Ifrit harnesses can depend on it too.
+let package = Package(
+    name: "BenchmarkCorpus",
+    platforms: [.macOS(.v14)],
+    products: [
+        .library(name: "BenchmarkCorpus", targets: ["BenchmarkCorpus"]),
+    ],
+    targets: [
+        .target(name: "BenchmarkCorpus"),
+    ]
+)
@@ -0,0 +1,126 @@
+import Foundation
+
+/// The three string columns of a benchmark corpus or query set.
+///
+/// A file is either TSV or the `.fmbench` binary table written by
+/// `Comparison/make-binary-corpus.py` (which documents the layout), told apart by
+/// its first bytes. The binary form is mapped rather than read, and builds each
+/// column's strings straight from its offset table without scanning for
+/// separators.
+public struct BenchmarkTable: Sendable {
+    public enum Kind: UInt32, Sendable {
+        /// symbol, name, isin; the TSV has a header line.
+        case instruments = 1
+        /// text, field, category; the TSV has no header line.
+        case queries = 2
+    }
+
+    public enum LoadError: Error, Equatable {
+        case malformed
+        case unsupportedVersion(UInt32)
+        case wrongKind(UInt32)
+    }
+
+    public static let magic = Array("FMBENCH\0".utf8)
+    public static let version: UInt32 = 1
+    static let headerBytes = 32
+    static let columnCount = 3
+
+    /// The columns in file order; all three have `rowCount` rows.
+    public let columns: [[String]]
+
+    /// Size of the file the table was loaded from.
+    public let byteCount: Int
+
+    public var rowCount: Int { columns[0].count }
+
+    /// Loads the table at `path`.
+    ///
+    /// A TSV row is a line with at least three tab-separated fields, of which the
+    /// first three are used.
+    public init(contentsOf path: String, kind: Kind) throws {
+        let data = try Data(contentsOf: URL(fileURLWithPath: path), options: .alwaysMapped)
+        byteCount = data.count
+        columns = try data.withUnsafeBytes { raw in
+            if raw.starts(with: Self.magic) {
+                return try Self.readTable(raw, kind: kind)
+            }
+            return Self.readTSV(raw, skipHeader: kind == .instruments)
+        }
+    }
+
+    static func readTSV(_ raw: UnsafeRawBufferPointer, skipHeader: Bool) -> [[String]] {
+        var columns = [[String]](repeating: [], count: columnCount)
+        let newline = UInt8(ascii: "\n")
+        let tab = UInt8(ascii: "\t")
+        var lineStart = 0
+        var isHeader = skipHeader
+        while lineStart < raw.count {
+            var lineEnd = lineStart
+            while lineEnd < raw.count && raw[lineEnd] != newline {
+                lineEnd += 1
+            }
+            defer { lineStart = lineEnd + 1 }
+            if isHeader {
+                isHeader = false
+                continue
+            }
+
+            var fields: [Range<Int>] = []
+            var fieldStart = lineStart
+            for i in lineStart...lineEnd where i == lineEnd || raw[i] == tab {
+                fields.append(fieldStart..<i)
+                fieldStart = i + 1
+                if fields.count == columnCount { break }
+            }
+            guard fields.count == columnCount else { continue }
+            for (column, range) in fields.enumerated() {
+                columns[column].append(String(decoding: UnsafeRawBufferPointer(rebasing: raw[range]), as: UTF8.self))
+            }
+        }
+        return columns
+    }
+
+    static func readTable(_ raw: UnsafeRawBufferPointer, kind: Kind) throws -> [[String]] {
+        func u32(_ at: Int) -> UInt32 { UInt32(littleEndian: raw.loadUnaligned(fromByteOffset: at, as: UInt32.self)) }
+        func u64(_ at: Int) -> UInt64 { UInt64(littleEndian: raw.loadUnaligned(fromByteOffset: at, as: UInt64.self)) }
+
+        guard raw.count >= headerBytes else { throw LoadError.malformed }
+        guard u32(8) == version else { throw LoadError.unsupportedVersion(u32(8)) }
+        guard u32(12) == kind.rawValue else { throw LoadError.wrongKind(u32(12)) }
+        guard u32(24) == UInt32(columnCount) else { throw LoadError.malformed }
+        // Every row takes 8 bytes of each offset table, so a larger count cannot fit
+        guard u64(16) < UInt64(raw.count) else { throw LoadError.malformed }
+        let rows = Int(u64(16))
+
+        var columns: [[String]] = []
+        var pos = headerBytes
+        for _ in 0..<columnCount {
+            guard raw.count - pos >= 8 else { throw LoadError.malformed }
+            let byteCount = u64(pos)
+            pos += 8
+            let offsets = pos
+            guard (raw.count - pos) / 8 > rows else { throw LoadError.malformed }
+            pos += (rows + 1) * 8
+            guard byteCount <= UInt64(raw.count - pos) else { throw LoadError.malformed }
+            let text = pos
+            pos += (Int(byteCount) + 7) & ~7
+            guard pos <= raw.count else { throw LoadError.malformed }
+
+            var column: [String] = []
+            column.reserveCapacity(rows)
+            var start = u64(offsets)
+            guard start == 0 else { throw LoadError.malformed }
+            for row in 0..<rows {
+                let end = u64(offsets + (row + 1) * 8)
+                guard end >= start, end <= byteCount else { throw LoadError.malformed }
+                let bytes = UnsafeRawBufferPointer(rebasing: raw[(text + Int(start))..<(text + Int(end))])
+                column.append(String(decoding: bytes, as: UTF8.self))
+                start = end
+            }
+            guard start == byteCount else { throw LoadError.malformed }
+            columns.append(column)
+        }
+        return columns
+    }
+}
@@ -5,12 +5,14 @@ let package = Package(
     name: "bench-contains",
     platforms: [.macOS(.v26)],
     dependencies: [
+        .package(path: "../BenchmarkCorpus"),
         .package(url: "https://github.com/apple/swift-collections.git", from: "1.1.0"),
     ],
     targets: [
         .executableTarget(
             name: "bench-contains",
             dependencies: [
+                .product(name: "BenchmarkCorpus", package: "BenchmarkCorpus"),
                 .product(name: "HeapModule", package: "swift-collections"),
             ],
             path: "Sources"
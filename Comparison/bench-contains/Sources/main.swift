@@ -1,3 +1,4 @@
+import BenchmarkCorpus
 import Foundation
 import HeapModule
 
@@ -204,31 +205,19 @@ struct App {
     // MARK: - Data Loading
 
     static func loadQueries(from path: String) -> [Query] {
-        let data = try! Data(contentsOf: URL(fileURLWithPath: path))
-        let content = String(decoding: data, as: UTF8.self)
-        return content.split(separator: "\n", omittingEmptySubsequences: true).compactMap { line in
-            let cols = line.split(separator: "\t", omittingEmptySubsequences: false)
-            guard cols.count >= 3 else { return nil }
-            return Query(text: String(cols[0]), field: String(cols[1]), category: String(cols[2]))
+        let table = try! BenchmarkTable(contentsOf: path, kind: .queries)
+        return (0..<table.rowCount).map { row in
+            Query(text: table.columns[0][row], field: table.columns[1][row], category: table.columns[2][row])
         }
     }
 
     static func loadCorpus(from path: String) -> [Instrument] {
         print("Loading corpus from \(path)...", terminator: "")
         fflush(stdout)
-        let data = try! Data(contentsOf: URL(fileURLWithPath: path))
-        let content = String(decoding: data, as: UTF8.self)
-        print(" done (\(data.count) bytes)")
-        let lines = content.split(separator: "\n", omittingEmptySubsequences: false)
-
-        var instruments: [Instrument] = []
-        instruments.reserveCapacity(272_000)
-        for (i, line) in lines.enumerated() {
-            if i == 0 { continue }
-            let cols = line.split(separator: "\t", omittingEmptySubsequences: false)
-            if cols.count >= 3 {
-                instruments.append(Instrument(symbol: String(cols[0]), name: String(cols[1]), isin: String(cols[2])))
-            }
+        let table = try! BenchmarkTable(contentsOf: path, kind: .instruments)
+        print(" done (\(table.byteCount) bytes)")
+        let instruments = (0..<table.rowCount).map { row in
+            Instrument(symbol: table.columns[0][row], name: table.columns[1][row], isin: table.columns[2][row])
         }
         print("Loaded \(instruments.count) instruments")
         return instruments
@@ -6,14 +6,14 @@ let package = Package(
     platforms: [.macOS(.v26)],
     dependencies: [
         .package(path: "../.."),
-        .package(url: "https://github.com/apple/swift-collections.git", from: "1.1.0"),
+        .package(path: "../BenchmarkCorpus"),
     ],
     targets: [
         .executableTarget(
             name: "bench-fuzzymatch",
             dependencies: [
+                .product(name: "BenchmarkCorpus", package: "BenchmarkCorpus"),
                 .product(name: "FuzzyMatch", package: "FuzzyMatch"),
-                .product(name: "HeapModule", package: "swift-collections"),
             ],
             path: "Sources"
         ),
@@ -1,6 +1,6 @@
+import BenchmarkCorpus
 import FuzzyMatch
 import Foundation
-import HeapModule
 
 // MARK: - Data Structures
 
@@ -16,12 +16,51 @@ struct Query {
     let category: String
 }
 
-struct ScoredResult: Comparable {
+struct ScoredResult {
     let score: Double
     let index: Int
+}
+
+/// Time spent in each stage of answering queries, in nanoseconds. With `--threads N`
+/// the score stage is summed over the workers, so it is CPU time.
+struct StageTimes {
+    /// `FuzzyMatcher.prepare` on the query text.
+    var prepareNs: UInt64 = 0
+    /// Scoring every candidate into the top-K collector.
+    var scoreNs: UInt64 = 0
+    /// Merging the workers' counts and top-K results (`--threads N` only).
+    var mergeNs: UInt64 = 0
+}
 
-    static func < (lhs: ScoredResult, rhs: ScoredResult) -> Bool {
-        lhs.score < rhs.score
+/// One worker's contiguous slice of the candidate columns for `--threads N`, with
+/// its own scoring buffer and the results of the query it scored last.
+///
+/// Only worker `w` of a `concurrentPerform` pass touches `workers[w]`.
+final class ShardWorker: @unchecked Sendable {
+    let start: Int
+    let symbols: [String]
+    let names: [String]
+    let isins: [String]
+    var buffer: ScoringBuffer
+    var matchCount = 0
+    var top: [ScoredResult] = []
+    var busyNs: UInt64 = 0
+    var lastQueryNs: UInt64 = 0
+
+    init(start: Int, symbols: [String], names: [String], isins: [String], buffer: ScoringBuffer) {
+        self.start = start
+        self.symbols = symbols
+        self.names = names
+        self.isins = isins
+        self.buffer = buffer
+    }
+
+    func candidates(for field: String) -> [String] {
+        switch field {
+        case "symbol": symbols
+        case "isin": isins
+        default: names
+        }
     }
 }
 
@@ -39,6 +78,7 @@ struct App {
     static func main() {
         let config = parseArgs()
         let queries = loadQueries(from: config.queriesPath)
+        let loadStart = now()
         let instruments = loadCorpus(from: config.tsvPath)
 
         let matchConfig: MatchConfig = config.useSmithWaterman ? .smithWaterman : MatchConfig()
@@ -48,6 +88,8 @@ struct App {
         let symbolCandidates = instruments.map(\.symbol)
         let nameCandidates = instruments.map(\.name)
         let isinCandidates = instruments.map(\.isin)
+        let loadMs = msFrom(loadStart, to: now())
+        print("Load time: \(fmtD(loadMs, 1))ms, peak RSS after load: \(fmtD(Double(peakRSSBytes()) / 1_000_000.0, 1))MB")
 
         func candidates(for field: String) -> [String] {
             switch field {
@@ -60,6 +102,23 @@ struct App {
         print("Running \(queries.count) queries")
         print("")
 
+        // With --threads N, every query is scored by N workers, each over its own shard
+        let workers: [ShardWorker] = config.threads > 1 ? (0..<config.threads).map { w in
+            let start = instruments.count * w / config.threads
+            let end = instruments.count * (w + 1) / config.threads
+            return ShardWorker(
+                start: start,
+                symbols: Array(symbolCandidates[start..<end]),
+                names: Array(nameCandidates[start..<end]),
+                isins: Array(isinCandidates[start..<end]),
+                buffer: matcher.makeBuffer()
+            )
+        } : []
+        if !workers.isEmpty {
+            print("Threads: \(workers.count)")
+            print("")
+        }
+
         // Warmup
         do {
             var buffer = matcher.makeBuffer()
@@ -73,10 +132,23 @@ struct App {
             print("Warmup complete")
         }
 
+        // Single-threaded reference pass, the baseline for speedup and parallel efficiency
+        var referenceMs = 0.0
+        if !workers.isEmpty {
+            var buffer = matcher.makeBuffer()
+            let refStart = now()
+            for q in queries {
+                _ = scoreQuery(matcher: matcher, prepared: matcher.prepare(q.text), buffer: &buffer, candidates: candidates(for: q.field))
+            }
+            referenceMs = msFrom(refStart, to: now())
+            print("Single-thread reference: \(String(format: "%.1f", referenceMs))ms")
+        }
+
         // Timed iterations
         var queryTimingsMs: [[Double]] = Array(repeating: [], count: queries.count)
         var queryMatchCounts: [Int] = Array(repeating: 0, count: queries.count)
         var iterationTotalsMs: [Double] = []
+        var stages = StageTimes()
 
         print("")
         print("=== Benchmark: FuzzyMatch (\(modeName)) scoring \(queries.count) queries x \(instruments.count) candidates ===")
@@ -88,10 +160,17 @@ struct App {
 
             for (qi, q) in queries.enumerated() {
                 let pool = candidates(for: q.field)
+                let prepareStart = now()
                 let prepared = matcher.prepare(q.text)
                 let qStart = now()
-                let (matchCount, _) = scoreQuery(matcher: matcher, prepared: prepared, buffer: &buffer, candidates: pool)
+                stages.prepareNs += qStart - prepareStart
+                let (matchCount, _) = workers.isEmpty
+                    ? scoreQuery(matcher: matcher, prepared: prepared, buffer: &buffer, candidates: pool)
+                    : scoreQuerySharded(matcher: matcher, prepared: prepared, field: q.field, workers: workers, stages: &stages)
                 let qEnd = now()
+                if workers.isEmpty {
+                    stages.scoreNs += qEnd - qStart
+                }
                 queryTimingsMs[qi].append(msFrom(qStart, to: qEnd))
                 if iter == 0 {
                     queryMatchCounts[qi] = matchCount
@@ -111,6 +190,67 @@ struct App {
             iterations: config.iterations,
             candidateCount: instruments.count
         )
+
+        let categoryLatencies = printLatencyDistribution(
+            queries: queries,
+            queryTimingsMs: queryTimingsMs,
+            iterations: config.iterations,
+            candidateCount: instruments.count
+        )
+        let totalCandidates = Double(instruments.count) * Double(queries.count * config.iterations)
+        printStages(stages, threaded: !workers.isEmpty, totalCandidates: totalCandidates)
+
+        var scaling: [String: Any]?
+        if !workers.isEmpty {
+            scaling = printThreadSummary(
+                workers: workers,
+                referenceMs: referenceMs,
+                iterationTotalsMs: iterationTotalsMs,
+                scoredPerShardCandidate: queries.count * config.iterations
+            )
+        }
+
+        if let jsonPath = config.jsonPath {
+            let sortedTotals = iterationTotalsMs.sorted()
+            let medianTotal = sortedTotals[config.iterations / 2]
+            var stageResults: [String: Any] = [
+                "prepare": stageJSON(stages.prepareNs, totalCandidates: totalCandidates),
+                "score": stageJSON(stages.scoreNs, totalCandidates: totalCandidates),
+            ]
+            if !workers.isEmpty {
+                stageResults["merge"] = stageJSON(stages.mergeNs, totalCandidates: totalCandidates)
+            }
+            var categories: [String: Any] = [:]
+            for (category, samples) in categoryLatencies {
+                let indices = queries.indices.filter { queries[$0].category == category }
+                categories[category] = [
+                    "queries": indices.count,
+                    "matches": indices.map { queryMatchCounts[$0] }.reduce(0, +),
+                    "candidates_per_sec": candidatesPerSecond(samples, candidateCount: instruments.count),
+                    "latency_ms": latencyJSON(samples),
+                ] as [String: Any]
+            }
+            var results: [String: Any] = [
+                "schema": 1,
+                "harness": "fuzzymatch",
+                "variant": config.useSmithWaterman ? "smith_waterman" : "edit_distance",
+                "candidates": instruments.count,
+                "queries": queries.count,
+                "iterations": config.iterations,
+                "threads": config.threads,
+                "load_ms": loadMs,
+                "peak_rss_bytes": peakRSSBytes(),
+                "total_ms": ["min": sortedTotals.first!, "median": medianTotal, "max": sortedTotals.last!],
+                "candidates_per_sec": Double(instruments.count) * Double(queries.count) / (medianTotal / 1000.0),
+                "latency_ms": latencyJSON(categoryLatencies.values.flatMap { $0 }.sorted()),
+                "stages": stageResults,
+                "categories": categories,
+            ]
+            if let scaling {
+                results["scaling"] = scaling
+            }
+            writeJSON(results, to: jsonPath)
+        }
     }
 
     // MARK: - Scoring
@@ -122,23 +262,57 @@ struct App {
         candidates: [String]
     ) -> (matchCount: Int, top: [ScoredResult]) {
         var matchCount = 0
-        var heap = Heap<ScoredResult>()
+        var top = TopKCollector<Int>(limit: topK)
 
         for (ci, candidate) in candidates.enumerated() {
             if let match = matcher.score(candidate, against: prepared, buffer: &buffer) {
                 matchCount += 1
-                heap.insert(ScoredResult(score: match.score, index: ci))
-                if heap.count > topK {
-                    _ = heap.popMin()
-                }
+                top.insert(ci, score: match.score, ordinal: ci)
             }
         }
 
-        var results: [ScoredResult] = []
-        results.reserveCapacity(heap.count)
-        while let item = heap.popMax() {
-            results.append(item)
+        let results = top.sortedScoredElements().map { ScoredResult(score: $0.score, index: $0.element) }
+        return (matchCount, results)
+    }
+
+    /// Scores one query on every shard concurrently and merges the per-shard counts
+    /// and top-K results.
+    static func scoreQuerySharded(
+        matcher: FuzzyMatcher,
+        prepared: FuzzyQuery,
+        field: String,
+        workers: [ShardWorker],
+        stages: inout StageTimes
+    ) -> (matchCount: Int, top: [ScoredResult]) {
+        DispatchQueue.concurrentPerform(iterations: workers.count) { w in
+            let worker = workers[w]
+            let start = now()
+            let result = scoreQuery(
+                matcher: matcher,
+                prepared: prepared,
+                buffer: &worker.buffer,
+                candidates: worker.candidates(for: field)
+            )
+            worker.matchCount = result.matchCount
+            worker.top = result.top
+            worker.lastQueryNs = now() - start
+            worker.busyNs += worker.lastQueryNs
+        }
+
+        let mergeStart = now()
+        defer { stages.mergeNs += now() - mergeStart }
+        var matchCount = 0
+        var top = TopKCollector<Int>(limit: topK)
+        for worker in workers {
+            stages.scoreNs += worker.lastQueryNs
+            matchCount += worker.matchCount
+            for result in worker.top {
+                let index = worker.start + result.index
+                top.insert(index, score: result.score, ordinal: index)
+            }
         }
+
+        let results = top.sortedScoredElements().map { ScoredResult(score: $0.score, index: $0.element) }
         return (matchCount, results)
     }
 
@@ -149,6 +323,8 @@ struct App {
         let queriesPath: String
         let iterations: Int
         let useSmithWaterman: Bool
+        let threads: Int
+        let jsonPath: String?
     }
 
     static func parseArgs() -> Config {
@@ -157,7 +333,15 @@ struct App {
         let queriesPath = argValue(for: "--queries", in: args) ?? "../../Resources/queries.tsv"
         let iterations = argValue(for: "--iterations", in: args).flatMap(Int.init) ?? 5
         let useSmithWaterman = args.contains("--sw")
-        return Config(tsvPath: tsvPath, queriesPath: queriesPath, iterations: max(1, iterations), useSmithWaterman: useSmithWaterman)
+        let threads = argValue(for: "--threads", in: args).flatMap(Int.init) ?? 1
+        return Config(
+            tsvPath: tsvPath,
+            queriesPath: queriesPath,
+            iterations: max(1, iterations),
+            useSmithWaterman: useSmithWaterman,
+            threads: max(1, threads),
+            jsonPath: argValue(for: "--json", in: args)
+        )
     }
 
     static func argValue(for flag: String, in args: [String]) -> String? {
@@ -168,31 +352,19 @@ struct App {
     // MARK: - Data Loading
 
     static func loadQueries(from path: String) -> [Query] {
-        let data = try! Data(contentsOf: URL(fileURLWithPath: path))
-        let content = String(decoding: data, as: UTF8.self)
-        return content.split(separator: "\n", omittingEmptySubsequences: true).compactMap { line in
-            let cols = line.split(separator: "\t", omittingEmptySubsequences: false)
-            guard cols.count >= 3 else { return nil }
-            return Query(text: String(cols[0]), field: String(cols[1]), category: String(cols[2]))
+        let table = try! BenchmarkTable(contentsOf: path, kind: .queries)
+        return (0..<table.rowCount).map { row in
+            Query(text: table.columns[0][row], field: table.columns[1][row], category: table.columns[2][row])
         }
     }
 
     static func loadCorpus(from path: String) -> [Instrument] {
         print("Loading corpus from \(path)...", terminator: "")
         fflush(stdout)
-        let data = try! Data(contentsOf: URL(fileURLWithPath: path))
-        let content = String(decoding: data, as: UTF8.self)
-        print(" done (\(data.count) bytes)")
-        let lines = content.split(separator: "\n", omittingEmptySubsequences: false)
-
-        var instruments: [Instrument] = []
-        instruments.reserveCapacity(272_000)
-        for (i, line) in lines.enumerated() {
-            if i == 0 { continue }
-            let cols = line.split(separator: "\t", omittingEmptySubsequences: false)
-            if cols.count >= 3 {
-                instruments.append(Instrument(symbol: String(cols[0]), name: String(cols[1]), isin: String(cols[2])))
-            }
+        let table = try! BenchmarkTable(contentsOf: path, kind: .instruments)
+        print(" done (\(table.byteCount) bytes)")
+        let instruments = (0..<table.rowCount).map { row in
+            Instrument(symbol: table.columns[0][row], name: table.columns[1][row], isin: table.columns[2][row])
         }
         print("Loaded \(instruments.count) instruments")
         return instruments
@@ -208,6 +380,15 @@ struct App {
         Double(end - start) / 1_000_000.0
     }
 
+    // MARK: - Memory
+
+    /// Peak resident set size of this process so far, in bytes (`ru_maxrss` is in bytes on Darwin).
+    static func peakRSSBytes() -> Int {
+        var usage = rusage()
+        guard getrusage(RUSAGE_SELF, &usage) == 0 else { return 0 }
+        return Int(usage.ru_maxrss)
+    }
+
     // MARK: - Output
 
     static func printResults(
@@ -231,6 +412,10 @@ struct App {
         let throughput = totalScored / (medianTotal / 1000.0)
         print("Throughput (median): \(String(format: "%.0f", throughput / 1_000_000.0))M candidates/sec")
         print("Per-query average (median): \(String(format: "%.2f", medianTotal / Double(queries.count)))ms")
+        print("Peak RSS: \(fmtD(Double(peakRSSBytes()) / 1_000_000.0, 1))MB")
+        let samples = queryTimingsMs.flatMap { $0 }.sorted()
+        let tail = [50, 90, 99, 99.9].map { fmtD(percentile(samples, $0), 2) + "ms" }.joined(separator: " / ")
+        print("Latency (p50/p90/p99/p99.9/max): \(tail) / \(fmtD(samples.last ?? 0, 2))ms")
         print("")
 
         printCategorySummary(queries: queries, queryTimingsMs: queryTimingsMs, queryMatchCounts: queryMatchCounts, iterations: iterations)
@@ -238,6 +423,138 @@ struct App {
         printPerQueryDetail(queries: queries, queryTimingsMs: queryTimingsMs, queryMatchCounts: queryMatchCounts, iterations: iterations)
     }
 
+    /// Speedup against the reference pass; efficiency is speedup per thread.
+    /// Utilization is the share of wall time the workers spent scoring, so
+    /// efficiency well below utilization points at memory bandwidth rather than
+    /// load imbalance or dispatch overhead. Returns the same figures for the JSON results.
+    static func printThreadSummary(
+        workers: [ShardWorker],
+        referenceMs: Double,
+        iterationTotalsMs: [Double],
+        scoredPerShardCandidate: Int
+    ) -> [String: Any] {
+        let threads = Double(workers.count)
+        let medianTotal = iterationTotalsMs.sorted()[iterationTotalsMs.count / 2]
+        let speedup = referenceMs / medianTotal
+        let totalBusyMs = workers.map { Double($0.busyNs) / 1_000_000.0 }.reduce(0, +)
+        let totalWallMs = iterationTotalsMs.reduce(0, +)
+        let utilization = totalBusyMs / (threads * totalWallMs)
+        print("")
+        print(
+            "Speedup (median, \(workers.count) threads): \(fmtD(speedup, 2))x, " +
+                "parallel efficiency \(fmtD(100 * speedup / threads, 0))%, utilization \(fmtD(100 * utilization, 0))%"
+        )
+        print("")
+        print("\(pad("Thread", 8)) \(pad("Shard", 10, right: true)) \(pad("Busy(ms)", 10, right: true)) \(pad("M cand/sec", 14, right: true))")
+        print(String(repeating: "-", count: 46))
+        for (w, worker) in workers.enumerated() {
+            let busyMs = Double(worker.busyNs) / 1_000_000.0
+            let scored = Double(worker.names.count) * Double(scoredPerShardCandidate)
+            let throughput = scored / (busyMs / 1000.0) / 1_000_000.0
+            print("\(pad("\(w)", 8)) \(pad("\(worker.names.count)", 10, right: true)) \(pad(fmtD(busyMs, 1), 10, right: true)) \(pad(fmtD(throughput, 1), 14, right: true))")
+        }
+        return ["reference_ms": referenceMs, "speedup": speedup, "efficiency": speedup / threads, "utilization": utilization]
+    }
+
+    /// Latency distribution per category: every query of the category in every
+    /// timed iteration is one sample. Throughput is candidates per second of query
+    /// latency. Returns each category's sorted samples, in milliseconds.
+    static func printLatencyDistribution(
+        queries: [Query],
+        queryTimingsMs: [[Double]],
+        iterations: Int,
+        candidateCount: Int
+    ) -> [String: [Double]] {
+        var samples: [String: [Double]] = [:]
+        for (qi, q) in queries.enumerated() {
+            samples[q.category, default: []].append(contentsOf: queryTimingsMs[qi])
+        }
+        for category in samples.keys {
+            samples[category]?.sort()
+        }
+
+        print("")
+        print("=== Latency Distribution (ms per query, \(iterations) samples per query) ===")
+        print("")
+        let header = ["Samples", "p50", "p90", "p99", "p99.9", "Max"].map { pad($0, 8, right: true) }.joined(separator: " ")
+        print("\(pad("Category", 22)) \(header) \(pad("M cand/sec", 12, right: true))")
+        print(String(repeating: "-", count: 90))
+        func row(_ label: String, _ sorted: [Double]) {
+            let columns = [50, 90, 99, 99.9].map { pad(fmtD(percentile(sorted, $0), 2), 8, right: true) }.joined(separator: " ")
+            let throughput = candidatesPerSecond(sorted, candidateCount: candidateCount) / 1_000_000.0
+            print("\(pad(label, 22)) \(pad("\(sorted.count)", 8, right: true)) \(columns) \(pad(fmtD(sorted.last ?? 0, 2), 8, right: true)) \(pad(fmtD(throughput, 1), 12, right: true))")
+        }
+        for category in categoryOrder {
+            if let sorted = samples[category] {
+                row(category, sorted)
+            }
+        }
+        row("all", samples.values.flatMap { $0 }.sorted())
+        return samples
+    }
+
+    /// Stage breakdown. Throughput is candidates per second of time spent in the
+    /// stage, i.e. how fast the harness would run if that stage were all it did.
+    static func printStages(_ stages: StageTimes, threaded: Bool, totalCandidates: Double) {
+        var rows = [("prepare", stages.prepareNs), ("score", stages.scoreNs)]
+        if threaded {
+            rows.append(("merge", stages.mergeNs))
+        }
+        let sumNs = Double(stages.prepareNs + stages.scoreNs + stages.mergeNs)
+        print("")
+        print("=== Stages (\(threaded ? "score summed over threads" : "single thread")) ===")
+        print("")
+        print("\(pad("Stage", 10)) \(pad("Time(ms)", 12, right: true)) \(pad("Share", 8, right: true)) \(pad("M cand/sec", 14, right: true))")
+        print(String(repeating: "-", count: 47))
+        for (name, ns) in rows {
+            let share = sumNs > 0 ? 100 * Double(ns) / sumNs : 0
+            let throughput = ns > 0 ? totalCandidates / (Double(ns) / 1_000_000_000.0) / 1_000_000.0 : 0
+            print("\(pad(name, 10)) \(pad(fmtD(Double(ns) / 1_000_000.0, 1), 12, right: true)) \(pad(fmtD(share, 1) + "%", 8, right: true)) \(pad(fmtD(throughput, 1), 14, right: true))")
+        }
+    }
+
+    // MARK: - JSON
+
+    /// Nearest-rank percentile of ascending `sorted`; 0 when empty.
+    static func percentile(_ sorted: [Double], _ p: Double) -> Double {
+        guard !sorted.isEmpty else { return 0 }
+        let rank = Int((p / 100 * Double(sorted.count)).rounded(.up))
+        return sorted[min(max(rank, 1), sorted.count) - 1]
+    }
+
+    static func candidatesPerSecond(_ samplesMs: [Double], candidateCount: Int) -> Double {
+        let totalMs = samplesMs.reduce(0, +)
+        return totalMs > 0 ? Double(candidateCount) * Double(samplesMs.count) / (totalMs / 1000.0) : 0
+    }
+
+    static func latencyJSON(_ sorted: [Double]) -> [String: Any] {
+        [
+            "count": sorted.count,
+            "mean": sorted.isEmpty ? 0 : sorted.reduce(0, +) / Double(sorted.count),
+            "p50": percentile(sorted, 50),
+            "p90": percentile(sorted, 90),
+            "p99": percentile(sorted, 99),
+            "p99.9": percentile(sorted, 99.9),
+            "max": sorted.last ?? 0,
+        ]
+    }
+
+    static func stageJSON(_ ns: UInt64, totalCandidates: Double) -> [String: Any] {
+        ["ms": Double(ns) / 1_000_000.0, "candidates_per_sec": ns > 0 ? totalCandidates / (Double(ns) / 1_000_000_000.0) : 0]
+    }
+
+    /// Writes machine-readable results for `compare-bench-json.py`, in the schema
+    /// shared with the RapidFuzz and nucleo harnesses (times in ms).
+    static func writeJSON(_ results: [String: Any], to path: String) {
+        do {
+            let data = try JSONSerialization.data(withJSONObject: results, options: [.prettyPrinted, .sortedKeys])
+            try data.write(to: URL(fileURLWithPath: path))
+        } catch {
+            fputs("Error: cannot write \(path): \(error)\n", stderr)
+            exit(1)
+        }
+    }
+
     static func printCategorySummary(
         queries: [Query],
         queryTimingsMs: [[Double]],
@@ -5,12 +5,14 @@ let package = Package(
     name: "bench-ifrit",
     platforms: [.macOS(.v14)],
     dependencies: [
+        .package(path: "../BenchmarkCorpus"),
         .package(url: "https://github.com/ukushu/Ifrit.git", from: "2.0.0"),
     ],
     targets: [
         .executableTarget(
             name: "bench-ifrit",
             dependencies: [
+                .product(name: "BenchmarkCorpus", package: "BenchmarkCorpus"),
                 .product(name: "Ifrit", package: "Ifrit"),
             ],
             path: "Sources"
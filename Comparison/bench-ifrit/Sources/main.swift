@@ -1,6 +1,7 @@
 // Ifrit (Fuse) benchmark harness
 // NOTE: Ifrit is very slow compared to other matchers. Use --iterations 1 (default).
 
+import BenchmarkCorpus
 import Ifrit
 import Foundation
 
@@ -18,19 +19,13 @@ struct Query {
     let category: String
 }
 
-// MARK: - Load Queries from TSV
+// MARK: - Load Queries (TSV or .fmbench)
 
 func loadQueries(from path: String) -> [Query] {
-    let data = try! Data(contentsOf: URL(fileURLWithPath: path))
-    let content = String(decoding: data, as: UTF8.self)
-    var queries: [Query] = []
-    for line in content.split(separator: "\n", omittingEmptySubsequences: true) {
-        let cols = line.split(separator: "\t", omittingEmptySubsequences: false)
-        if cols.count >= 3 {
-            queries.append(Query(text: String(cols[0]), field: String(cols[1]), category: String(cols[2])))
-        }
+    let table = try! BenchmarkTable(contentsOf: path, kind: .queries)
+    return (0..<table.rowCount).map { row in
+        Query(text: table.columns[0][row], field: table.columns[1][row], category: table.columns[2][row])
     }
-    return queries
 }
 
 // MARK: - Timing
@@ -67,25 +62,16 @@ if let idx = CommandLine.arguments.firstIndex(of: "--iterations"), idx + 1 < Com
     iterationsArg = 1
 }
 
-// Load queries from TSV
+// Load queries (TSV or .fmbench)
 let queries = loadQueries(from: queriesPath)
 
-// Load corpus from TSV
+// Load corpus (TSV or .fmbench)
 print("Loading corpus from \(tsvPath)...", terminator: "")
 fflush(stdout)
-let data = try! Data(contentsOf: URL(fileURLWithPath: tsvPath))
-let content = String(decoding: data, as: UTF8.self)
-print(" done (\(data.count) bytes)")
-let lines = content.split(separator: "\n", omittingEmptySubsequences: false)
-
-var instruments: [Instrument] = []
-instruments.reserveCapacity(272_000)
-for (i, line) in lines.enumerated() {
-    if i == 0 { continue } // skip header
-    let cols = line.split(separator: "\t", omittingEmptySubsequences: false)
-    if cols.count >= 3 {
-        instruments.append(Instrument(symbol: String(cols[0]), name: String(cols[1]), isin: String(cols[2])))
-    }
+let table = try! BenchmarkTable(contentsOf: tsvPath, kind: .instruments)
+print(" done (\(table.byteCount) bytes)")
+let instruments = (0..<table.rowCount).map { row in
+    Instrument(symbol: table.columns[0][row], name: table.columns[1][row], isin: table.columns[2][row])
 }
 print("Loaded \(instruments.count) instruments")
 print("Running \(queries.count) queries")
@@ -1,20 +1,18 @@
+#[path = "../../common/fmbench.rs"]
+mod fmbench;
+
 use nucleo_matcher::pattern::{AtomKind, CaseMatching, Normalization, Pattern};
 use nucleo_matcher::{Config, Matcher, Utf32Str};
 use std::cmp::Reverse;
-use std::collections::BinaryHeap;
+use std::collections::{BTreeMap, BinaryHeap};
 use std::env;
+use std::fmt::Write as _;
 use std::fs;
 use std::path::PathBuf;
-use std::time::Instant;
+use std::time::{Duration, Instant};
 
 const TOP_K: usize = 100;
 
-struct Instrument {
-    symbol: String,
-    name: String,
-    isin: String,
-}
-
 struct Query {
     text: String,
     field: String,
@@ -22,22 +20,72 @@ struct Query {
 }
 
 fn load_queries(path: &str) -> Vec<Query> {
-    let content = fs::read_to_string(path).expect("Failed to read queries TSV file");
-    let mut queries = Vec::new();
-    for line in content.lines() {
-        if line.is_empty() {
-            continue;
-        }
-        let cols: Vec<&str> = line.split('\t').collect();
-        if cols.len() >= 3 {
-            queries.push(Query {
-                text: cols[0].to_string(),
-                field: cols[1].to_string(),
-                category: cols[2].to_string(),
-            });
+    let content = fs::read(path).expect("Failed to read queries file");
+    let [texts, fields, categories] =
+        fmbench::columns(&content, fmbench::Kind::Queries).expect("Failed to parse queries file");
+    texts
+        .iter()
+        .zip(&fields)
+        .zip(&categories)
+        .map(|((text, field), category)| Query {
+            text: text.to_string(),
+            field: field.to_string(),
+            category: category.to_string(),
+        })
+        .collect()
+}
+
+/// Nearest-rank percentile of ascending `sorted`; 0 when empty.
+fn percentile(sorted: &[f64], p: f64) -> f64 {
+    if sorted.is_empty() {
+        return 0.0;
+    }
+    let rank = (p / 100.0 * sorted.len() as f64).ceil() as usize;
+    sorted[rank.clamp(1, sorted.len()) - 1]
+}
+
+/// Candidates per second of query latency over `samples_ms`.
+fn candidates_per_sec(samples_ms: &[f64], candidate_count: usize) -> f64 {
+    let total_ms: f64 = samples_ms.iter().sum();
+    if total_ms > 0.0 {
+        candidate_count as f64 * samples_ms.len() as f64 / (total_ms / 1000.0)
+    } else {
+        0.0
+    }
+}
+
+fn latency_json(sorted: &[f64]) -> String {
+    let mean = if sorted.is_empty() {
+        0.0
+    } else {
+        sorted.iter().sum::<f64>() / sorted.len() as f64
+    };
+    format!(
+        "{{\"count\": {}, \"mean\": {:.4}, \"p50\": {:.4}, \"p90\": {:.4}, \"p99\": {:.4}, \"p99.9\": {:.4}, \"max\": {:.4}}}",
+        sorted.len(),
+        mean,
+        percentile(sorted, 50.0),
+        percentile(sorted, 90.0),
+        percentile(sorted, 99.0),
+        percentile(sorted, 99.9),
+        sorted.last().copied().unwrap_or(0.0)
+    )
+}
+
+fn json_string(s: &str) -> String {
+    let mut out = String::from("\"");
+    for c in s.chars() {
+        match c {
+            '"' => out.push_str("\\\""),
+            '\\' => out.push_str("\\\\"),
+            c if (c as u32) < 0x20 => {
+                let _ = write!(out, "\\u{:04x}", c as u32);
+            }
+            c => out.push(c),
         }
     }
-    queries
+    out.push('"');
+    out
 }
 
 fn main() {
@@ -67,33 +115,17 @@ fn main() {
             .to_string()
     };
 
-    // Load queries from TSV
+    // Load queries (TSV or .fmbench)
     let queries = load_queries(&queries_path);
 
-    // Load corpus into memory
+    // Load corpus into memory (TSV or .fmbench); the candidate columns borrow from it
     println!("Loading corpus from {}...", tsv_path);
-    let content = fs::read_to_string(&tsv_path).expect("Failed to read TSV file");
-    let mut instruments: Vec<Instrument> = Vec::with_capacity(272_000);
-
-    for (i, line) in content.lines().enumerate() {
-        if i == 0 {
-            continue;
-        }
-        let cols: Vec<&str> = line.split('\t').collect();
-        if cols.len() >= 3 {
-            instruments.push(Instrument {
-                symbol: cols[0].to_string(),
-                name: cols[1].to_string(),
-                isin: cols[2].to_string(),
-            });
-        }
-    }
-    println!("Loaded {} instruments", instruments.len());
-
-    // Pre-extract candidate arrays
-    let symbol_candidates: Vec<&str> = instruments.iter().map(|i| i.symbol.as_str()).collect();
-    let name_candidates: Vec<&str> = instruments.iter().map(|i| i.name.as_str()).collect();
-    let isin_candidates: Vec<&str> = instruments.iter().map(|i| i.isin.as_str()).collect();
+    let content = fs::read(&tsv_path).expect("Failed to read corpus file");
+    let [symbol_candidates, name_candidates, isin_candidates] =
+        fmbench::columns(&content, fmbench::Kind::Instruments)
+            .expect("Failed to parse corpus file");
+    let instrument_count = name_candidates.len();
+    println!("Loaded {} instruments", instrument_count);
 
     println!("Running {} queries", queries.len());
     println!();
@@ -107,6 +139,12 @@ fn main() {
         5
     };
 
+    let json_path = args.iter().position(|a| a == "--json").map(|idx| {
+        args.get(idx + 1)
+            .expect("--json requires a path argument")
+            .clone()
+    });
+
     // Warmup
     {
         let mut matcher = Matcher::new(Config::DEFAULT);
@@ -135,12 +173,15 @@ fn main() {
     let mut query_timings_ms: Vec<Vec<f64>> = vec![Vec::new(); query_count];
     let mut query_match_counts: Vec<usize> = vec![0; query_count];
     let mut iteration_totals_ms: Vec<f64> = Vec::new();
+    // Time spent building patterns and scoring candidates, over all timed iterations
+    let mut prepare_time = Duration::ZERO;
+    let mut score_time = Duration::ZERO;
 
     println!();
     println!(
         "=== Benchmark: nucleo scoring {} queries x {} candidates ===",
         query_count,
-        instruments.len()
+        instrument_count
     );
     println!();
 
@@ -161,6 +202,8 @@ fn main() {
 
             let pattern =
                 Pattern::new(&q.text, CaseMatching::Ignore, Normalization::Smart, AtomKind::Fuzzy);
+            let prepared = Instant::now();
+            prepare_time += prepared - q_start;
             let mut match_count: usize = 0;
             let mut heap: BinaryHeap<Reverse<(u32, usize)>> = BinaryHeap::with_capacity(TOP_K + 1);
 
@@ -180,6 +223,7 @@ fn main() {
             let mut top_results: Vec<(u32, usize)> = heap.into_iter().map(|Reverse(x)| x).collect();
             top_results.sort_by(|a, b| b.0.cmp(&a.0));
 
+            score_time += prepared.elapsed();
             let q_elapsed = q_start.elapsed();
             let q_ms = q_elapsed.as_secs_f64() * 1000.0;
             query_timings_ms[qi].push(q_ms);
@@ -210,7 +254,7 @@ fn main() {
         query_count, min_total, median_total, max_total
     );
 
-    let candidates_per_query = instruments.len() as f64;
+    let candidates_per_query = instrument_count as f64;
     let total_candidates_scored = candidates_per_query * query_count as f64;
     let median_throughput = total_candidates_scored / (median_total / 1000.0);
     println!(
@@ -221,6 +265,16 @@ fn main() {
         "Per-query average (median): {:.2}ms",
         median_total / query_count as f64
     );
+    let mut all_samples: Vec<f64> = query_timings_ms.iter().flatten().copied().collect();
+    all_samples.sort_by(|a, b| a.partial_cmp(b).unwrap());
+    println!(
+        "Latency (p50/p90/p99/p99.9/max): {:.2}ms / {:.2}ms / {:.2}ms / {:.2}ms / {:.2}ms",
+        percentile(&all_samples, 50.0),
+        percentile(&all_samples, 90.0),
+        percentile(&all_samples, 99.0),
+        percentile(&all_samples, 99.9),
+        all_samples.last().copied().unwrap_or(0.0)
+    );
     println!();
 
     // Per-category summary — use preferred order, skip missing
@@ -327,4 +381,136 @@ fn main() {
             display_query, q.field, q.category, med, mn, query_match_counts[qi]
         );
     }
+
+    // Latency distribution per category: every query of the category in every
+    // timed iteration is one sample. Throughput is candidates per second of
+    // query latency.
+    let mut category_samples: BTreeMap<&str, Vec<f64>> = BTreeMap::new();
+    for (qi, q) in queries.iter().enumerate() {
+        category_samples
+            .entry(q.category.as_str())
+            .or_default()
+            .extend(&query_timings_ms[qi]);
+    }
+    for samples in category_samples.values_mut() {
+        samples.sort_by(|a, b| a.partial_cmp(b).unwrap());
+    }
+
+    println!();
+    println!(
+        "=== Latency Distribution (ms per query, {} samples per query) ===",
+        iterations
+    );
+    println!();
+    println!(
+        "{:<22} {:>8} {:>8} {:>8} {:>8} {:>8} {:>8} {:>12}",
+        "Category", "Samples", "p50", "p90", "p99", "p99.9", "Max", "M cand/sec"
+    );
+    println!("{}", "-".repeat(90));
+    let print_latency_row = |label: &str, sorted: &[f64]| {
+        println!(
+            "{:<22} {:>8} {:>8.2} {:>8.2} {:>8.2} {:>8.2} {:>8.2} {:>12.1}",
+            label,
+            sorted.len(),
+            percentile(sorted, 50.0),
+            percentile(sorted, 90.0),
+            percentile(sorted, 99.0),
+            percentile(sorted, 99.9),
+            sorted.last().copied().unwrap_or(0.0),
+            candidates_per_sec(sorted, instrument_count) / 1_000_000.0
+        );
+    };
+    for cat in &categories {
+        print_latency_row(cat, &category_samples[cat]);
+    }
+    print_latency_row("all", &all_samples);
+
+    // Stage breakdown. Throughput is candidates per second of time spent in the
+    // stage, i.e. how fast the harness would run if that stage were all it did.
+    let total_candidates = instrument_count as f64 * (query_count * iterations) as f64;
+    let stages = [("prepare", prepare_time), ("score", score_time)];
+    let stage_sum = (prepare_time + score_time).as_secs_f64();
+    let stage_rate = |time: Duration| {
+        if time.is_zero() {
+            0.0
+        } else {
+            total_candidates / time.as_secs_f64()
+        }
+    };
+    println!();
+    println!("=== Stages (single thread) ===");
+    println!();
+    println!(
+        "{:<10} {:>12} {:>8} {:>14}",
+        "Stage", "Time(ms)", "Share", "M cand/sec"
+    );
+    println!("{}", "-".repeat(47));
+    for (name, time) in &stages {
+        let share = if stage_sum > 0.0 {
+            100.0 * time.as_secs_f64() / stage_sum
+        } else {
+            0.0
+        };
+        println!(
+            "{:<10} {:>12.1} {:>7.1}% {:>14.1}",
+            name,
+            time.as_secs_f64() * 1000.0,
+            share,
+            stage_rate(*time) / 1_000_000.0
+        );
+    }
+
+    // Machine-readable results for compare-bench-json.py, in the schema shared
+    // with the FuzzyMatch and RapidFuzz harnesses (times in ms)
+    if let Some(path) = json_path {
+        let mut json = String::new();
+        let _ = write!(
+            json,
+            "{{\n  \"schema\": 1,\n  \"harness\": \"nucleo\",\n  \"variant\": \"fuzzy\",\n  \"candidates\": {},\n  \"queries\": {},\n  \"iterations\": {},\n  \"threads\": 1,\n",
+            instrument_count, query_count, iterations
+        );
+        let _ = write!(
+            json,
+            "  \"total_ms\": {{\"min\": {:.4}, \"median\": {:.4}, \"max\": {:.4}}},\n  \"candidates_per_sec\": {:.1},\n  \"latency_ms\": {},\n",
+            min_total,
+            median_total,
+            max_total,
+            median_throughput,
+            latency_json(&all_samples)
+        );
+        let stage_entries: Vec<String> = stages
+            .iter()
+            .map(|(name, time)| {
+                format!(
+                    "\n    \"{}\": {{\"ms\": {:.4}, \"candidates_per_sec\": {:.1}}}",
+                    name,
+                    time.as_secs_f64() * 1000.0,
+                    stage_rate(*time)
+                )
+            })
+            .collect();
+        let _ = write!(json, "  \"stages\": {{{}\n  }},\n", stage_entries.join(","));
+        let category_entries: Vec<String> = category_samples
+            .iter()
+            .map(|(cat, samples)| {
+                let indices: Vec<usize> = (0..query_count)
+                    .filter(|&i| queries[i].category == *cat)
+                    .collect();
+                format!(
+                    "\n    {}: {{\"queries\": {}, \"matches\": {}, \"candidates_per_sec\": {:.1}, \"latency_ms\": {}}}",
+                    json_string(cat),
+                    indices.len(),
+                    indices.iter().map(|&i| query_match_counts[i]).sum::<usize>(),
+                    candidates_per_sec(samples, instrument_count),
+                    latency_json(samples)
+                )
+            })
+            .collect();
+        let _ = write!(
+            json,
+            "  \"categories\": {{{}\n  }}\n}}\n",
+            category_entries.join(",")
+        );
+        fs::write(&path, json).unwrap_or_else(|e| panic!("Failed to write {}: {}", path, e));
+    }
 }
@@ -1,23 +1,36 @@
 #include <algorithm>
+#include <cerrno>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <queue>
 #include <set>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include <rapidfuzz/fuzz.hpp>
 
-// ─── Data structures ───
+#include "latency_histogram.hpp"
+#include "mmap_corpus.hpp"
+#include "perf_counters.hpp"
 
-struct Instrument {
-    std::string symbol;
-    std::string name;
-    std::string isin;
-};
+// ─── Data structures ───
 
 struct Query {
     std::string text;
@@ -27,6 +40,26 @@ struct Query {
 
 enum class Scorer { WRatio, PartialRatio };
 
+// Time spent in each stage of answering queries, in nanoseconds. With --threads N
+// prepare and score are summed over the workers, so they are CPU time.
+struct StageNs {
+    uint64_t prepare = 0; // lowercasing the query and building the cached scorer
+    uint64_t score = 0;   // scoring every candidate into the top-K heap
+    uint64_t merge = 0;   // merging the workers' counts and heaps (--threads N only)
+
+    StageNs& operator+=(const StageNs& other) {
+        prepare += other.prepare;
+        score += other.score;
+        merge += other.merge;
+        return *this;
+    }
+};
+
+static uint64_t now_ns() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
 // ─── Lowercase helper ───
 
 static std::string to_lower(const std::string& s) {
@@ -36,15 +69,50 @@ static std::string to_lower(const std::string& s) {
     return out;
 }
 
-// ─── Load queries from TSV ───
+// Escapes `s` for use inside a JSON string literal.
+static std::string json_escape(const std::string& s) {
+    std::string out;
+    for (unsigned char c : s) {
+        if (c == '"' || c == '\\') {
+            out.push_back('\\');
+            out.push_back(static_cast<char>(c));
+        } else if (c < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out += escaped;
+        } else {
+            out.push_back(static_cast<char>(c));
+        }
+    }
+    return out;
+}
+
+// ─── Load queries from TSV or .fmbench ───
 
 static std::vector<Query> load_queries(const std::string& path) {
     std::vector<Query> queries;
-    std::ifstream ifs(path);
+    std::ifstream ifs(path, std::ios::binary);
     if (!ifs) {
         std::fprintf(stderr, "Error: cannot open queries file %s\n", path.c_str());
         std::exit(1);
     }
+    char magic[sizeof(fmbench::kMagic)] = {};
+    ifs.read(magic, sizeof(magic));
+    if (fmbench::has_magic(magic, static_cast<size_t>(ifs.gcount()))) {
+        std::string bytes(magic, sizeof(magic));
+        bytes.append(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        fmbench::Columns columns;
+        if (!fmbench::read_table(bytes.data(), bytes.size(), fmbench::Kind::Queries, columns)) {
+            std::fprintf(stderr, "Error: %s is not a valid .fmbench query set\n", path.c_str());
+            std::exit(1);
+        }
+        for (size_t i = 0; i < columns[0].size(); ++i) {
+            queries.push_back({std::string(columns[0][i]), std::string(columns[1][i]), std::string(columns[2][i])});
+        }
+        return queries;
+    }
+    ifs.clear();
+    ifs.seekg(0);
     std::string line;
     while (std::getline(ifs, line)) {
         if (line.empty()) continue;
@@ -52,10 +120,11 @@ static std::vector<Query> load_queries(const std::string& path) {
         if (t1 == std::string::npos) continue;
         size_t t2 = line.find('\t', t1 + 1);
         if (t2 == std::string::npos) continue;
+        size_t t3 = line.find('\t', t2 + 1); // later columns (expected matches) are not the category
         queries.push_back({
             line.substr(0, t1),
             line.substr(t1 + 1, t2 - t1 - 1),
-            line.substr(t2 + 1)
+            line.substr(t2 + 1, t3 == std::string::npos ? std::string::npos : t3 - t2 - 1)
         });
     }
     return queries;
@@ -78,7 +147,7 @@ using TopKHeap = std::priority_queue<std::pair<double, size_t>,
                                      MinScoreCmp>;
 
 template <typename ScorerT>
-static void score_all(ScorerT& scorer, const std::vector<std::string>& candidates,
+static void score_all(ScorerT& scorer, const std::vector<std::string_view>& candidates,
                       size_t& match_count, TopKHeap& top_heap) {
     for (size_t ci = 0; ci < candidates.size(); ++ci) {
         double score = scorer.similarity(candidates[ci], 0.0);
@@ -92,6 +161,171 @@ static void score_all(ScorerT& scorer, const std::vector<std::string>& candidate
     }
 }
 
+template <typename ScorerT>
+static void score_timed(const std::string& q_lower, const std::vector<std::string_view>& candidates,
+                        size_t& match_count, TopKHeap& top_heap, StageNs& stages) {
+    uint64_t start = now_ns();
+    ScorerT scorer(q_lower);
+    uint64_t prepared = now_ns();
+    score_all(scorer, candidates, match_count, top_heap);
+    stages.prepare += prepared - start;
+    stages.score += now_ns() - prepared;
+}
+
+static void score_query(Scorer scorer_type, const std::string& q_lower,
+                        const std::vector<std::string_view>& candidates,
+                        size_t& match_count, TopKHeap& top_heap, StageNs& stages) {
+    if (scorer_type == Scorer::PartialRatio) {
+        score_timed<rapidfuzz::fuzz::CachedPartialRatio<char>>(q_lower, candidates, match_count, top_heap, stages);
+    } else {
+        score_timed<rapidfuzz::fuzz::CachedWRatio<char>>(q_lower, candidates, match_count, top_heap, stages);
+    }
+}
+
+// ─── Worker pool for --threads N ───
+
+// CPUs this process may run on, in ascending order (empty where affinity is unsupported).
+static std::vector<int> available_cpus() {
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+        }
+    }
+#endif
+    return cpus;
+}
+
+static void pin_to_cpu(int cpu) {
+#ifdef __linux__
+    if (cpu < 0) return;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+// Persistent threads that each run the same job, then wait for the next one.
+// When there are enough CPUs, worker w is pinned to the w-th available CPU so
+// that memory it first touches stays on its NUMA node.
+class WorkerPool {
+public:
+    explicit WorkerPool(size_t thread_count) {
+        auto cpus = available_cpus();
+        pinned_ = cpus.size() >= thread_count;
+        threads_.reserve(thread_count);
+        for (size_t w = 0; w < thread_count; ++w) {
+            int cpu = pinned_ ? cpus[w] : -1;
+            threads_.emplace_back([this, w, cpu] {
+                pin_to_cpu(cpu);
+                worker_loop(w);
+            });
+        }
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            ++generation_;
+        }
+        wake_.notify_all();
+        for (auto& t : threads_) t.join();
+    }
+
+    // Runs job(worker) on every worker and returns once all of them are done.
+    void run(const std::function<void(size_t)>& job) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        job_ = &job;
+        pending_ = threads_.size();
+        ++generation_;
+        wake_.notify_all();
+        done_.wait(lock, [this] { return pending_ == 0; });
+        job_ = nullptr;
+    }
+
+    size_t size() const { return threads_.size(); }
+    bool pinned() const { return pinned_; }
+
+private:
+    void worker_loop(size_t worker) {
+        uint64_t seen = 0;
+        for (;;) {
+            const std::function<void(size_t)>* job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return generation_ != seen; });
+                seen = generation_;
+                if (stopping_) return;
+                job = job_;
+            }
+            (*job)(worker);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (--pending_ == 0) done_.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void(size_t)>* job_ = nullptr;
+    uint64_t generation_ = 0;
+    size_t pending_ = 0;
+    bool stopping_ = false;
+    bool pinned_ = false;
+};
+
+// One worker's contiguous slice of the candidate columns and its per-query results.
+// The worker copies its own slice, so first-touch allocates it on the worker's node.
+struct Shard {
+    size_t begin = 0; // index of the slice's first candidate in the full columns
+    std::unique_ptr<char[]> arena; // the slice's lowercased text, column by column
+    std::vector<std::string_view> symbol_lc, name_lc, isin_lc;
+    size_t match_count = 0;
+    TopKHeap top_heap;
+    double busy_ms = 0; // scoring time summed over all timed iterations
+    StageNs stages;     // the worker's share of the last query's stage times
+    std::unique_ptr<PerfCounters> counters; // opened on the worker's thread with --perf-counters
+    PerfCounts query_counts;                // the worker's counts for the last query
+
+    const std::vector<std::string_view>& candidates(const std::string& field) const {
+        return (field == "symbol") ? symbol_lc
+             : (field == "isin")   ? isin_lc
+             :                        name_lc;
+    }
+
+    // Packs candidates [first, last) of every column into the shard's own arena.
+    void copy_from(const MmapCorpus& corpus, size_t first, size_t last) {
+        begin = first;
+        size_t bytes = 0;
+        for (auto* column : {&corpus.symbol_lc, &corpus.name_lc, &corpus.isin_lc}) {
+            for (size_t i = first; i < last; ++i) bytes += (*column)[i].size();
+        }
+        arena = std::make_unique<char[]>(bytes > 0 ? bytes : 1);
+        char* out = arena.get();
+        auto copy = [&](const std::vector<std::string_view>& from, std::vector<std::string_view>& to) {
+            to.reserve(last - first);
+            for (size_t i = first; i < last; ++i) {
+                std::memcpy(out, from[i].data(), from[i].size());
+                to.emplace_back(out, from[i].size());
+                out += from[i].size();
+            }
+        };
+        copy(corpus.symbol_lc, symbol_lc);
+        copy(corpus.name_lc, name_lc);
+        copy(corpus.isin_lc, isin_lc);
+    }
+};
+
 // ─── Main ───
 
 int main(int argc, char* argv[]) {
@@ -101,6 +335,9 @@ int main(int argc, char* argv[]) {
     Scorer scorer_type = Scorer::WRatio;
 
     int iterations = 3; // fewer than FM/nucleo — RapidFuzz (especially WRatio) is too slow for 5
+    size_t thread_count = 1;
+    std::string json_path;
+    bool use_perf_counters = false;
 
     for (int i = 1; i < argc; ++i) {
         if (std::string(argv[i]) == "--tsv" && i + 1 < argc) {
@@ -113,6 +350,12 @@ int main(int argc, char* argv[]) {
             else scorer_type = Scorer::WRatio;
         } else if (std::string(argv[i]) == "--iterations" && i + 1 < argc) {
             iterations = std::atoi(argv[++i]);
+        } else if (std::string(argv[i]) == "--threads" && i + 1 < argc) {
+            thread_count = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+        } else if (std::string(argv[i]) == "--json" && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (std::string(argv[i]) == "--perf-counters") {
+            use_perf_counters = true;
         }
     }
     if (tsv_path.empty()) {
@@ -127,48 +370,83 @@ int main(int argc, char* argv[]) {
     // Load queries from TSV
     auto queries = load_queries(queries_path);
 
-    // Load corpus
+    // Load corpus: mmap'ed, lowercased once into a single arena, fields as string_views
     std::printf("Loading corpus from %s...", tsv_path.c_str());
     std::fflush(stdout);
-    std::ifstream ifs(tsv_path);
-    if (!ifs) {
-        std::fprintf(stderr, " FAILED\nError: cannot open %s\n", tsv_path.c_str());
+    MmapCorpus corpus;
+    if (!corpus.load(tsv_path)) {
+        std::fprintf(stderr, " FAILED\nError: cannot load %s: %s\n", tsv_path.c_str(), std::strerror(errno));
         return 1;
     }
+    std::printf(" done (%zu bytes)\n", corpus.file_bytes());
+    std::printf("Loaded %zu instruments\n", corpus.size());
+    std::printf("Load time: %.1fms, peak RSS after load: %.1fMB\n",
+                corpus.load_ms(), static_cast<double>(peak_rss_bytes()) / 1e6);
 
-    std::vector<Instrument> instruments;
-    instruments.reserve(269000);
-    std::string line;
-    bool first = true;
-    while (std::getline(ifs, line)) {
-        if (first) { first = false; continue; }
-        size_t t1 = line.find('\t');
-        if (t1 == std::string::npos) continue;
-        size_t t2 = line.find('\t', t1 + 1);
-        if (t2 == std::string::npos) continue;
-        instruments.push_back({
-            line.substr(0, t1),
-            line.substr(t1 + 1, t2 - t1 - 1),
-            line.substr(t2 + 1)
+    const auto& symbol_lc = corpus.symbol_lc;
+    const auto& name_lc = corpus.name_lc;
+    const auto& isin_lc = corpus.isin_lc;
+
+    size_t query_count = queries.size();
+    std::printf("Running %zu queries (scorer: %s)\n\n", query_count, scorer_name);
+
+    // With --threads N, every query is scored by N workers, each over its own shard
+    std::vector<Shard> shards(thread_count);
+    std::unique_ptr<WorkerPool> pool;
+    if (thread_count > 1) {
+        pool = std::make_unique<WorkerPool>(thread_count);
+        size_t n = corpus.size();
+        pool->run([&](size_t w) {
+            shards[w].copy_from(corpus, n * w / thread_count, n * (w + 1) / thread_count);
+            if (use_perf_counters) {
+                shards[w].counters = std::make_unique<PerfCounters>();
+                shards[w].counters->open();
+            }
         });
+        std::printf("Threads: %zu (%s)\n\n", thread_count,
+                    pool->pinned() ? "pinned, shards first-touched per worker" : "unpinned");
     }
-    ifs.close();
-    std::printf(" done\n");
-    std::printf("Loaded %zu instruments\n", instruments.size());
-
-    // Pre-extract candidate arrays (lowercased for case-insensitive matching)
-    std::vector<std::string> symbol_lc, name_lc, isin_lc;
-    symbol_lc.reserve(instruments.size());
-    name_lc.reserve(instruments.size());
-    isin_lc.reserve(instruments.size());
-    for (auto& inst : instruments) {
-        symbol_lc.push_back(to_lower(inst.symbol));
-        name_lc.push_back(to_lower(inst.name));
-        isin_lc.push_back(to_lower(inst.isin));
+
+    // With --perf-counters, each query's counts come from the thread(s) that scored it
+    PerfCounters main_counters;
+    bool counters_available = false;
+    bool event_counted[PerfCounts::kEvents] = {};
+    if (use_perf_counters) {
+        PerfCounters& probe = pool ? *shards[0].counters : main_counters;
+        counters_available = pool ? probe.available() : probe.open();
+        if (!counters_available) std::fprintf(stderr, "Hardware counters unavailable: %s\n", probe.error().c_str());
+        for (size_t e = 0; e < PerfCounts::kEvents; ++e) event_counted[e] = probe.has(e);
     }
 
-    size_t query_count = queries.size();
-    std::printf("Running %zu queries (scorer: %s)\n\n", query_count, scorer_name);
+    // Scores one query on the pool, merging the workers' counts and top-K heaps
+    auto score_query_sharded = [&](const std::string& q_lower, const std::string& field,
+                                   size_t& match_count, TopKHeap& top_heap, StageNs& stages, PerfCounts& counts) {
+        pool->run([&](size_t w) {
+            Shard& shard = shards[w];
+            PerfCounts before = shard.counters ? shard.counters->read() : PerfCounts();
+            auto start = std::chrono::high_resolution_clock::now();
+            shard.match_count = 0;
+            shard.top_heap = TopKHeap();
+            shard.stages = StageNs();
+            score_query(scorer_type, q_lower, shard.candidates(field), shard.match_count, shard.top_heap, shard.stages);
+            auto end = std::chrono::high_resolution_clock::now();
+            shard.busy_ms += std::chrono::duration<double, std::milli>(end - start).count();
+            if (shard.counters) shard.query_counts = shard.counters->read() - before;
+        });
+        uint64_t merge_start = now_ns();
+        for (auto& shard : shards) {
+            stages += shard.stages;
+            counts += shard.query_counts;
+            match_count += shard.match_count;
+            while (!shard.top_heap.empty()) {
+                auto [score, ci] = shard.top_heap.top();
+                shard.top_heap.pop();
+                top_heap.push({score, shard.begin + ci});
+                if (top_heap.size() > kTopK) top_heap.pop();
+            }
+        }
+        stages.merge += now_ns() - merge_start;
+    };
 
 
     // Warmup
@@ -189,13 +467,42 @@ int main(int argc, char* argv[]) {
         std::printf("Warmup complete\n");
     }
 
+    // Single-threaded reference pass, the baseline for speedup and parallel efficiency
+    double reference_ms = 0;
+    if (thread_count > 1) {
+        auto ref_start = std::chrono::high_resolution_clock::now();
+        for (auto& q : queries) {
+            auto& candidates = (q.field == "symbol") ? symbol_lc
+                             : (q.field == "isin")   ? isin_lc
+                             :                          name_lc;
+            size_t match_count = 0;
+            TopKHeap top_heap;
+            StageNs stages;
+            score_query(scorer_type, to_lower(q.text), candidates, match_count, top_heap, stages);
+        }
+        auto ref_end = std::chrono::high_resolution_clock::now();
+        reference_ms = std::chrono::duration<double, std::milli>(ref_end - ref_start).count();
+        std::printf("Single-thread reference: %.1fms\n", reference_ms);
+    }
+
     // Per-query timing storage
     std::vector<std::vector<double>> query_timings_ms(query_count);
     std::vector<size_t> query_match_counts(query_count, 0);
     std::vector<double> iteration_totals_ms;
 
+    // Latency distribution, hardware counts and stage times per category, over all iterations
+    struct CategoryStats {
+        size_t queries = 0;
+        size_t matches = 0;
+        LatencyHistogram latency;
+        PerfCounts counters;
+    };
+    std::map<std::string, CategoryStats> category_stats;
+    for (auto& q : queries) ++category_stats[q.category].queries;
+    StageNs stage_totals;
+
     std::printf("\n=== Benchmark: RapidFuzz(%s) scoring %zu queries x %zu candidates ===\n\n",
-                scorer_name, query_count, instruments.size());
+                scorer_name, query_count, corpus.size());
 
     for (int iter = 0; iter < iterations; ++iter) {
         auto iter_start = std::chrono::high_resolution_clock::now();
@@ -206,26 +513,37 @@ int main(int argc, char* argv[]) {
                              : (q.field == "isin")   ? isin_lc
                              :                          name_lc;
 
+            PerfCounts counts_before = counters_available && !pool ? main_counters.read() : PerfCounts();
             auto q_start = std::chrono::high_resolution_clock::now();
 
             std::string q_lower = to_lower(q.text);
             size_t match_count = 0;
             TopKHeap top_heap;
+            StageNs stages;
+            PerfCounts counts;
+            stages.prepare = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::high_resolution_clock::now() - q_start).count());
 
-            if (scorer_type == Scorer::PartialRatio) {
-                rapidfuzz::fuzz::CachedPartialRatio<char> scorer(q_lower);
-                score_all(scorer, candidates, match_count, top_heap);
+            if (pool) {
+                score_query_sharded(q_lower, q.field, match_count, top_heap, stages, counts);
             } else {
-                rapidfuzz::fuzz::CachedWRatio<char> scorer(q_lower);
-                score_all(scorer, candidates, match_count, top_heap);
+                score_query(scorer_type, q_lower, candidates, match_count, top_heap, stages);
             }
 
             auto q_end = std::chrono::high_resolution_clock::now();
+            if (counters_available && !pool) counts = main_counters.read() - counts_before;
             double q_ms = std::chrono::duration<double, std::milli>(q_end - q_start).count();
             query_timings_ms[qi].push_back(q_ms);
             if (iter == 0) {
                 query_match_counts[qi] = match_count;
             }
+
+            auto& stats = category_stats[q.category];
+            stats.latency.record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(q_end - q_start).count()));
+            stats.counters += counts;
+            if (iter == 0) stats.matches += match_count;
+            stage_totals += stages;
         }
 
         auto iter_end = std::chrono::high_resolution_clock::now();
@@ -246,11 +564,20 @@ int main(int argc, char* argv[]) {
     std::printf("Total time for %zu queries (min/median/max): %.1fms / %.1fms / %.1fms\n",
                 query_count, min_total, median_total, max_total);
 
-    double candidates_per_query = static_cast<double>(instruments.size());
+    double candidates_per_query = static_cast<double>(corpus.size());
     double total_scored = candidates_per_query * static_cast<double>(query_count);
     double median_throughput = total_scored / (median_total / 1000.0);
     std::printf("Throughput (median): %.0fM candidates/sec\n", median_throughput / 1e6);
-    std::printf("Per-query average (median): %.2fms\n\n", median_total / static_cast<double>(query_count));
+    std::printf("Per-query average (median): %.2fms\n", median_total / static_cast<double>(query_count));
+    std::printf("Peak RSS: %.1fMB\n", static_cast<double>(peak_rss_bytes()) / 1e6);
+
+    LatencyHistogram all_latency;
+    for (auto& entry : category_stats) all_latency.merge(entry.second.latency);
+    auto ms = [](uint64_t ns) { return static_cast<double>(ns) / 1e6; };
+    std::printf("Latency (p50/p90/p99/p99.9/max): %.2fms / %.2fms / %.2fms / %.2fms / %.2fms\n\n",
+                ms(all_latency.percentile_ns(50)), ms(all_latency.percentile_ns(90)),
+                ms(all_latency.percentile_ns(99)), ms(all_latency.percentile_ns(99.9)), ms(all_latency.max_ns()));
+
 
     // Per-category summary — use preferred order, skip missing
     const char* preferred_categories[] = {
@@ -315,5 +642,156 @@ int main(int argc, char* argv[]) {
                     display.c_str(), q.field.c_str(), q.category.c_str(), med, mn, query_match_counts[qi]);
     }
 
+    // Latency distribution per category: every query of the category in every
+    // timed iteration is one sample. Throughput is candidates per second of
+    // query latency.
+    std::printf("\n=== Latency Distribution (ms per query, %d samples per query) ===\n\n", iterations);
+    std::printf("%-22s %8s %8s %8s %8s %8s %8s %12s\n",
+                "Category", "Samples", "p50", "p90", "p99", "p99.9", "Max", "M cand/sec");
+    for (int i = 0; i < 90; ++i) std::putchar('-');
+    std::putchar('\n');
+    auto print_latency_row = [&](const char* label, const LatencyHistogram& h) {
+        double cand_per_sec = h.mean_ns() > 0 ? static_cast<double>(corpus.size()) / (h.mean_ns() / 1e9) : 0;
+        std::printf("%-22s %8llu %8.2f %8.2f %8.2f %8.2f %8.2f %12.1f\n", label,
+                    static_cast<unsigned long long>(h.count()), ms(h.percentile_ns(50)), ms(h.percentile_ns(90)),
+                    ms(h.percentile_ns(99)), ms(h.percentile_ns(99.9)), ms(h.max_ns()), cand_per_sec / 1e6);
+    };
+    for (auto cat : preferred_categories) {
+        auto it = category_stats.find(cat);
+        if (it != category_stats.end()) print_latency_row(cat, it->second.latency);
+    }
+    print_latency_row("all", all_latency);
+
+    // Stage breakdown. Throughput is candidates per second of time spent in the
+    // stage, i.e. how fast the harness would run if that stage were all it did.
+    double total_candidates = static_cast<double>(corpus.size()) * static_cast<double>(query_count * iterations);
+    struct StageRow { const char* name; uint64_t ns; };
+    std::vector<StageRow> stage_rows = {{"prepare", stage_totals.prepare}, {"score", stage_totals.score}};
+    if (pool) stage_rows.push_back({"merge", stage_totals.merge});
+    uint64_t stage_sum_ns = stage_totals.prepare + stage_totals.score + stage_totals.merge;
+    std::printf("\n=== Stages (%s) ===\n\n", pool ? "prepare and score summed over threads" : "single thread");
+    std::printf("%-10s %12s %8s %14s\n", "Stage", "Time(ms)", "Share", "M cand/sec");
+    for (int i = 0; i < 47; ++i) std::putchar('-');
+    std::putchar('\n');
+    for (auto& row : stage_rows) {
+        std::printf("%-10s %12.1f %7.1f%% %14.1f\n", row.name, ms(row.ns),
+                    stage_sum_ns > 0 ? 100.0 * static_cast<double>(row.ns) / static_cast<double>(stage_sum_ns) : 0.0,
+                    row.ns > 0 ? total_candidates / (static_cast<double>(row.ns) / 1e9) / 1e6 : 0.0);
+    }
+
+    // Hardware counters per category, normalised per candidate scored
+    auto per_candidate = [&](const CategoryStats& stats, size_t event) {
+        double scored = static_cast<double>(corpus.size()) * static_cast<double>(stats.latency.count());
+        return scored > 0 ? static_cast<double>(stats.counters.values[event]) / scored : 0.0;
+    };
+    auto ipc = [](const PerfCounts& counts) {
+        return counts.cycles() > 0 ? static_cast<double>(counts.instructions()) / static_cast<double>(counts.cycles()) : 0.0;
+    };
+    if (counters_available) {
+        std::printf("\n=== Hardware Counters (per candidate; misses per 1000 candidates) ===\n\n");
+        std::printf("%-22s %10s %10s %6s %10s %10s %10s\n",
+                    "Category", "Cycles", "Instr", "IPC", "L1D miss", "LLC miss", "Br miss");
+        for (int i = 0; i < 84; ++i) std::putchar('-');
+        std::putchar('\n');
+        for (auto cat : preferred_categories) {
+            auto it = category_stats.find(cat);
+            if (it == category_stats.end()) continue;
+            const auto& stats = it->second;
+            auto column = [&](size_t event, double scale, int width, int precision) {
+                if (event_counted[event]) std::printf(" %*.*f", width, precision, scale * per_candidate(stats, event));
+                else std::printf(" %*s", width, "-");
+            };
+            std::printf("%-22s", cat);
+            column(0, 1, 10, 1);
+            column(1, 1, 10, 1);
+            if (event_counted[1]) std::printf(" %6.2f", ipc(stats.counters));
+            else std::printf(" %6s", "-");
+            column(2, 1000, 10, 2);
+            column(3, 1000, 10, 2);
+            column(4, 1000, 10, 2);
+            std::putchar('\n');
+        }
+    }
+
+    double speedup = 0, efficiency = 0, utilization = 0;
+    if (pool) {
+        // Speedup against the reference pass; efficiency is speedup per thread.
+        // Utilization is the share of wall time the workers spent scoring, so
+        // efficiency well below utilization points at memory bandwidth rather
+        // than load imbalance or dispatch overhead.
+        speedup = reference_ms / median_total;
+        efficiency = speedup / static_cast<double>(thread_count);
+        double total_busy_ms = 0;
+        for (auto& shard : shards) total_busy_ms += shard.busy_ms;
+        double total_wall_ms = std::accumulate(iteration_totals_ms.begin(), iteration_totals_ms.end(), 0.0);
+        utilization = total_busy_ms / (static_cast<double>(thread_count) * total_wall_ms);
+        std::printf("\nSpeedup (median, %zu threads): %.2fx, parallel efficiency %.0f%%, utilization %.0f%%\n\n",
+                    thread_count, speedup, 100.0 * efficiency, 100.0 * utilization);
+
+        std::printf("%-8s %10s %10s %14s\n", "Thread", "Shard", "Busy(ms)", "M cand/sec");
+        for (int i = 0; i < 46; ++i) std::putchar('-');
+        std::putchar('\n');
+        for (size_t w = 0; w < thread_count; ++w) {
+            auto& shard = shards[w];
+            double scored = static_cast<double>(shard.name_lc.size()) * static_cast<double>(query_count * iterations);
+            std::printf("%-8zu %10zu %10.1f %14.1f\n",
+                        w, shard.name_lc.size(), shard.busy_ms, scored / (shard.busy_ms / 1000.0) / 1e6);
+        }
+    }
+
+    // Machine-readable results for compare-bench-json.py, in the schema shared
+    // with the FuzzyMatch and nucleo harnesses (times in ms)
+    if (!json_path.empty()) {
+        FILE* out = std::fopen(json_path.c_str(), "w");
+        if (out == nullptr) {
+            std::fprintf(stderr, "Error: cannot write %s: %s\n", json_path.c_str(), std::strerror(errno));
+            return 1;
+        }
+        auto latency_json = [&](const LatencyHistogram& h) {
+            std::fprintf(out, "{\"count\": %llu, \"mean\": %.4f, \"p50\": %.4f, \"p90\": %.4f, "
+                              "\"p99\": %.4f, \"p99.9\": %.4f, \"max\": %.4f}",
+                         static_cast<unsigned long long>(h.count()), h.mean_ns() / 1e6, ms(h.percentile_ns(50)),
+                         ms(h.percentile_ns(90)), ms(h.percentile_ns(99)), ms(h.percentile_ns(99.9)), ms(h.max_ns()));
+        };
+        std::fprintf(out, "{\n  \"schema\": 1,\n  \"harness\": \"rapidfuzz\",\n  \"variant\": \"%s\",\n", scorer_name);
+        std::fprintf(out, "  \"candidates\": %zu,\n  \"queries\": %zu,\n  \"iterations\": %d,\n  \"threads\": %zu,\n",
+                     corpus.size(), query_count, iterations, thread_count);
+        std::fprintf(out, "  \"load_ms\": %.4f,\n  \"peak_rss_bytes\": %zu,\n", corpus.load_ms(), peak_rss_bytes());
+        std::fprintf(out, "  \"total_ms\": {\"min\": %.4f, \"median\": %.4f, \"max\": %.4f},\n",
+                     min_total, median_total, max_total);
+        std::fprintf(out, "  \"candidates_per_sec\": %.1f,\n  \"latency_ms\": ", median_throughput);
+        latency_json(all_latency);
+        std::fprintf(out, ",\n  \"stages\": {");
+        for (size_t i = 0; i < stage_rows.size(); ++i) {
+            auto& row = stage_rows[i];
+            std::fprintf(out, "%s\n    \"%s\": {\"ms\": %.4f, \"candidates_per_sec\": %.1f}", i ? "," : "", row.name,
+                         ms(row.ns), row.ns > 0 ? total_candidates / (static_cast<double>(row.ns) / 1e9) : 0.0);
+        }
+        std::fprintf(out, "\n  },\n");
+        if (pool) {
+            std::fprintf(out, "  \"scaling\": {\"reference_ms\": %.4f, \"speedup\": %.4f, \"efficiency\": %.4f, "
+                              "\"utilization\": %.4f},\n", reference_ms, speedup, efficiency, utilization);
+        }
+        std::fprintf(out, "  \"categories\": {");
+        bool first = true;
+        for (auto& [cat, stats] : category_stats) {
+            std::fprintf(out, "%s\n    \"%s\": {\"queries\": %zu, \"matches\": %zu, \"candidates_per_sec\": %.1f, \"latency_ms\": ",
+                         first ? "" : ",", json_escape(cat).c_str(), stats.queries, stats.matches,
+                         stats.latency.mean_ns() > 0 ? static_cast<double>(corpus.size()) / (stats.latency.mean_ns() / 1e9) : 0.0);
+            latency_json(stats.latency);
+            if (counters_available) {
+                std::fprintf(out, ", \"counters_per_candidate\": {");
+                for (size_t e = 0; e < PerfCounts::kEvents; ++e) {
+                    if (event_counted[e]) std::fprintf(out, "\"%s\": %.6f, ", PerfCounts::kNames[e], per_candidate(stats, e));
+                }
+                std::fprintf(out, "\"ipc\": %.4f}", ipc(stats.counters));
+            }
+            std::fprintf(out, "}");
+            first = false;
+        }
+        std::fprintf(out, "\n  }\n}\n");
+        std::fclose(out);
+    }
+
     return 0;
 }
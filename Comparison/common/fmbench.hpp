@@ -0,0 +1,84 @@
+// Reader for the .fmbench binary corpus and query-set format written by
+// Comparison/make-binary-corpus.py, which documents the layout.
+//
+// A table is read in place: its columns are std::string_views into the bytes
+// passed in, normally an mmap'ed file, so loading costs one pass over the
+// offset tables.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+namespace fmbench {
+
+constexpr char kMagic[8] = {'F', 'M', 'B', 'E', 'N', 'C', 'H', '\0'};
+constexpr uint32_t kVersion = 1;
+constexpr size_t kHeaderBytes = 32;
+constexpr uint32_t kColumnCount = 3;
+
+enum class Kind : uint32_t {
+    Instruments = 1, // symbol, name, isin
+    Queries = 2,     // text, field, category
+};
+
+using Columns = std::vector<std::string_view>[kColumnCount];
+
+// True if `bytes` start with the format's magic, i.e. should be read with read_table
+// rather than parsed as TSV.
+inline bool has_magic(const char* bytes, size_t size) {
+    return size >= sizeof(kMagic) && std::memcmp(bytes, kMagic, sizeof(kMagic)) == 0;
+}
+
+inline uint64_t load_u64(const char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v; // the format is little-endian, as is every platform the harnesses run on
+}
+
+inline uint32_t load_u32(const char* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// Splits a table of `kind` into its columns. Returns false, leaving `columns` in an
+// unspecified state, if the bytes are not a well-formed version-1 table of that kind.
+inline bool read_table(const char* bytes, size_t size, Kind kind, Columns& columns) {
+    if (size < kHeaderBytes || !has_magic(bytes, size)) return false;
+    if (load_u32(bytes + 8) != kVersion) return false;
+    if (load_u32(bytes + 12) != static_cast<uint32_t>(kind)) return false;
+    if (load_u32(bytes + 24) != kColumnCount) return false;
+    uint64_t rows = load_u64(bytes + 16);
+
+    size_t pos = kHeaderBytes;
+    for (auto& column : columns) {
+        if (size - pos < 8) return false;
+        uint64_t byte_count = load_u64(bytes + pos);
+        pos += 8;
+        if (rows >= (size - pos) / 8) return false; // offsets table would overrun
+        const char* offsets = bytes + pos;
+        pos += static_cast<size_t>(rows + 1) * 8;
+        if (byte_count > size - pos) return false;
+        const char* text = bytes + pos;
+        pos += static_cast<size_t>((byte_count + 7) & ~uint64_t(7));
+        if (pos > size) return false;
+
+        column.clear();
+        column.reserve(static_cast<size_t>(rows));
+        uint64_t start = load_u64(offsets);
+        if (start != 0) return false;
+        for (uint64_t r = 0; r < rows; ++r) {
+            uint64_t end = load_u64(offsets + (r + 1) * 8);
+            if (end < start || end > byte_count) return false;
+            column.emplace_back(text + start, static_cast<size_t>(end - start));
+            start = end;
+        }
+        if (start != byte_count) return false;
+    }
+    return true;
+}
+
+} // namespace fmbench
@@ -0,0 +1,115 @@
+//! Corpus and query-set loading shared by the Rust comparison harnesses.
+//!
+//! A file is either TSV or the .fmbench binary table written by
+//! `Comparison/make-binary-corpus.py` (which documents the layout), told apart by
+//! its first bytes. Either way the three columns borrow from the file's bytes.
+
+pub const MAGIC: &[u8; 8] = b"FMBENCH\0";
+pub const VERSION: u32 = 1;
+const HEADER_BYTES: usize = 32;
+const COLUMN_COUNT: u32 = 3;
+
+#[derive(Clone, Copy, PartialEq, Eq)]
+pub enum Kind {
+    /// symbol, name, isin; the TSV has a header line.
+    Instruments = 1,
+    /// text, field, category; the TSV has no header line.
+    Queries = 2,
+}
+
+pub type Columns<'a> = [Vec<&'a str>; 3];
+
+pub fn has_magic(bytes: &[u8]) -> bool {
+    bytes.len() >= MAGIC.len() && &bytes[..MAGIC.len()] == MAGIC
+}
+
+/// Splits `bytes` into the columns of a table of `kind`, reading .fmbench or TSV.
+pub fn columns(bytes: &[u8], kind: Kind) -> Result<Columns<'_>, String> {
+    if has_magic(bytes) {
+        read_table(bytes, kind)
+    } else {
+        let text = std::str::from_utf8(bytes).map_err(|e| format!("not UTF-8: {e}"))?;
+        Ok(read_tsv(text, kind == Kind::Instruments))
+    }
+}
+
+/// A line contributes a row when it has at least three tab-separated fields.
+pub fn read_tsv(text: &str, skip_header: bool) -> Columns<'_> {
+    let mut columns: Columns = [Vec::new(), Vec::new(), Vec::new()];
+    for (i, line) in text.lines().enumerate() {
+        if (skip_header && i == 0) || line.is_empty() {
+            continue;
+        }
+        let mut fields = line.split('\t');
+        if let (Some(a), Some(b), Some(c)) = (fields.next(), fields.next(), fields.next()) {
+            columns[0].push(a);
+            columns[1].push(b);
+            columns[2].push(c);
+        }
+    }
+    columns
+}
+
+fn load_u32(bytes: &[u8], at: usize) -> u32 {
+    u32::from_le_bytes(bytes[at..at + 4].try_into().unwrap())
+}
+
+fn load_u64(bytes: &[u8], at: usize) -> u64 {
+    u64::from_le_bytes(bytes[at..at + 8].try_into().unwrap())
+}
+
+pub fn read_table(bytes: &[u8], kind: Kind) -> Result<Columns<'_>, String> {
+    let malformed = || "malformed .fmbench table".to_string();
+    if bytes.len() < HEADER_BYTES || !has_magic(bytes) {
+        return Err(malformed());
+    }
+    let version = load_u32(bytes, 8);
+    if version != VERSION {
+        return Err(format!("unsupported .fmbench version {version}"));
+    }
+    if load_u32(bytes, 12) != kind as u32 {
+        return Err("wrong .fmbench table kind".to_string());
+    }
+    if load_u32(bytes, 24) != COLUMN_COUNT {
+        return Err(malformed());
+    }
+    let rows = usize::try_from(load_u64(bytes, 16)).map_err(|_| malformed())?;
+
+    let mut columns: Columns = [Vec::new(), Vec::new(), Vec::new()];
+    let mut pos = HEADER_BYTES;
+    for column in columns.iter_mut() {
+        let byte_count = bytes
+            .get(pos..pos + 8)
+            .map(|_| load_u64(bytes, pos) as usize)
+            .ok_or_else(malformed)?;
+        pos += 8;
+        let offsets_end = rows
+            .checked_add(1)
+            .and_then(|n| n.checked_mul(8))
+            .and_then(|n| n.checked_add(pos))
+            .filter(|&end| end <= bytes.len())
+            .ok_or_else(malformed)?;
+        let offsets = pos;
+        pos = offsets_end;
+        let text = bytes
+            .get(pos..pos.checked_add(byte_count).ok_or_else(malformed)?)
+            .ok_or_else(malformed)?;
+        let text = std::str::from_utf8(text).map_err(|_| malformed())?;
+        pos += (byte_count + 7) & !7;
+        if pos > bytes.len() {
+            return Err(malformed());
+        }
+
+        column.reserve(rows);
+        let mut start = load_u64(bytes, offsets) as usize;
+        for r in 0..rows {
+            let end = load_u64(bytes, offsets + (r + 1) * 8) as usize;
+            column.push(text.get(start..end).ok_or_else(malformed)?);
+            start = end;
+        }
+        if start != byte_count {
+            return Err(malformed());
+        }
+    }
+    Ok(columns)
+}
@@ -0,0 +1,90 @@
+// HDR-style latency histogram shared by the C++ comparison harnesses.
+//
+// Values are nanoseconds. Below 128ns every value has its own bucket; above
+// that each power-of-two range is split into 64 equal buckets, so a recorded
+// value is known to within 1/64 (1.6%) at any magnitude while the whole
+// 64-bit range fits in a few thousand counters. Percentiles report the upper
+// bound of the bucket they fall in (clamped to the largest value recorded),
+// so tails are never under-reported.
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+class LatencyHistogram {
+public:
+    LatencyHistogram() : counts_(kBucketCount, 0) {}
+
+    void record(uint64_t ns) {
+        ++counts_[bucket_index(ns)];
+        ++count_;
+        sum_ns_ += static_cast<double>(ns);
+        min_ns_ = std::min(min_ns_, ns);
+        max_ns_ = std::max(max_ns_, ns);
+    }
+
+    void merge(const LatencyHistogram& other) {
+        for (size_t i = 0; i < kBucketCount; ++i) counts_[i] += other.counts_[i];
+        count_ += other.count_;
+        sum_ns_ += other.sum_ns_;
+        min_ns_ = std::min(min_ns_, other.min_ns_);
+        max_ns_ = std::max(max_ns_, other.max_ns_);
+    }
+
+    uint64_t count() const { return count_; }
+    uint64_t min_ns() const { return count_ == 0 ? 0 : min_ns_; }
+    uint64_t max_ns() const { return max_ns_; }
+    double mean_ns() const { return count_ == 0 ? 0 : sum_ns_ / static_cast<double>(count_); }
+
+    // Smallest bucket bound that at least `percentile`% of the recorded values
+    // do not exceed; 0 when nothing was recorded.
+    uint64_t percentile_ns(double percentile) const {
+        if (count_ == 0) return 0;
+        double rank = std::ceil(percentile / 100.0 * static_cast<double>(count_));
+        uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(rank));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            seen += counts_[i];
+            if (seen >= target) return std::min(bucket_upper_bound(i), max_ns_);
+        }
+        return max_ns_;
+    }
+
+private:
+    static constexpr unsigned kSubBucketBits = 7;
+    static constexpr uint64_t kSubBuckets = uint64_t(1) << kSubBucketBits; // exact below this
+    static constexpr uint64_t kHalf = kSubBuckets / 2;                      // buckets per power of two above it
+    static constexpr size_t kBucketCount = kSubBuckets + (64 - kSubBucketBits) * kHalf;
+
+    static unsigned highest_bit(uint64_t v) {
+        unsigned bit = 0;
+        while (v >>= 1) ++bit;
+        return bit;
+    }
+
+    static size_t bucket_index(uint64_t v) {
+        if (v < kSubBuckets) return static_cast<size_t>(v);
+        unsigned shift = highest_bit(v) - (kSubBucketBits - 1); // keeps the top bits in [kHalf, kSubBuckets)
+        uint64_t mantissa = v >> shift;
+        return static_cast<size_t>(kSubBuckets + (shift - 1) * kHalf + (mantissa - kHalf));
+    }
+
+    static uint64_t bucket_upper_bound(size_t index) {
+        if (index < kSubBuckets) return index;
+        uint64_t above = index - kSubBuckets;
+        unsigned shift = static_cast<unsigned>(above / kHalf) + 1;
+        uint64_t mantissa = kHalf + above % kHalf;
+        uint64_t next = (mantissa + 1) << shift;
+        return next == 0 ? std::numeric_limits<uint64_t>::max() : next - 1;
+    }
+
+    std::vector<uint64_t> counts_;
+    uint64_t count_ = 0;
+    double sum_ns_ = 0;
+    uint64_t min_ns_ = std::numeric_limits<uint64_t>::max();
+    uint64_t max_ns_ = 0;
+};
@@ -0,0 +1,179 @@
+// Zero-copy corpus loader shared by the C++ comparison harnesses.
+//
+// The corpus file is mmap'ed read-only. It is either the instruments TSV (header
+// line, then symbol<TAB>name<TAB>isin per line) or the equivalent .fmbench table
+// (see fmbench.hpp), told apart by the file's first bytes. The field text is
+// lowercased once into a single arena the size of the file, so a field's
+// lowercased text sits at the same offset in the arena as its original text in
+// the mapping. Every field is handed out as a std::string_view: no per-field
+// allocation, no second copy for lowercasing.
+#pragma once
+
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "fmbench.hpp"
+
+class MmapCorpus {
+public:
+    MmapCorpus() = default;
+    MmapCorpus(const MmapCorpus&) = delete;
+    MmapCorpus& operator=(const MmapCorpus&) = delete;
+
+    ~MmapCorpus() {
+        if (mapping_ != nullptr) munmap(mapping_, file_bytes_);
+    }
+
+    // Maps and indexes the corpus at `path`. Returns false with errno set if the
+    // file cannot be opened or mapped, or with errno set to EINVAL if it is a
+    // malformed .fmbench table.
+    bool load(const std::string& path) {
+        auto start = std::chrono::steady_clock::now();
+
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            int saved = errno;
+            close(fd);
+            errno = saved;
+            return false;
+        }
+        file_bytes_ = static_cast<size_t>(st.st_size);
+        if (file_bytes_ > 0) {
+            void* mapping = mmap(nullptr, file_bytes_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {
+                int saved = errno;
+                close(fd);
+                errno = saved;
+                return false;
+            }
+            mapping_ = mapping;
+            madvise(mapping_, file_bytes_, MADV_SEQUENTIAL);
+        }
+        close(fd);
+
+        const char* text = static_cast<const char*>(mapping_);
+        arena_ = std::make_unique<char[]>(file_bytes_ > 0 ? file_bytes_ : 1);
+
+        if (fmbench::has_magic(text, file_bytes_)) {
+            fmbench::Columns columns;
+            if (!fmbench::read_table(text, file_bytes_, fmbench::Kind::Instruments, columns)) {
+                errno = EINVAL;
+                return false;
+            }
+            add_column(symbol, symbol_lc, columns[0]);
+            add_column(name, name_lc, columns[1]);
+            add_column(isin, isin_lc, columns[2]);
+        } else {
+            lowercase(0, file_bytes_);
+            index_tsv(text);
+        }
+
+        load_ms_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return true;
+    }
+
+    size_t size() const { return name.size(); }
+    size_t file_bytes() const { return file_bytes_; }
+    double load_ms() const { return load_ms_; }
+
+    // Lowercased views of the column a query searches.
+    const std::vector<std::string_view>& lowercased(const std::string& field) const {
+        return (field == "symbol") ? symbol_lc
+             : (field == "isin")   ? isin_lc
+             :                        name_lc;
+    }
+
+    // Original-case fields, viewing the mapping.
+    std::vector<std::string_view> symbol, name, isin;
+    // Lowercased fields, viewing the arena.
+    std::vector<std::string_view> symbol_lc, name_lc, isin_lc;
+
+private:
+    // Lowercases mapping bytes [begin, end) into the same range of the arena.
+    void lowercase(size_t begin, size_t end) {
+        const char* text = static_cast<const char*>(mapping_);
+        for (size_t i = begin; i < end; ++i) {
+            char c = text[i];
+            arena_[i] = (c >= 'A' && c <= 'Z') ? static_cast<char>(c + ('a' - 'A')) : c;
+        }
+    }
+
+    void index_tsv(const char* text) {
+        // Skip the header, then take the first three tab-separated fields of every
+        // line that has them. Later columns (the product class) are ignored, as in
+        // the other harnesses and in .fmbench tables.
+        size_t pos = 0;
+        while (pos < file_bytes_ && text[pos] != '\n') ++pos;
+        ++pos;
+        while (pos < file_bytes_) {
+            size_t end = pos;
+            while (end < file_bytes_ && text[end] != '\n') ++end;
+            size_t t1 = find_tab(text, pos, end);
+            size_t t2 = (t1 == end) ? end : find_tab(text, t1 + 1, end);
+            if (t2 != end) {
+                add_field(symbol, symbol_lc, pos, t1);
+                add_field(name, name_lc, t1 + 1, t2);
+                add_field(isin, isin_lc, t2 + 1, find_tab(text, t2 + 1, end));
+            }
+            pos = end + 1;
+        }
+    }
+
+    // Adopts a column read from an .fmbench table: the views already point into
+    // the mapping, and the column's text is lowercased in one pass.
+    void add_column(std::vector<std::string_view>& original, std::vector<std::string_view>& lowered,
+                    std::vector<std::string_view>& column) {
+        const char* text = static_cast<const char*>(mapping_);
+        if (!column.empty()) {
+            size_t begin = static_cast<size_t>(column.front().data() - text);
+            size_t end = static_cast<size_t>(column.back().data() + column.back().size() - text);
+            lowercase(begin, end);
+        }
+        lowered.reserve(column.size());
+        for (auto view : column) {
+            lowered.emplace_back(arena_.get() + (view.data() - text), view.size());
+        }
+        original = std::move(column);
+    }
+
+    static size_t find_tab(const char* text, size_t from, size_t end) {
+        while (from < end && text[from] != '\t') ++from;
+        return from;
+    }
+
+    void add_field(std::vector<std::string_view>& original, std::vector<std::string_view>& lowered,
+                   size_t begin, size_t end) {
+        original.emplace_back(static_cast<const char*>(mapping_) + begin, end - begin);
+        lowered.emplace_back(arena_.get() + begin, end - begin);
+    }
+
+    void* mapping_ = nullptr;
+    size_t file_bytes_ = 0;
+    std::unique_ptr<char[]> arena_;
+    double load_ms_ = 0;
+};
+
+// Peak resident set size of this process so far, in bytes.
+inline size_t peak_rss_bytes() {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return static_cast<size_t>(usage.ru_maxrss); // bytes on macOS
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024; // kilobytes on Linux
+#endif
+}
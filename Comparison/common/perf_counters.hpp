@@ -0,0 +1,128 @@
+// Hardware performance counters for the C++ comparison harnesses, read through
+// Linux perf_event_open.
+//
+// A PerfCounters counts user-space events of the thread that opened it, from
+// open() until it is destroyed; callers read() a snapshot before and after the
+// work they want to attribute and subtract. Events the CPU or hypervisor does
+// not expose are left out rather than failing the whole group, and on other
+// platforms open() always fails, so harnesses can report counters as
+// unavailable and carry on timing.
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+struct PerfCounts {
+    static constexpr size_t kEvents = 5;
+    static constexpr const char* kNames[kEvents] = {
+        "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses",
+    };
+
+    uint64_t values[kEvents] = {};
+
+    uint64_t cycles() const { return values[0]; }
+    uint64_t instructions() const { return values[1]; }
+
+    PerfCounts& operator+=(const PerfCounts& other) {
+        for (size_t i = 0; i < kEvents; ++i) values[i] += other.values[i];
+        return *this;
+    }
+
+    PerfCounts operator-(const PerfCounts& since) const {
+        PerfCounts delta;
+        for (size_t i = 0; i < kEvents; ++i) delta.values[i] = values[i] - since.values[i];
+        return delta;
+    }
+};
+
+class PerfCounters {
+public:
+    PerfCounters() = default;
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    ~PerfCounters() {
+#ifdef __linux__
+        for (int fd : fds_) {
+            if (fd >= 0) close(fd);
+        }
+#endif
+    }
+
+    // Opens and starts the counters for the calling thread. Returns false with
+    // error() describing why if not even the cycle counter could be opened.
+    bool open() {
+#ifdef __linux__
+        static constexpr struct { uint32_t type; uint64_t config; } kEvents[PerfCounts::kEvents] = {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                     (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        };
+        for (size_t i = 0; i < PerfCounts::kEvents; ++i) {
+            struct perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = kEvents[i].type;
+            attr.config = kEvents[i].config;
+            attr.disabled = (leader_ < 0) ? 1 : 0; // the leader starts the whole group
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, leader_, 0));
+            if (fd < 0) {
+                if (i == 0) {
+                    error_ = std::string("perf_event_open: ") + std::strerror(errno);
+                    return false;
+                }
+                continue;
+            }
+            fds_[i] = fd;
+            if (leader_ < 0) leader_ = fd;
+            order_[members_++] = i;
+        }
+        ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        return true;
+#else
+        error_ = "hardware counters need Linux perf_event_open";
+        return false;
+#endif
+    }
+
+    bool available() const { return leader_ >= 0; }
+    const std::string& error() const { return error_; }
+
+    // Whether event `i` of PerfCounts is being counted.
+    bool has(size_t i) const { return fds_[i] >= 0; }
+
+    // Running totals since open(); all zero when unavailable.
+    PerfCounts read() const {
+        PerfCounts counts;
+#ifdef __linux__
+        if (leader_ < 0) return counts;
+        uint64_t buffer[1 + PerfCounts::kEvents] = {};
+        if (::read(leader_, buffer, sizeof(buffer)) <= 0) return counts;
+        for (size_t m = 0; m < members_ && m < buffer[0]; ++m) counts.values[order_[m]] = buffer[1 + m];
+#endif
+        return counts;
+    }
+
+private:
+    int fds_[PerfCounts::kEvents] = {-1, -1, -1, -1, -1};
+    size_t order_[PerfCounts::kEvents] = {}; // PerfCounts index of each group member, in read order
+    size_t members_ = 0;
+    int leader_ = -1;
+    std::string error_;
+};
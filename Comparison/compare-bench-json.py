@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""
+Compare benchmark results written with --json against a saved baseline.
+
+Usage:
+    python3 Comparison/compare-bench-json.py BASELINE CURRENT [--threshold PCT] [--all]
+
+  BASELINE, CURRENT  Two result files, or two directories whose same-named
+                     *.json files are compared (as saved by
+                     run-benchmarks.sh --save-baseline DIR)
+  --threshold PCT    Relative change that counts as a regression or an
+                     improvement (default: 5)
+  --all              List every metric, not only those that moved past the threshold
+
+Every numeric value is compared by its dotted path, e.g.
+categories.typo.latency_ms.p99. Throughput, IPC and scaling figures are better
+when higher; times, sizes and hardware counter rates are better when lower.
+Match and query counts are expected to be identical, so any change to them is
+reported as a result change, since it means the engines no longer agree with
+the baseline on what matched. Differences in run settings (iterations, threads,
+sample counts) are listed but do not fail the comparison.
+
+Exit status is 1 when there is at least one regression or result change, so
+the script can gate a CI job.
+"""
+
+import json
+import os
+import sys
+
+HIGHER_IS_BETTER = ("candidates_per_sec", "ipc", "speedup", "efficiency", "utilization")
+MUST_MATCH = ("matches", "queries", "candidates")
+SETTINGS = ("iterations", "threads", "count", "schema")
+
+
+def arg_value(flag, default):
+    if flag in sys.argv:
+        idx = sys.argv.index(flag)
+        if idx + 1 < len(sys.argv):
+            return sys.argv[idx + 1]
+        sys.exit(f"{flag} requires a value")
+    return default
+
+
+def flatten(value, prefix=""):
+    if isinstance(value, dict):
+        out = {}
+        for key, child in value.items():
+            out.update(flatten(child, f"{prefix}.{key}" if prefix else key))
+        return out
+    return {prefix: value}
+
+
+def classify(path, before, after, threshold):
+    """Returns 'changed', 'setting', 'regression', 'improvement', or None for no significant change."""
+    leaf = path.rsplit(".", 1)[-1]
+    if leaf in SETTINGS:
+        return "setting" if before != after else None
+    if leaf in MUST_MATCH or not isinstance(before, (int, float)) or not isinstance(after, (int, float)):
+        return "changed" if before != after else None
+    if before == after:
+        return None
+    if before == 0:
+        delta = float("inf")
+    else:
+        delta = (after - before) / abs(before) * 100
+    if abs(delta) < threshold:
+        return None
+    better = (delta > 0) == any(leaf.endswith(key) for key in HIGHER_IS_BETTER)
+    return "improvement" if better else "regression"
+
+
+def compare(name, baseline, current, threshold, show_all):
+    before = flatten(baseline)
+    after = flatten(current)
+    rows = []
+    counts = {"regression": 0, "improvement": 0, "changed": 0, "setting": 0}
+    for path in sorted(set(before) | set(after)):
+        if path not in before or path not in after:
+            rows.append((path, before.get(path, "-"), after.get(path, "-"), "", "only in one"))
+            continue
+        verdict = classify(path, before[path], after[path], threshold)
+        if verdict:
+            counts[verdict] += 1
+        if verdict or show_all:
+            b, a = before[path], after[path]
+            change = ""
+            if isinstance(b, (int, float)) and isinstance(a, (int, float)) and b != 0:
+                change = f"{(a - b) / abs(b) * 100:+.1f}%"
+            rows.append((path, b, a, change, verdict or ""))
+
+    print(f"=== {name} ===")
+    print("")
+    if rows:
+        width = max(len(r[0]) for r in rows)
+        print(f"{'Metric':<{width}} {'Baseline':>14} {'Current':>14} {'Change':>9}  Verdict")
+        print("-" * (width + 52))
+        for path, b, a, change, verdict in rows:
+            print(f"{path:<{width}} {fmt(b):>14} {fmt(a):>14} {change:>9}  {verdict}")
+    else:
+        print(f"No metric moved by {threshold:g}% or more.")
+    print("")
+    print(f"{counts['regression']} regressions, {counts['improvement']} improvements, "
+          f"{counts['changed']} result changes (threshold {threshold:g}%)")
+    print("")
+    return counts["regression"] + counts["changed"]
+
+
+def fmt(value):
+    if isinstance(value, float):
+        return f"{value:.4g}" if abs(value) < 1e6 else f"{value:.4e}"
+    return str(value)
+
+
+def load(path):
+    with open(path) as f:
+        return json.load(f)
+
+
+def main():
+    positional = []
+    skip = False
+    for arg in sys.argv[1:]:
+        if skip:
+            skip = False
+        elif arg == "--threshold":
+            skip = True
+        elif not arg.startswith("--"):
+            positional.append(arg)
+    if len(positional) != 2:
+        sys.exit(__doc__.strip())
+    baseline_path, current_path = positional
+    threshold = float(arg_value("--threshold", "5"))
+    show_all = "--all" in sys.argv
+
+    if os.path.isdir(baseline_path):
+        names = sorted(n for n in os.listdir(baseline_path) if n.endswith(".json"))
+        pairs = [(n, os.path.join(baseline_path, n), os.path.join(current_path, n)) for n in names]
+    else:
+        pairs = [(os.path.basename(current_path), baseline_path, current_path)]
+
+    failures = 0
+    compared = 0
+    for name, before, after in pairs:
+        if not os.path.exists(after):
+            print(f"=== {name} === (not in current results, skipped)")
+            print("")
+            continue
+        failures += compare(name, load(before), load(after), threshold, show_all)
+        compared += 1
+    if compared == 0:
+        sys.exit("No result files to compare")
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == "__main__":
+    main()
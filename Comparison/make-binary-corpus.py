@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""
+Convert the benchmark corpus and query set from TSV to the binary format read by
+every comparison harness and by the CorpusBenchmark suite.
+
+Usage:
+    python3 Comparison/make-binary-corpus.py                      # Resources/*.tsv -> Resources/*.fmbench
+    python3 Comparison/make-binary-corpus.py --tsv big.tsv --queries big-queries.tsv --out-dir /data
+
+  --tsv PATH      Instruments TSV with a header line: symbol<TAB>name<TAB>isin
+                  (default: Resources/instruments-export.tsv)
+  --queries PATH  Query TSV without a header: text<TAB>field<TAB>category
+                  (default: Resources/queries.tsv)
+  --out-dir DIR   Where to write instruments-export.fmbench and queries.fmbench
+                  (default: next to each input)
+
+The harnesses detect the format from the file contents, so a .fmbench file can be
+passed wherever a TSV is accepted (--tsv, --queries, or the quality tools' corpus
+argument).
+
+Format, version 1. All integers are little-endian.
+
+    offset 0   magic     8 bytes  b"FMBENCH\\0"
+    offset 8   version   u32      1
+    offset 12  kind      u32      1 = instruments (symbol, name, isin)
+                                  2 = queries (text, field, category)
+    offset 16  rows      u64
+    offset 24  columns   u32      3
+    offset 28  reserved  u32      0
+
+followed by each column in order:
+
+    u64        byte count of the column's text
+    u64 x (rows + 1)   offsets; row r is bytes [offsets[r], offsets[r + 1])
+    bytes      the UTF-8 text of every row, concatenated, zero-padded to a
+               multiple of 8 so the next column's offsets stay 8-byte aligned
+
+Rows are the TSV lines in file order. A line contributes a row when it has at
+least three tab-separated fields; its first three fields are the row's columns.
+Empty lines are skipped.
+"""
+
+import os
+import struct
+import sys
+
+MAGIC = b"FMBENCH\0"
+VERSION = 1
+KIND_INSTRUMENTS = 1
+KIND_QUERIES = 2
+COLUMN_COUNT = 3
+
+
+def read_rows(path, skip_header):
+    with open(path, "rb") as f:
+        lines = f.read().split(b"\n")
+    if skip_header:
+        lines = lines[1:]
+    rows = []
+    for line in lines:
+        if not line:
+            continue
+        fields = line.split(b"\t")
+        if len(fields) >= COLUMN_COUNT:
+            rows.append(fields[:COLUMN_COUNT])
+    return rows
+
+
+def write_table(path, kind, rows):
+    with open(path, "wb") as f:
+        f.write(MAGIC)
+        f.write(struct.pack("<IIQII", VERSION, kind, len(rows), COLUMN_COUNT, 0))
+        for column in range(COLUMN_COUNT):
+            values = [row[column] for row in rows]
+            offsets = [0]
+            for value in values:
+                offsets.append(offsets[-1] + len(value))
+            f.write(struct.pack("<Q", offsets[-1]))
+            f.write(struct.pack("<%dQ" % len(offsets), *offsets))
+            f.write(b"".join(values))
+            f.write(b"\0" * (-offsets[-1] % 8))
+
+
+def arg_value(flag, default):
+    if flag in sys.argv:
+        idx = sys.argv.index(flag)
+        if idx + 1 < len(sys.argv):
+            return sys.argv[idx + 1]
+        sys.exit(f"{flag} requires a value")
+    return default
+
+
+def output_path(input_path, out_dir):
+    base = os.path.splitext(os.path.basename(input_path))[0] + ".fmbench"
+    return os.path.join(out_dir if out_dir else os.path.dirname(os.path.abspath(input_path)), base)
+
+
+def main():
+    script_dir = os.path.dirname(os.path.abspath(__file__))
+    resources = os.path.join(os.path.dirname(script_dir), "Resources")
+    tsv_path = arg_value("--tsv", os.path.join(resources, "instruments-export.tsv"))
+    queries_path = arg_value("--queries", os.path.join(resources, "queries.tsv"))
+    out_dir = arg_value("--out-dir", None)
+    if out_dir:
+        os.makedirs(out_dir, exist_ok=True)
+
+    for input_path, kind, skip_header in [
+        (tsv_path, KIND_INSTRUMENTS, True),
+        (queries_path, KIND_QUERIES, False),
+    ]:
+        rows = read_rows(input_path, skip_header)
+        out_path = output_path(input_path, out_dir)
+        write_table(out_path, kind, rows)
+        print(f"Wrote {len(rows)} rows to {out_path} ({os.path.getsize(out_path)} bytes)")
+
+
+if __name__ == "__main__":
+    main()
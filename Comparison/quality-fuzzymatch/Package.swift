@@ -6,11 +6,13 @@ let package = Package(
     platforms: [.macOS(.v26)],
     dependencies: [
         .package(path: "../.."),
+        .package(path: "../BenchmarkCorpus"),
     ],
     targets: [
         .executableTarget(
             name: "quality-fuzzymatch",
             dependencies: [
+                .product(name: "BenchmarkCorpus", package: "BenchmarkCorpus"),
                 .product(name: "FuzzyMatch", package: "FuzzyMatch"),
             ],
             path: "Sources"
@@ -1,3 +1,4 @@
+import BenchmarkCorpus
 import Ifrit
 import Foundation
 
@@ -7,18 +8,11 @@ struct Instrument {
     let isin: String
 }
 
-// Load TSV
+// Load corpus (TSV or .fmbench)
 let tsvPath = CommandLine.arguments[1]
-let content = try! String(contentsOfFile: tsvPath, encoding: .utf8)
-let lines = content.split(separator: "\n", omittingEmptySubsequences: false)
-
-var instruments: [Instrument] = []
-for (i, line) in lines.enumerated() {
-    if i == 0 { continue } // skip header
-    let cols = line.split(separator: "\t", omittingEmptySubsequences: false)
-    if cols.count >= 3 {
-        instruments.append(Instrument(symbol: String(cols[0]), name: String(cols[1]), isin: String(cols[2])))
-    }
+let table = try! BenchmarkTable(contentsOf: tsvPath, kind: .instruments)
+let instruments = (0..<table.rowCount).map { row in
+    Instrument(symbol: table.columns[0][row], name: table.columns[1][row], isin: table.columns[2][row])
 }
 
 // Read queries from stdin
@@ -1,20 +1,17 @@
 #include <algorithm>
+#include <cerrno>
 #include <cstdio>
 #include <cstring>
-#include <fstream>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <rapidfuzz/fuzz.hpp>
 
-enum class Scorer { WRatio, PartialRatio };
+#include "mmap_corpus.hpp"
 
-struct Instrument {
-    std::string symbol;
-    std::string name;
-    std::string isin;
-};
+enum class Scorer { WRatio, PartialRatio };
 
 static std::string to_lower(const std::string& s) {
     std::string out;
@@ -24,8 +21,8 @@ static std::string to_lower(const std::string& s) {
 }
 
 template <typename ScorerT>
-static void score_query(ScorerT& scorer, const std::vector<std::string>& candidates,
-                        const std::vector<Instrument>& instruments,
+static void score_query(ScorerT& scorer, const std::vector<std::string_view>& candidates,
+                        const MmapCorpus& corpus,
                         const std::string& query, const std::string& field) {
     std::vector<std::pair<double, size_t>> results;
     for (size_t i = 0; i < candidates.size(); ++i) {
@@ -43,10 +40,12 @@ static void score_query(ScorerT& scorer, const std::vector<std::string>& candida
     size_t limit = std::min<size_t>(10, results.size());
     for (size_t rank = 0; rank < limit; ++rank) {
         auto& [score, idx] = results[rank];
-        auto& inst = instruments[idx];
-        std::printf("%s\t%s\t%zu\t%.4f\t%s\t%s\n",
+        std::string_view symbol = corpus.symbol[idx];
+        std::string_view name = corpus.name[idx];
+        std::printf("%s\t%s\t%zu\t%.4f\t%.*s\t%.*s\n",
                     query.c_str(), field.c_str(), rank + 1, score,
-                    inst.symbol.c_str(), inst.name.c_str());
+                    static_cast<int>(symbol.size()), symbol.data(),
+                    static_cast<int>(name.size()), name.data());
     }
 }
 
@@ -66,41 +65,15 @@ int main(int argc, char* argv[]) {
         }
     }
 
-    // Load corpus
-    std::ifstream ifs(tsv_path);
-    if (!ifs) {
-        std::fprintf(stderr, "Error: cannot open %s\n", tsv_path.c_str());
+    // Load corpus: mmap'ed, lowercased once into a single arena, fields as string_views.
+    // Stats go to stderr; stdout carries only results.
+    MmapCorpus corpus;
+    if (!corpus.load(tsv_path)) {
+        std::fprintf(stderr, "Error: cannot load %s: %s\n", tsv_path.c_str(), std::strerror(errno));
         return 1;
     }
-
-    std::vector<Instrument> instruments;
-    instruments.reserve(269000);
-    std::string line;
-    bool first = true;
-    while (std::getline(ifs, line)) {
-        if (first) { first = false; continue; }
-        size_t t1 = line.find('\t');
-        if (t1 == std::string::npos) continue;
-        size_t t2 = line.find('\t', t1 + 1);
-        if (t2 == std::string::npos) continue;
-        instruments.push_back({
-            line.substr(0, t1),
-            line.substr(t1 + 1, t2 - t1 - 1),
-            line.substr(t2 + 1)
-        });
-    }
-    ifs.close();
-
-    // Pre-lowercase all candidates
-    std::vector<std::string> symbol_lc, name_lc, isin_lc;
-    symbol_lc.reserve(instruments.size());
-    name_lc.reserve(instruments.size());
-    isin_lc.reserve(instruments.size());
-    for (auto& inst : instruments) {
-        symbol_lc.push_back(to_lower(inst.symbol));
-        name_lc.push_back(to_lower(inst.name));
-        isin_lc.push_back(to_lower(inst.isin));
-    }
+    std::fprintf(stderr, "Loaded %zu instruments in %.1fms, peak RSS after load: %.1fMB\n",
+                 corpus.size(), corpus.load_ms(), static_cast<double>(peak_rss_bytes()) / 1e6);
 
     // Read queries from stdin: "query\tfield"
     std::string input_line;
@@ -113,18 +86,17 @@ int main(int argc, char* argv[]) {
 
         std::string q_lower = to_lower(query);
 
-        auto& candidates = (field == "symbol") ? symbol_lc
-                         : (field == "isin")   ? isin_lc
-                         :                       name_lc;
+        auto& candidates = corpus.lowercased(field);
 
         if (scorer_type == Scorer::PartialRatio) {
             rapidfuzz::fuzz::CachedPartialRatio<char> scorer(q_lower);
-            score_query(scorer, candidates, instruments, query, field);
+            score_query(scorer, candidates, corpus, query, field);
         } else {
             rapidfuzz::fuzz::CachedWRatio<char> scorer(q_lower);
-            score_query(scorer, candidates, instruments, query, field);
+            score_query(scorer, candidates, corpus, query, field);
         }
     }
 
+    std::fprintf(stderr, "Peak RSS: %.1fMB\n", static_cast<double>(peak_rss_bytes()) / 1e6);
     return 0;
 }
@@ -17,6 +17,12 @@ RUN_CONTAINS=false
 ANY_FLAG=false
 SKIP_BUILD=false
 ITERATIONS=""
+THREADS=""
+PERF_COUNTERS=false
+SAVE_BASELINE=""
+BASELINE=""
+THRESHOLD=5
+RESULTS_DIR=/tmp/bench-results-latest
 
 while [[ $# -gt 0 ]]; do
     case "$1" in
@@ -30,9 +36,16 @@ while [[ $# -gt 0 ]]; do
         --ifrit)   RUN_IFRIT=true; ANY_FLAG=true; shift ;;
         --contains) RUN_CONTAINS=true; ANY_FLAG=true; shift ;;
         --iterations) ITERATIONS="$2"; shift 2 ;;
+        --threads) THREADS="$2"; shift 2 ;;
+        --corpus)  TSV_PATH="$2"; shift 2 ;;
+        --queries) QUERIES_PATH="$2"; shift 2 ;;
         --skip-build) SKIP_BUILD=true; shift ;;
+        --perf-counters) PERF_COUNTERS=true; shift ;;
+        --save-baseline) SAVE_BASELINE="$2"; shift 2 ;;
+        --baseline) BASELINE="$2"; shift 2 ;;
+        --threshold) THRESHOLD="$2"; shift 2 ;;
         --help|-h)
-            echo "Usage: $0 [--fm] [--fm-ed] [--fm-sw] [--nucleo] [--rf] [--rf-wratio] [--rf-partial] [--ifrit] [--contains] [--iterations N] [--skip-build]"
+            echo "Usage: $0 [--fm] [--fm-ed] [--fm-sw] [--nucleo] [--rf] [--rf-wratio] [--rf-partial] [--ifrit] [--contains] [--iterations N] [--threads N] [--corpus PATH] [--queries PATH] [--skip-build] [--perf-counters] [--save-baseline DIR] [--baseline DIR] [--threshold PCT]"
             echo "  Default (no flags): runs FM(ED), FM(SW), nucleo, RapidFuzz. Ifrit and Contains are on-demand only."
             echo "  --fm           Run FuzzyMatch (both Edit Distance and Smith-Waterman)"
             echo "  --fm-ed        Run FuzzyMatch (Edit Distance only)"
@@ -44,7 +57,17 @@ while [[ $# -gt 0 ]]; do
             echo "  --ifrit        Run Ifrit (very slow, defaults to 1 iteration)"
             echo "  --contains     Run String.contains() baseline (very slow, defaults to 1 iteration)"
             echo "  --iterations N Override number of timed iterations (default: 5 FM/nucleo, 3 RapidFuzz, 1 Ifrit/Contains)"
+            echo "  --threads N    Shard candidates across N threads in the FuzzyMatch and RapidFuzz harnesses and"
+            echo "                 report speedup and parallel efficiency (default: 1; nucleo, Ifrit and Contains stay single-threaded)"
+            echo "  --corpus PATH  Instruments corpus, TSV or .fmbench (default: Resources/instruments-export.tsv)"
+            echo "  --queries PATH Query set, TSV or .fmbench (default: Resources/queries.tsv)"
+            echo "                 Convert with: python3 Comparison/make-binary-corpus.py"
             echo "  --skip-build   Skip building harnesses (assume pre-built)"
+            echo "  --perf-counters  Count cycles, instructions, L1D/LLC misses and branch misses per query category"
+            echo "                 in the RapidFuzz harness (Linux perf_event_open; reported as unavailable elsewhere)"
+            echo "  --save-baseline DIR  Copy this run's JSON results (FuzzyMatch, nucleo, RapidFuzz) to DIR"
+            echo "  --baseline DIR       Compare this run's JSON results against DIR; exits 1 on a regression"
+            echo "  --threshold PCT      Relative change that counts as a regression (default: 5)"
             exit 0 ;;
         *) echo "Unknown flag: $1"; exit 1 ;;
     esac
@@ -55,6 +78,20 @@ if [ -n "$ITERATIONS" ]; then
     ITER_ARGS="--iterations $ITERATIONS"
 fi
 
+THREAD_ARGS=""
+if [ -n "$THREADS" ]; then
+    THREAD_ARGS="--threads $THREADS"
+fi
+
+PERF_ARGS=""
+if $PERF_COUNTERS; then
+    PERF_ARGS="--perf-counters"
+fi
+
+# Every run of FuzzyMatch, nucleo and RapidFuzz also writes its results as JSON here
+rm -rf "$RESULTS_DIR"
+mkdir -p "$RESULTS_DIR"
+
 # Default: run FM, nucleo, RapidFuzz (Ifrit and Contains are on-demand — too slow)
 if [ "$ANY_FLAG" = false ]; then
     RUN_FM_ED=true
@@ -70,8 +107,12 @@ if [ ! -f "$TSV_PATH" ]; then
     exit 1
 fi
 
-CORPUS_SIZE=$(wc -l < "$TSV_PATH" | tr -d ' ')
-CORPUS_SIZE=$((CORPUS_SIZE - 1))  # subtract header
+if [ "$(head -c 7 "$TSV_PATH")" = "FMBENCH" ]; then
+    CORPUS_SIZE=$(od -An -t u8 -j 16 -N 8 "$TSV_PATH" | tr -d ' ')  # row count from the .fmbench header
+else
+    CORPUS_SIZE=$(wc -l < "$TSV_PATH" | tr -d ' ')
+    CORPUS_SIZE=$((CORPUS_SIZE - 1))  # subtract header
+fi
 
 ENABLED=""
 $RUN_FM_ED && ENABLED="$ENABLED FuzzyMatch(ED)"
@@ -88,6 +129,9 @@ echo "============================================"
 echo ""
 echo "Corpus: $TSV_PATH ($CORPUS_SIZE candidates)"
 echo "Running:$ENABLED"
+if [ -n "$THREADS" ]; then
+    echo "Threads: $THREADS (FuzzyMatch, RapidFuzz)"
+fi
 echo ""
 
 # --- Build selected ---
@@ -139,36 +183,36 @@ CONTAINS_OUTPUT=""
 
 if $RUN_NUCLEO; then
     echo "Running nucleo..."
-    NUCLEO_OUTPUT=$(cd "$SCRIPT_DIR/bench-nucleo" && cargo run --release -- --tsv "$TSV_PATH" --queries "$QUERIES_PATH" $ITER_ARGS 2>/dev/null)
-    echo "$NUCLEO_OUTPUT" | grep -E "^(Total time|Throughput|Per-query)"
+    NUCLEO_OUTPUT=$(cd "$SCRIPT_DIR/bench-nucleo" && cargo run --release -- --tsv "$TSV_PATH" --queries "$QUERIES_PATH" $ITER_ARGS --json "$RESULTS_DIR/nucleo.json" 2>/dev/null)
+    echo "$NUCLEO_OUTPUT" | grep -E "^(Total time|Throughput|Per-query|Latency)"
     echo ""
 fi
 
 if $RUN_RF_WR; then
     echo "Running RapidFuzz (WRatio)..."
-    RAPIDFUZZ_WR_OUTPUT=$(cd "$SCRIPT_DIR/bench-rapidfuzz" && ./bench-rapidfuzz --tsv "$TSV_PATH" --queries "$QUERIES_PATH" --scorer wratio $ITER_ARGS 2>/dev/null)
-    echo "$RAPIDFUZZ_WR_OUTPUT" | grep -E "^(Total time|Throughput|Per-query)"
+    RAPIDFUZZ_WR_OUTPUT=$(cd "$SCRIPT_DIR/bench-rapidfuzz" && ./bench-rapidfuzz --tsv "$TSV_PATH" --queries "$QUERIES_PATH" --scorer wratio $ITER_ARGS $THREAD_ARGS $PERF_ARGS --json "$RESULTS_DIR/rapidfuzz-wratio.json" 2>/dev/null)
+    echo "$RAPIDFUZZ_WR_OUTPUT" | grep -E "^(Load time|Total time|Throughput|Per-query|Peak RSS|Latency|Speedup)"
     echo ""
 fi
 
 if $RUN_RF_PR; then
     echo "Running RapidFuzz (PartialRatio)..."
-    RAPIDFUZZ_PR_OUTPUT=$(cd "$SCRIPT_DIR/bench-rapidfuzz" && ./bench-rapidfuzz --tsv "$TSV_PATH" --queries "$QUERIES_PATH" --scorer partial_ratio $ITER_ARGS 2>/dev/null)
-    echo "$RAPIDFUZZ_PR_OUTPUT" | grep -E "^(Total time|Throughput|Per-query)"
+    RAPIDFUZZ_PR_OUTPUT=$(cd "$SCRIPT_DIR/bench-rapidfuzz" && ./bench-rapidfuzz --tsv "$TSV_PATH" --queries "$QUERIES_PATH" --scorer partial_ratio $ITER_ARGS $THREAD_ARGS $PERF_ARGS --json "$RESULTS_DIR/rapidfuzz-partial.json" 2>/dev/null)
+    echo "$RAPIDFUZZ_PR_OUTPUT" | grep -E "^(Load time|Total time|Throughput|Per-query|Peak RSS|Latency|Speedup)"
     echo ""
 fi
 
 if $RUN_FM_ED; then
     echo "Running FuzzyMatch (Edit Distance)..."
-    FUZZYMATCH_OUTPUT=$(cd "$SCRIPT_DIR/bench-fuzzymatch" && swift run -c release bench-fuzzymatch --tsv "$TSV_PATH" --queries "$QUERIES_PATH" $ITER_ARGS 2>/dev/null)
-    echo "$FUZZYMATCH_OUTPUT" | grep -E "^(Total time|Throughput|Per-query)"
+    FUZZYMATCH_OUTPUT=$(cd "$SCRIPT_DIR/bench-fuzzymatch" && swift run -c release bench-fuzzymatch --tsv "$TSV_PATH" --queries "$QUERIES_PATH" $ITER_ARGS $THREAD_ARGS --json "$RESULTS_DIR/fuzzymatch-ed.json" 2>/dev/null)
+    echo "$FUZZYMATCH_OUTPUT" | grep -E "^(Load time|Total time|Throughput|Per-query|Peak RSS|Latency|Speedup)"
     echo ""
 fi
 
 if $RUN_FM_SW; then
     echo "Running FuzzyMatch (Smith-Waterman)..."
-    FUZZYMATCH_SW_OUTPUT=$(cd "$SCRIPT_DIR/bench-fuzzymatch" && swift run -c release bench-fuzzymatch --tsv "$TSV_PATH" --queries "$QUERIES_PATH" --sw $ITER_ARGS 2>/dev/null)
-    echo "$FUZZYMATCH_SW_OUTPUT" | grep -E "^(Total time|Throughput|Per-query)"
+    FUZZYMATCH_SW_OUTPUT=$(cd "$SCRIPT_DIR/bench-fuzzymatch" && swift run -c release bench-fuzzymatch --tsv "$TSV_PATH" --queries "$QUERIES_PATH" --sw $ITER_ARGS $THREAD_ARGS --json "$RESULTS_DIR/fuzzymatch-sw.json" 2>/dev/null)
+    echo "$FUZZYMATCH_SW_OUTPUT" | grep -E "^(Load time|Total time|Throughput|Per-query|Peak RSS|Latency|Speedup)"
     echo ""
 fi
 
@@ -264,8 +308,12 @@ BEGIN {
     }
 }
 
+# Only the category summary under "=== Results ===" is read; later sections
+# (latency distribution, hardware counters) also start their rows with a category
+/^=== / { section = $0 }
+
 # Category summary lines: "exact_symbol   20  278.55  277.36  10540"
-{
+section == "=== Results ===" {
     for (i = 1; i <= n_cats; i++) {
         if ($1 == cats[i] && NF >= 5) {
             if (FILENAME == "/tmp/bench-fuzzymatch-latest.txt") {
@@ -371,4 +419,25 @@ $RUN_RF_WR && echo "  /tmp/bench-rapidfuzz-wratio-latest.txt"
 $RUN_RF_PR && echo "  /tmp/bench-rapidfuzz-partial-latest.txt"
 $RUN_IFRIT && echo "  /tmp/bench-ifrit-latest.txt"
 $RUN_CONTAINS && echo "  /tmp/bench-contains-latest.txt"
+
+if [ -n "$(ls -A "$RESULTS_DIR")" ]; then
+    echo ""
+    echo "JSON results saved to: $RESULTS_DIR"
+fi
+
+if [ -n "$SAVE_BASELINE" ]; then
+    mkdir -p "$SAVE_BASELINE"
+    cp "$RESULTS_DIR"/*.json "$SAVE_BASELINE"/
+    echo "Baseline saved to: $SAVE_BASELINE"
+fi
+
+if [ -n "$BASELINE" ]; then
+    echo ""
+    echo "============================================"
+    echo " Comparison against baseline $BASELINE"
+    echo "============================================"
+    echo ""
+    python3 "$SCRIPT_DIR/compare-bench-json.py" "$BASELINE" "$RESULTS_DIR" --threshold "$THRESHOLD"
+    exit $?
+fi
 exit 0
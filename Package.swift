@@ -16,6 +16,12 @@ let package = Package(
             targets: ["FuzzyMatch"]
         )
     ],
+    traits: [
+        .trait(
+            name: "ScoringStatistics",
+            description: "Collect per-stage candidate counts and sampled timings in ScoringBuffer.statistics"
+        )
+    ],
     targets: [
         .target(
             name: "FuzzyMatch",
@@ -30,6 +30,8 @@
 ///
 /// - ``prefixEditDistance(query:candidate:state:maxEditDistance:)``
 /// - ``substringEditDistance(query:candidate:state:maxEditDistance:)``
+/// - ``prefixEditDistanceBitParallel(patternMasks:queryLength:candidate:maxEditDistance:)``
+/// - ``substringEditDistanceBitParallel(patternMasks:queryLength:candidate:maxEditDistance:)``
 /// - ``normalizedScore(editDistance:queryLength:kind:config:)``
 
 /// Computes the prefix edit distance (Damerau-Levenshtein) between query and the start of candidate.
@@ -269,6 +271,161 @@ internal func substringEditDistance(
     return bestDistance
 }
 
+// MARK: - Bit-Parallel Kernels
+
+/// Longest query handled by the bit-parallel kernels: one bit per query byte in a `UInt64`.
+@usableFromInline
+internal let bitParallelMaxQueryLength = 64
+
+/// Builds the pattern-match vectors for the bit-parallel kernels.
+///
+/// Entry `c` has bit `j` set when `query[j] == c`. Returns an empty array when the
+/// query is empty or longer than ``bitParallelMaxQueryLength``, in which case the
+/// row-by-row DP kernels must be used.
+///
+/// - Parameter query: The query bytes (lowercased UTF-8).
+/// - Returns: 256 bit vectors indexed by byte value, or `[]`.
+@inlinable
+internal func buildPatternMatchVectors(_ query: [UInt8]) -> [UInt64] {
+    guard !query.isEmpty && query.count <= bitParallelMaxQueryLength else { return [] }
+    var masks = [UInt64](repeating: 0, count: 256)
+    for (j, byte) in query.enumerated() {
+        masks[Int(byte)] |= 1 << UInt64(j)
+    }
+    return masks
+}
+
+/// Bit-parallel equivalent of ``prefixEditDistance(query:candidate:state:maxEditDistance:)``
+/// for queries of up to 64 bytes.
+///
+/// Returns exactly the same distance as the DP kernel, including the transposition
+/// rule (optimal string alignment) and the `queryLength + maxEditDistance` prefix limit.
+///
+/// - Parameters:
+///   - patternMasks: The query's vectors from ``buildPatternMatchVectors(_:)``.
+///   - queryLength: The query length in bytes (1...64).
+///   - candidate: The candidate bytes (lowercased UTF-8).
+///   - maxEditDistance: Returns `nil` if the distance exceeds this.
+/// - Returns: The minimum prefix edit distance, or `nil` if it exceeds `maxEditDistance`.
+///
+/// ## Algorithm
+///
+/// Hyyrö's bit-vector formulation of Damerau-Levenshtein (2003): each DP row is
+/// encoded as vertical +1/-1 delta vectors `VP`/`VN` over the query positions,
+/// and one candidate byte advances the whole row with a handful of word operations.
+/// The transposition vector `TR` marks positions where a swap with the previous
+/// candidate byte closes a diagonal. Only the last-column value `D[i][m]` is tracked,
+/// through the horizontal deltas at bit `m - 1`.
+///
+/// Prefix matching fixes `D[i][0] = i`, which enters as a +1 horizontal delta at the
+/// top of every row (`HP << 1 | 1`).
+///
+/// ## Complexity
+///
+/// - Time: O(min(candidateLength, queryLength + maxEditDistance)) word operations
+/// - Space: O(1)
+@inlinable
+internal func prefixEditDistanceBitParallel(
+    patternMasks: Span<UInt64>,
+    queryLength: Int,
+    candidate: Span<UInt8>,
+    maxEditDistance: Int
+) -> Int? {
+    let lastBit: UInt64 = 1 << UInt64(queryLength - 1)
+    var vp: UInt64 = ~0
+    var vn: UInt64 = 0
+    var d0: UInt64 = 0
+    var previousMatches: UInt64 = 0
+    var distance = queryLength
+    var bestDistance = queryLength  // D[0][m]: all insertions
+
+    let prefixLimit = min(candidate.count, queryLength + maxEditDistance)
+    for i in 0..<prefixLimit {
+        let matches = patternMasks[Int(candidate[i])]
+        let transpositions = ((~d0 & matches) &<< 1) & previousMatches
+        d0 = (((matches & vp) &+ vp) ^ vp) | matches | vn | transpositions
+        var hp = vn | ~(d0 | vp)
+        var hn = d0 & vp
+        if hp & lastBit != 0 { distance &+= 1 }
+        if hn & lastBit != 0 { distance &-= 1 }
+        hp = (hp &<< 1) | 1
+        hn = hn &<< 1
+        vp = hn | ~(d0 | hp)
+        vn = hp & d0
+        previousMatches = matches
+
+        if distance < bestDistance {
+            bestDistance = distance
+            if bestDistance == 0 {
+                return 0
+            }
+        }
+    }
+
+    return bestDistance > maxEditDistance ? nil : bestDistance
+}
+
+/// Bit-parallel equivalent of ``substringEditDistance(query:candidate:state:maxEditDistance:)``
+/// for queries of up to 64 bytes.
+///
+/// Same kernel as ``prefixEditDistanceBitParallel(patternMasks:queryLength:candidate:maxEditDistance:)``
+/// with a free start: `D[i][0] = 0`, so no horizontal delta enters at the top of a
+/// row (`HP << 1`), and every candidate position is scanned.
+///
+/// - Parameters:
+///   - patternMasks: The query's vectors from ``buildPatternMatchVectors(_:)``.
+///   - queryLength: The query length in bytes (1...64).
+///   - candidate: The candidate bytes (lowercased UTF-8).
+///   - maxEditDistance: Returns `nil` if the distance exceeds this.
+/// - Returns: The minimum substring edit distance, or `nil` if no good match found.
+///
+/// ## Complexity
+///
+/// - Time: O(candidateLength) word operations
+/// - Space: O(1)
+@inlinable
+internal func substringEditDistanceBitParallel(
+    patternMasks: Span<UInt64>,
+    queryLength: Int,
+    candidate: Span<UInt8>,
+    maxEditDistance: Int
+) -> Int? {
+    guard candidate.count > 0 else { return nil }
+
+    let lastBit: UInt64 = 1 << UInt64(queryLength - 1)
+    var vp: UInt64 = ~0
+    var vn: UInt64 = 0
+    var d0: UInt64 = 0
+    var previousMatches: UInt64 = 0
+    var distance = queryLength
+    var bestDistance = Int.max
+
+    for i in 0..<candidate.count {
+        let matches = patternMasks[Int(candidate[i])]
+        let transpositions = ((~d0 & matches) &<< 1) & previousMatches
+        d0 = (((matches & vp) &+ vp) ^ vp) | matches | vn | transpositions
+        var hp = vn | ~(d0 | vp)
+        var hn = d0 & vp
+        if hp & lastBit != 0 { distance &+= 1 }
+        if hn & lastBit != 0 { distance &-= 1 }
+        hp = hp &<< 1
+        hn = hn &<< 1
+        vp = hn | ~(d0 | hp)
+        vn = hp & d0
+        previousMatches = matches
+
+        if distance < bestDistance {
+            bestDistance = distance
+            // Early exit on exact substring match — no need to scan remaining candidate
+            if bestDistance == 0 {
+                return 0
+            }
+        }
+    }
+
+    return bestDistance > maxEditDistance ? nil : bestDistance
+}
+
 /// Computes a normalized score from edit distance.
 ///
 /// Converts the raw edit distance into a score between 0.0 and 1.0, applying
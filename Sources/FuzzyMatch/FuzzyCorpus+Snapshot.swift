@@ -0,0 +1,354 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#endif
+
+// MARK: - Snapshot Format
+
+/// Binary snapshot of a ``FuzzyCorpus``.
+///
+/// ## Layout
+///
+/// A 32-byte header followed by the corpus columns in a fixed order. Each column is
+/// its element count as a `UInt64`, then the raw element bytes, zero-padded to a
+/// multiple of 8 bytes.
+///
+/// | Offset | Field |
+/// |--------|-------|
+/// | 0 | Magic `FZMCORP\0` |
+/// | 8 | Format version (`UInt32`) |
+/// | 12 | Byte-order mark `0x01020304` (`UInt32`) |
+/// | 16 | `MemoryLayout<Int>.size` of the writer (`UInt32`) |
+/// | 20 | Flags (`UInt32`); bit 0 is set when a trigram index follows |
+/// | 24 | Candidate count (`UInt64`) |
+///
+/// Integers are stored in the writer's native byte order and word size, so
+/// columns load with a single copy. A snapshot loads only on hosts with the same
+/// layout. Every supported platform is 64-bit little-endian.
+internal enum CorpusSnapshot {
+    /// `FZMCORP\0`.
+    static let magic: [UInt8] = [0x46, 0x5A, 0x4D, 0x43, 0x4F, 0x52, 0x50, 0x00]
+
+    /// Bumped whenever the column set or encoding changes.
+    static let version: UInt32 = 2
+
+    static let byteOrderMark: UInt32 = 0x0102_0304
+
+    static let hasTrigramIndexFlag: UInt32 = 1
+}
+
+extension FuzzyCorpus {
+    /// Errors thrown when reading or writing a corpus snapshot.
+    public enum SnapshotError: Error, Equatable, Sendable {
+        /// The data does not start with the snapshot magic bytes.
+        case notASnapshot
+        /// The snapshot uses a format version this library cannot read.
+        case unsupportedVersion(UInt32)
+        /// The snapshot was written on a host with a different byte order or word size.
+        case incompatibleLayout
+        /// The data ends before the snapshot does.
+        case truncated
+        /// The snapshot columns are inconsistent with each other.
+        case corrupted
+        /// A file operation failed with the given `errno`.
+        case fileError(Int32)
+    }
+
+    // MARK: - Writing
+
+    /// Encodes the corpus, including its trigram index if it has one, as a binary snapshot.
+    ///
+    /// Loading the snapshot with one of the `init(snapshot:)` initializers skips
+    /// lowercasing, bitmask, boundary mask and trigram index construction, which
+    /// dominate ``init(_:buildTrigramIndex:)`` on large corpora.
+    ///
+    /// - Returns: The snapshot bytes.
+    public func snapshot() -> [UInt8] {
+        var writer = SnapshotWriter()
+        writer.bytes.append(contentsOf: CorpusSnapshot.magic)
+        writer.append(CorpusSnapshot.version)
+        writer.append(CorpusSnapshot.byteOrderMark)
+        writer.append(UInt32(MemoryLayout<Int>.size))
+        writer.append(trigramIndex != nil ? CorpusSnapshot.hasTrigramIndexFlag : 0)
+        writer.append(UInt64(count))
+
+        writer.append(column: utf8)
+        writer.append(column: utf8Offsets)
+        writer.append(column: lowercased)
+        writer.append(column: lowercasedOffsets)
+        writer.append(column: charBitmasks)
+        writer.append(column: isASCII.map { $0 ? UInt8(1) : 0 })
+        writer.append(column: lengths)
+        writer.append(column: boundaryMasks)
+        writer.append(column: wordInitials)
+        writer.append(column: wordInitialOffsets)
+        writer.append(column: lengthOrder)
+        writer.append(column: lengthOrderedCharBitmasks)
+        writer.append(column: bucketLengths)
+        writer.append(column: bucketStarts)
+
+        if let trigramIndex {
+            var slotHashes = [UInt32](repeating: 0, count: trigramIndex.slots.count)
+            for (hash, slot) in trigramIndex.slots {
+                slotHashes[slot] = hash
+            }
+            writer.append(column: slotHashes)
+            writer.append(column: trigramIndex.postingOffsets)
+            writer.append(column: trigramIndex.postingIDs)
+            writer.append(column: trigramIndex.postingCounts)
+            writer.append(column: trigramIndex.unindexed)
+        }
+        return writer.bytes
+    }
+
+    // MARK: - Loading
+
+    /// Loads a corpus from snapshot bytes produced by ``snapshot()``.
+    ///
+    /// - Parameter snapshot: The snapshot bytes.
+    /// - Throws: ``SnapshotError`` if the bytes are not a valid snapshot.
+    public init(snapshot: [UInt8]) throws(SnapshotError) {
+        let result = snapshot.withUnsafeBytes { bytes in
+            Result { () throws(SnapshotError) in try FuzzyCorpus(snapshot: bytes) }
+        }
+        self = try result.get()
+    }
+
+    /// Loads a corpus from snapshot bytes in memory, such as a memory-mapped file.
+    ///
+    /// Each column is copied out of `snapshot` with one bulk copy, so loading
+    /// allocates one array per column and none per candidate. The trigram hash
+    /// table is rebuilt from its key column. `snapshot` isn't referenced after
+    /// the initializer returns.
+    ///
+    /// The column tables are checked for consistency (counts, offset tables, index
+    /// ranges), so a damaged snapshot throws instead of producing a corpus that
+    /// traps when searched. Candidate bytes and the precomputed values derived from
+    /// them are not re-verified.
+    ///
+    /// - Parameter snapshot: The snapshot bytes.
+    /// - Throws: ``SnapshotError`` if the bytes are not a valid snapshot.
+    public init(snapshot: UnsafeRawBufferPointer) throws(SnapshotError) {
+        var reader = SnapshotReader(bytes: snapshot)
+
+        for byte in CorpusSnapshot.magic {
+            guard try reader.read(UInt8.self) == byte else { throw .notASnapshot }
+        }
+        let version = try reader.read(UInt32.self)
+        guard version == CorpusSnapshot.version else { throw .unsupportedVersion(version) }
+        guard try reader.read(UInt32.self) == CorpusSnapshot.byteOrderMark,
+            try reader.read(UInt32.self) == UInt32(MemoryLayout<Int>.size) else {
+            throw .incompatibleLayout
+        }
+        let flags = try reader.read(UInt32.self)
+        let candidateCount64 = try reader.read(UInt64.self)
+        guard candidateCount64 <= UInt64(UInt32.max) else { throw .corrupted }
+        let candidateCount = Int(candidateCount64)
+
+        let utf8 = try reader.readColumn(of: UInt8.self)
+        let utf8Offsets = try reader.readColumn(of: Int.self, count: candidateCount + 1)
+        let lowercased = try reader.readColumn(of: UInt8.self)
+        let lowercasedOffsets = try reader.readColumn(of: Int.self, count: candidateCount + 1)
+        let charBitmasks = try reader.readColumn(of: UInt64.self, count: candidateCount)
+        let isASCII = try reader.readColumn(of: UInt8.self, count: candidateCount).map { $0 != 0 }
+        let lengths = try reader.readColumn(of: UInt32.self, count: candidateCount)
+        let boundaryMasks = try reader.readColumn(of: UInt64.self, count: candidateCount)
+        let wordInitials = try reader.readColumn(of: UInt8.self)
+        let wordInitialOffsets = try reader.readColumn(of: Int.self, count: candidateCount + 1)
+        let lengthOrder = try reader.readColumn(of: UInt32.self, count: candidateCount)
+        let lengthOrderedCharBitmasks = try reader.readColumn(of: UInt64.self, count: candidateCount)
+        let bucketLengths = try reader.readColumn(of: UInt32.self)
+        let bucketStarts = try reader.readColumn(of: Int.self, count: bucketLengths.count + 1)
+
+        guard isValidOffsetTable(utf8Offsets, end: utf8.count),
+            isValidOffsetTable(lowercasedOffsets, end: lowercased.count),
+            isValidOffsetTable(wordInitialOffsets, end: wordInitials.count),
+            isValidOffsetTable(bucketStarts, end: candidateCount),
+            lengthOrder.allSatisfy({ Int($0) < candidateCount }),
+            (0..<candidateCount).allSatisfy({ Int(lengths[$0]) == utf8Offsets[$0 + 1] - utf8Offsets[$0] }) else {
+            throw .corrupted
+        }
+
+        var trigramIndex: TrigramIndex?
+        if flags & CorpusSnapshot.hasTrigramIndexFlag != 0 {
+            let slotHashes = try reader.readColumn(of: UInt32.self)
+            let postingOffsets = try reader.readColumn(of: Int.self, count: slotHashes.count + 1)
+            let postingIDs = try reader.readColumn(of: UInt32.self)
+            let postingCounts = try reader.readColumn(of: UInt16.self, count: postingIDs.count)
+            let unindexed = try reader.readColumn(of: UInt32.self)
+
+            guard isValidOffsetTable(postingOffsets, end: postingIDs.count),
+                postingIDs.allSatisfy({ Int($0) < candidateCount }),
+                unindexed.allSatisfy({ Int($0) < candidateCount }) else {
+                throw .corrupted
+            }
+            var slots: [UInt32: Int] = [:]
+            slots.reserveCapacity(slotHashes.count)
+            for (slot, hash) in slotHashes.enumerated() {
+                guard slots.updateValue(slot, forKey: hash) == nil else { throw .corrupted }
+            }
+            trigramIndex = TrigramIndex(
+                slots: slots,
+                postingOffsets: postingOffsets,
+                postingIDs: postingIDs,
+                postingCounts: postingCounts,
+                unindexed: unindexed,
+                candidateCount: candidateCount
+            )
+        }
+
+        self.generation = Self.nextGeneration()
+        self.utf8 = utf8
+        self.utf8Offsets = utf8Offsets
+        self.lowercased = lowercased
+        self.lowercasedOffsets = lowercasedOffsets
+        self.charBitmasks = charBitmasks
+        self.isASCII = isASCII
+        self.lengths = lengths
+        self.boundaryMasks = boundaryMasks
+        self.wordInitials = wordInitials
+        self.wordInitialOffsets = wordInitialOffsets
+        self.lengthOrder = lengthOrder
+        self.lengthOrderedCharBitmasks = lengthOrderedCharBitmasks
+        self.bucketLengths = bucketLengths
+        self.bucketStarts = bucketStarts
+        self.trigramIndex = trigramIndex
+    }
+}
+
+// MARK: - Snapshot Files
+
+#if canImport(Darwin) || canImport(Glibc) || canImport(Musl)
+extension FuzzyCorpus {
+    /// Loads a corpus from a snapshot file written by ``writeSnapshot(to:)``.
+    ///
+    /// The file is mapped read-only and its columns are copied out of the mapping
+    /// as by `init(snapshot:)`. The mapping is released before the initializer
+    /// returns.
+    ///
+    /// - Parameter path: Path of the snapshot file.
+    /// - Throws: ``SnapshotError`` if the file can't be read or isn't a valid snapshot.
+    public init(contentsOfSnapshot path: String) throws(SnapshotError) {
+        let descriptor = open(path, O_RDONLY)
+        guard descriptor >= 0 else { throw .fileError(errno) }
+        defer { close(descriptor) }
+
+        var info = stat()
+        guard fstat(descriptor, &info) == 0 else { throw .fileError(errno) }
+        let size = Int(info.st_size)
+        guard size > 0 else { throw .truncated }
+
+        let mapping = mmap(nil, size, PROT_READ, MAP_PRIVATE, descriptor, 0)
+        guard let mapping, mapping != UnsafeMutableRawPointer(bitPattern: -1) else {
+            throw .fileError(errno)
+        }
+        defer { munmap(mapping, size) }
+
+        try self.init(snapshot: UnsafeRawBufferPointer(start: mapping, count: size))
+    }
+
+    /// Writes ``snapshot()`` to a file, replacing any existing file at `path`.
+    ///
+    /// - Parameter path: Path of the snapshot file.
+    /// - Throws: ``SnapshotError/fileError(_:)`` if the file can't be written.
+    public func writeSnapshot(to path: String) throws(SnapshotError) {
+        let bytes = snapshot()
+        let descriptor = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0o644)
+        guard descriptor >= 0 else { throw .fileError(errno) }
+        defer { close(descriptor) }
+
+        var written = 0
+        while written < bytes.count {
+            let result = bytes.withUnsafeBytes { buffer in
+                write(descriptor, buffer.baseAddress! + written, buffer.count - written)
+            }
+            if result < 0 {
+                if errno == EINTR { continue }
+                throw .fileError(errno)
+            }
+            written += result
+        }
+    }
+}
+#endif
+
+// MARK: - Column Coding
+
+/// Appends header fields and padded columns to a snapshot.
+internal struct SnapshotWriter {
+    var bytes: [UInt8] = []
+
+    mutating func append<T: FixedWidthInteger>(_ value: T) {
+        withUnsafeBytes(of: value) { bytes.append(contentsOf: $0) }
+    }
+
+    mutating func append<T: BitwiseCopyable>(column: [T]) {
+        append(UInt64(column.count))
+        column.withUnsafeBytes { bytes.append(contentsOf: $0) }
+        while bytes.count % 8 != 0 {
+            bytes.append(0)
+        }
+    }
+}
+
+/// Reads header fields and padded columns from a snapshot, throwing on truncation.
+internal struct SnapshotReader {
+    let bytes: UnsafeRawBufferPointer
+    var offset = 0
+
+    mutating func read<T: FixedWidthInteger>(_: T.Type) throws(FuzzyCorpus.SnapshotError) -> T {
+        let size = MemoryLayout<T>.size
+        guard bytes.count - offset >= size else { throw .truncated }
+        let value = bytes.loadUnaligned(fromByteOffset: offset, as: T.self)
+        offset += size
+        return value
+    }
+
+    /// Reads one column, checking its element count against `expectedCount` if given.
+    mutating func readColumn<T: BitwiseCopyable>(
+        of _: T.Type,
+        count expectedCount: Int? = nil
+    ) throws(FuzzyCorpus.SnapshotError) -> [T] {
+        let stride = MemoryLayout<T>.stride
+        let count64 = try read(UInt64.self)
+        guard count64 <= UInt64(bytes.count / stride) else { throw .truncated }
+        let count = Int(count64)
+        if let expectedCount, count != expectedCount { throw .corrupted }
+
+        let byteCount = count * stride
+        let paddedByteCount = (byteCount + 7) & ~7
+        guard bytes.count - offset >= paddedByteCount else { throw .truncated }
+        let source = UnsafeRawBufferPointer(rebasing: bytes[offset..<(offset + byteCount)])
+        let column = [T](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+            UnsafeMutableRawBufferPointer(buffer).copyMemory(from: source)
+            initializedCount = count
+        }
+        offset += paddedByteCount
+        return column
+    }
+}
+
+/// Whether `offsets` starts at `0`, never decreases, and ends at `end`.
+private func isValidOffsetTable(_ offsets: [Int], end: Int) -> Bool {
+    guard offsets.first == 0, offsets.last == end else { return false }
+    for i in 1..<offsets.count where offsets[i] < offsets[i - 1] {
+        return false
+    }
+    return true
+}
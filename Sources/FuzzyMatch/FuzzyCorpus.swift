@@ -0,0 +1,525 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+import Synchronization
+
+/// Source of ``FuzzyCorpus/generation`` values.
+private let corpusGenerations = Atomic<UInt64>(0)
+
+/// A prebuilt, immutable collection of candidates with per-candidate matching data
+/// computed once up front.
+///
+/// ## Overview
+///
+/// ``FuzzyMatcher/score(_:against:buffer:)`` recomputes the character bitmask,
+/// ASCII flag, lowercased bytes and word-boundary mask of a candidate on every call.
+/// When the same candidates are searched over and over (a symbol list, a file index),
+/// that work is identical for every query. `FuzzyCorpus` does it once at build time
+/// and stores the results in a struct-of-arrays layout:
+///
+/// - **UTF-8 bytes**: The original candidate bytes, concatenated into one arena
+/// - **Lowercased bytes**: The lowercased candidate bytes, concatenated into a second arena
+/// - **Character bitmask**: The case-insensitive presence bitmask used by the prefilter
+/// - **ASCII flag**: Whether the candidate is pure ASCII
+/// - **Length**: The original UTF-8 length used by the length-bounds prefilter
+/// - **Boundary mask**: Word-boundary bits at lowercased positions (first 64 bytes)
+///
+/// The prefilter columns are scanned sequentially without touching candidate bytes,
+/// and only candidates that survive the prefilters are read from the arenas.
+///
+/// ### Length Buckets
+///
+/// The bitmask column is also stored a second time, grouped into buckets of equal
+/// UTF-8 length in ascending order. A query that requires a minimum candidate length
+/// finds its first bucket with a binary search and sweeps only the buckets from there
+/// on, so short candidates that can never match are not read at all. When every
+/// bucket is in range (for example a column of fixed-width identifiers) the plain
+/// sweep runs instead.
+///
+/// ### Trigram Index
+///
+/// Pass `buildTrigramIndex: true` to also build an inverted index from trigrams to
+/// candidates. Edit distance queries with enough trigrams for the trigram prefilter
+/// to be selective (typically longer, multi-character queries) then read their
+/// candidates from the posting lists instead of sweeping every row. The index costs
+/// build time and memory roughly proportional to the total candidate length, so it
+/// pays off for large corpora searched with long queries.
+///
+/// None of the stored data depends on ``MatchConfig``, so one corpus can be searched
+/// by any number of matchers and queries.
+///
+/// ## Example
+///
+/// ```swift
+/// let corpus = FuzzyCorpus(["getUserById", "setUser", "fetchData", "userService"])
+/// let matcher = FuzzyMatcher()
+///
+/// for text in ["user", "fetch", "srvc"] {
+///     let results = matcher.topMatches(corpus, against: matcher.prepare(text), limit: 3)
+///     // ...
+/// }
+/// ```
+///
+/// ## Thread Safety
+///
+/// `FuzzyCorpus` is immutable and `Sendable`. Multiple threads can search the same
+/// corpus simultaneously, each with its own ``ScoringBuffer``.
+public struct FuzzyCorpus: Sendable {
+    /// Identifies this corpus's contents within the process.
+    ///
+    /// Every corpus that is built or loaded gets a new, larger generation; copies of
+    /// a corpus share it. ``FuzzyResultCache`` keys its entries on it, so results
+    /// cached for one corpus are never returned for another.
+    public let generation: UInt64
+    /// Original UTF-8 bytes of all candidates, concatenated.
+    @usableFromInline let utf8: [UInt8]
+
+    /// Start offset of each candidate in ``utf8``, plus a trailing end offset.
+    @usableFromInline let utf8Offsets: [Int]
+
+    /// Lowercased UTF-8 bytes of all candidates, concatenated.
+    ///
+    /// Produced by the same lowercasing (and combining-mark stripping) used on the
+    /// per-call scoring path, so lengths may differ from ``utf8``.
+    @usableFromInline let lowercased: [UInt8]
+
+    /// Start offset of each candidate in ``lowercased``, plus a trailing end offset.
+    @usableFromInline let lowercasedOffsets: [Int]
+
+    /// Case-insensitive character bitmask of each candidate.
+    @usableFromInline let charBitmasks: [UInt64]
+
+    /// Whether each candidate is pure ASCII.
+    @usableFromInline let isASCII: [Bool]
+
+    /// Original UTF-8 length of each candidate.
+    @usableFromInline let lengths: [UInt32]
+
+    /// Word-boundary mask of each candidate, at lowercased byte positions.
+    @usableFromInline let boundaryMasks: [UInt64]
+
+    /// Lowercased word-initial bytes of all candidates, concatenated, for acronym
+    /// matching (see ``collectWordInitials(_:boundaryMask:into:)``).
+    @usableFromInline let wordInitials: [UInt8]
+
+    /// Start offset of each candidate in ``wordInitials``, plus a trailing end offset.
+    @usableFromInline let wordInitialOffsets: [Int]
+
+    /// Candidate indices sorted by ``lengths``, ascending; equal lengths keep corpus order.
+    @usableFromInline let lengthOrder: [UInt32]
+
+    /// ``charBitmasks`` permuted into ``lengthOrder``, so each length bucket is contiguous.
+    @usableFromInline let lengthOrderedCharBitmasks: [UInt64]
+
+    /// Distinct candidate lengths, ascending. Bucket `b` holds the candidates of length
+    /// `bucketLengths[b]`.
+    @usableFromInline let bucketLengths: [UInt32]
+
+    /// Start position of each bucket in ``lengthOrder``, plus a trailing end position.
+    @usableFromInline let bucketStarts: [Int]
+
+    /// Optional trigram inverted index over ``lowercased``.
+    @usableFromInline let trigramIndex: TrigramIndex?
+
+    /// Builds a corpus from a sequence of candidate strings.
+    ///
+    /// Candidates keep their order; the candidate at position `i` of the sequence
+    /// is available as `corpus[i]`.
+    ///
+    /// - Parameters:
+    ///   - candidates: The candidate strings to index.
+    ///   - buildTrigramIndex: Whether to build a trigram inverted index for candidate
+    ///     pre-selection. Default is `false`.
+    public init(_ candidates: some Sequence<String>, buildTrigramIndex: Bool = false) {
+        var utf8: [UInt8] = []
+        var offsets: [Int] = [0]
+        offsets.reserveCapacity(candidates.underestimatedCount + 1)
+        for candidate in candidates {
+            utf8.append(contentsOf: candidate.utf8)
+            offsets.append(utf8.count)
+        }
+        self.init(utf8: utf8, offsets: offsets, buildTrigramIndex: buildTrigramIndex)
+    }
+
+    /// Builds a corpus from candidates stored back to back in one UTF-8 byte arena.
+    ///
+    /// Candidate `i` is `utf8[offsets[i]..<offsets[i + 1]]`. The arena becomes the
+    /// corpus's own UTF-8 storage without being copied, and no `String` is created
+    /// for any candidate, so candidates loaded from a file or a database column never
+    /// exist as one heap object each. Search results that identify candidates by
+    /// index, such as ``FuzzyMatcher/topMatchIndices(_:against:limit:)``, never
+    /// decode them either.
+    ///
+    /// The bytes should be valid UTF-8; ``subscript(_:)`` decodes candidates with
+    /// replacement of ill-formed sequences.
+    ///
+    /// - Parameters:
+    ///   - utf8: Concatenated UTF-8 bytes of all candidates.
+    ///   - offsets: Start offset of each candidate in `utf8`, plus a trailing end
+    ///     offset. Must start at `0`, never decrease and end at `utf8.count`.
+    ///   - buildTrigramIndex: Whether to build a trigram inverted index for candidate
+    ///     pre-selection. Default is `false`.
+    public init(utf8: [UInt8], offsets: [Int], buildTrigramIndex: Bool = false) {
+        precondition(offsets.first == 0 && offsets.last == utf8.count, "offsets must span the arena")
+        let count = offsets.count - 1
+        var lowercased: [UInt8] = []
+        var lowercasedOffsets: [Int] = [0]
+        var charBitmasks: [UInt64] = []
+        var isASCII: [Bool] = []
+        var lengths: [UInt32] = []
+        var boundaryMasks: [UInt64] = []
+        var wordInitials: [UInt8] = []
+        var wordInitialOffsets: [Int] = [0]
+
+        lowercased.reserveCapacity(utf8.count)
+        lowercasedOffsets.reserveCapacity(count + 1)
+        charBitmasks.reserveCapacity(count)
+        isASCII.reserveCapacity(count)
+        lengths.reserveCapacity(count)
+        boundaryMasks.reserveCapacity(count)
+        wordInitialOffsets.reserveCapacity(count + 1)
+
+        let arena = utf8.span
+        var scratch = [UInt8](repeating: 0, count: 128)
+        var initialsScratch = [UInt8](repeating: 0, count: 32)
+        for index in 0..<count {
+            precondition(offsets[index] <= offsets[index + 1], "offsets must not decrease")
+            let bytes = arena.extracting(offsets[index]..<offsets[index + 1])
+            let length = bytes.count
+            if scratch.count < length {
+                scratch = [UInt8](repeating: 0, count: length)
+            }
+
+            let (mask, candidateIsASCII) = computeCharBitmaskWithASCIICheck(bytes)
+            let lowercasedLength = lowercaseUTF8(from: bytes, into: &scratch, isASCII: candidateIsASCII)
+
+            lowercased.append(contentsOf: scratch[0..<lowercasedLength])
+            lowercasedOffsets.append(lowercased.count)
+            charBitmasks.append(mask)
+            isASCII.append(candidateIsASCII)
+            lengths.append(UInt32(length))
+            let boundaryMask = computeBoundaryMaskCompressed(originalBytes: bytes, isASCII: candidateIsASCII)
+            boundaryMasks.append(boundaryMask)
+
+            let initialCount = collectWordInitials(
+                scratch.span.extracting(0..<lowercasedLength),
+                boundaryMask: boundaryMask,
+                into: &initialsScratch
+            )
+            wordInitials.append(contentsOf: initialsScratch[0..<initialCount])
+            wordInitialOffsets.append(wordInitials.count)
+        }
+
+        self.init(
+            utf8: utf8,
+            utf8Offsets: offsets,
+            lowercased: lowercased,
+            lowercasedOffsets: lowercasedOffsets,
+            charBitmasks: charBitmasks,
+            isASCII: isASCII,
+            lengths: lengths,
+            boundaryMasks: boundaryMasks,
+            wordInitials: wordInitials,
+            wordInitialOffsets: wordInitialOffsets,
+            buildTrigramIndex: buildTrigramIndex
+        )
+    }
+
+    /// Builds a corpus from the rows `rows[k]` of `segments[k]`, in that order, copying
+    /// their precomputed columns instead of recomputing them from the candidate bytes.
+    ///
+    /// Used to merge the segments of a ``LiveCorpus``; only the length buckets and the
+    /// optional trigram index are rebuilt.
+    init(gathering segments: [(corpus: FuzzyCorpus, rows: [Int])], buildTrigramIndex: Bool) {
+        let count = segments.reduce(0) { $0 + $1.rows.count }
+        var utf8: [UInt8] = []
+        var utf8Offsets: [Int] = [0]
+        var lowercased: [UInt8] = []
+        var lowercasedOffsets: [Int] = [0]
+        var charBitmasks: [UInt64] = []
+        var isASCII: [Bool] = []
+        var lengths: [UInt32] = []
+        var boundaryMasks: [UInt64] = []
+        var wordInitials: [UInt8] = []
+        var wordInitialOffsets: [Int] = [0]
+
+        utf8Offsets.reserveCapacity(count + 1)
+        lowercasedOffsets.reserveCapacity(count + 1)
+        charBitmasks.reserveCapacity(count)
+        isASCII.reserveCapacity(count)
+        lengths.reserveCapacity(count)
+        boundaryMasks.reserveCapacity(count)
+        wordInitialOffsets.reserveCapacity(count + 1)
+
+        for (corpus, rows) in segments {
+            for row in rows {
+                utf8.append(contentsOf: corpus.utf8[corpus.utf8Range(at: row)])
+                utf8Offsets.append(utf8.count)
+                lowercased.append(contentsOf: corpus.lowercased[corpus.lowercasedRange(at: row)])
+                lowercasedOffsets.append(lowercased.count)
+                charBitmasks.append(corpus.charBitmasks[row])
+                isASCII.append(corpus.isASCII[row])
+                lengths.append(corpus.lengths[row])
+                boundaryMasks.append(corpus.boundaryMasks[row])
+                wordInitials.append(contentsOf: corpus.wordInitials[corpus.wordInitialsRange(at: row)])
+                wordInitialOffsets.append(wordInitials.count)
+            }
+        }
+
+        self.init(
+            utf8: utf8,
+            utf8Offsets: utf8Offsets,
+            lowercased: lowercased,
+            lowercasedOffsets: lowercasedOffsets,
+            charBitmasks: charBitmasks,
+            isASCII: isASCII,
+            lengths: lengths,
+            boundaryMasks: boundaryMasks,
+            wordInitials: wordInitials,
+            wordInitialOffsets: wordInitialOffsets,
+            buildTrigramIndex: buildTrigramIndex
+        )
+    }
+
+    /// Adopts per-candidate columns and derives the length buckets and the optional
+    /// trigram index from them.
+    private init(
+        utf8: [UInt8],
+        utf8Offsets: [Int],
+        lowercased: [UInt8],
+        lowercasedOffsets: [Int],
+        charBitmasks: [UInt64],
+        isASCII: [Bool],
+        lengths: [UInt32],
+        boundaryMasks: [UInt64],
+        wordInitials: [UInt8],
+        wordInitialOffsets: [Int],
+        buildTrigramIndex: Bool
+    ) {
+        self.generation = Self.nextGeneration()
+        self.utf8 = utf8
+        self.utf8Offsets = utf8Offsets
+        self.lowercased = lowercased
+        self.lowercasedOffsets = lowercasedOffsets
+        self.charBitmasks = charBitmasks
+        self.isASCII = isASCII
+        self.lengths = lengths
+        self.boundaryMasks = boundaryMasks
+        self.wordInitials = wordInitials
+        self.wordInitialOffsets = wordInitialOffsets
+
+        let lengthOrder = lengths.indices.sorted { lengths[$0] != lengths[$1] ? lengths[$0] < lengths[$1] : $0 < $1 }
+        var bucketLengths: [UInt32] = []
+        var bucketStarts: [Int] = []
+        for (position, index) in lengthOrder.enumerated() where bucketLengths.last != lengths[index] {
+            bucketLengths.append(lengths[index])
+            bucketStarts.append(position)
+        }
+        bucketStarts.append(lengthOrder.count)
+        self.lengthOrder = lengthOrder.map { UInt32(truncatingIfNeeded: $0) }
+        self.lengthOrderedCharBitmasks = lengthOrder.map { charBitmasks[$0] }
+        self.bucketLengths = bucketLengths
+        self.bucketStarts = bucketStarts
+
+        self.trigramIndex = buildTrigramIndex
+            ? TrigramIndex(lowercased: lowercased, offsets: lowercasedOffsets)
+            : nil
+    }
+
+    /// Returns a generation no corpus in this process has had yet.
+    static func nextGeneration() -> UInt64 {
+        corpusGenerations.add(1, ordering: .relaxed).newValue
+    }
+
+    /// Whether this corpus was built with a trigram inverted index.
+    public var hasTrigramIndex: Bool { trigramIndex != nil }
+
+    /// The byte range of the candidate at `index` in the original UTF-8 arena.
+    @inlinable
+    func utf8Range(at index: Int) -> Range<Int> {
+        utf8Offsets[index]..<utf8Offsets[index + 1]
+    }
+
+    /// The byte range of the candidate at `index` in the lowercased arena.
+    @inlinable
+    func lowercasedRange(at index: Int) -> Range<Int> {
+        lowercasedOffsets[index]..<lowercasedOffsets[index + 1]
+    }
+
+    /// The byte range of the candidate at `index` in ``wordInitials``.
+    @inlinable
+    func wordInitialsRange(at index: Int) -> Range<Int> {
+        wordInitialOffsets[index]..<wordInitialOffsets[index + 1]
+    }
+
+    /// The position in ``lengthOrder`` of the first candidate at least `minLength`
+    /// bytes long, or ``count`` if there is none.
+    @inlinable
+    func lengthOrderStart(minLength: Int) -> Int {
+        // Binary search for the first bucket that is long enough
+        var low = 0
+        var high = bucketLengths.count
+        while low < high {
+            let mid = (low + high) / 2
+            if Int(bucketLengths[mid]) < minLength {
+                low = mid + 1
+            } else {
+                high = mid
+            }
+        }
+        return bucketStarts[low]
+    }
+}
+
+// MARK: - Prefilter Sweep
+
+extension FuzzyCorpus {
+    /// Collects the indices of candidates that can pass the length and bitmask
+    /// prefilters of `query`, in ascending order.
+    ///
+    /// Mirrors the prefilters each scoring path applies, so every candidate that
+    /// ``FuzzyMatcher/score(_:at:against:buffer:)`` could match is included:
+    /// - Edit distance, 2+ byte queries: length bounds and bitmask with
+    ///   the query's bitmask tolerance
+    /// - Edit distance, 0–1 byte queries: no prefilter (every index survives)
+    /// - Smith-Waterman: bitmask with tolerance 0 (every index survives for an empty query)
+    ///
+    /// When the corpus has a trigram index and the edit distance trigram prefilter
+    /// applies to `query`, survivors are drawn from the posting lists (which already
+    /// enforce the trigram threshold) and then checked against length and bitmask.
+    ///
+    /// Otherwise, when at least an eighth of the corpus lies in length buckets too
+    /// short to pass, only the remaining buckets are swept. Each query character type
+    /// a candidate contains takes at least one byte, so besides the query's minimum
+    /// length a candidate needs as many bytes as it must share character types with
+    /// the query. That also lets Smith-Waterman queries skip short buckets.
+    @inlinable
+    func collectPrefilterSurvivors(for query: FuzzyQuery, into survivors: inout [UInt32]) {
+        switch prefilterSweep(for: query) {
+        case .allIndices:
+            collectAllIndices(into: &survivors)
+
+        case let .trigramIndex(trigramIndex, minSharedTrigrams, maxMissingCharacters, minCandidateLength):
+            trigramIndex.collectCandidates(sharingAtLeast: minSharedTrigrams, of: query.trigrams, into: &survivors)
+            retainPrefilterSurvivors(
+                &survivors,
+                queryMask: query.charBitmask,
+                maxMissingCharacters: maxMissingCharacters,
+                minCandidateLength: minCandidateLength
+            )
+
+        case let .columns(maxMissingCharacters, minCandidateLength):
+            let lengthFloor = max(minCandidateLength, query.charBitmask.nonzeroBitCount - maxMissingCharacters)
+            let firstPosition = lengthOrderStart(minLength: lengthFloor)
+            if firstPosition > 0 && firstPosition >= count / 8 {
+                sweepLengthOrderedPrefilters(
+                    charBitmasks: lengthOrderedCharBitmasks,
+                    order: lengthOrder,
+                    from: firstPosition,
+                    queryMask: query.charBitmask,
+                    maxMissingCharacters: maxMissingCharacters,
+                    into: &survivors
+                )
+                return
+            }
+
+            sweepPrefilters(
+                charBitmasks: charBitmasks,
+                lengths: lengths,
+                queryMask: query.charBitmask,
+                maxMissingCharacters: maxMissingCharacters,
+                minCandidateLength: minCandidateLength,
+                into: &survivors
+            )
+        }
+    }
+
+    /// How ``collectPrefilterSurvivors(for:into:)`` finds the survivors of a query.
+    @usableFromInline
+    enum PrefilterSweep {
+        /// The query is too short to prefilter; every index survives.
+        case allIndices
+        /// Draw candidates from the trigram index, then check length and bitmask.
+        case trigramIndex(TrigramIndex, minSharedTrigrams: Int, maxMissingCharacters: Int, minCandidateLength: Int)
+        /// Sweep the bitmask and length columns.
+        case columns(maxMissingCharacters: Int, minCandidateLength: Int)
+    }
+
+    /// Chooses how the survivors of `query` are found.
+    @inlinable
+    func prefilterSweep(for query: FuzzyQuery) -> PrefilterSweep {
+        let queryLength = query.lowercased.count
+        switch query.config.algorithm {
+        case .editDistance:
+            guard queryLength >= 2 else { return .allIndices }
+            let minSharedTrigrams = query.trigrams.count - 3 * query.effectiveMaxEditDistance
+            if let trigramIndex, queryLength >= 4, minSharedTrigrams > 0 {
+                return .trigramIndex(
+                    trigramIndex,
+                    minSharedTrigrams: minSharedTrigrams,
+                    maxMissingCharacters: query.bitmaskTolerance,
+                    minCandidateLength: query.minCandidateLength
+                )
+            }
+            return .columns(maxMissingCharacters: query.bitmaskTolerance, minCandidateLength: query.minCandidateLength)
+        case .smithWaterman:
+            guard queryLength >= 1 else { return .allIndices }
+            return .columns(maxMissingCharacters: 0, minCandidateLength: 0)
+        }
+    }
+
+    /// Keeps only the `survivors` that pass the length and bitmask prefilters.
+    @inlinable
+    func retainPrefilterSurvivors(
+        _ survivors: inout [UInt32],
+        queryMask: UInt64,
+        maxMissingCharacters: Int,
+        minCandidateLength: Int
+    ) {
+        survivors.removeAll { survivor in
+            let index = Int(survivor)
+            return Int(lengths[index]) < minCandidateLength
+                || !passesCharBitmask(
+                    queryMask: queryMask,
+                    candidateMask: charBitmasks[index],
+                    maxEditDistance: maxMissingCharacters
+                )
+        }
+    }
+
+    @inlinable
+    func collectAllIndices(into survivors: inout [UInt32]) {
+        survivors.removeAll(keepingCapacity: true)
+        survivors.reserveCapacity(count)
+        for index in 0..<count {
+            survivors.append(UInt32(truncatingIfNeeded: index))
+        }
+    }
+}
+
+// MARK: - RandomAccessCollection
+
+extension FuzzyCorpus: RandomAccessCollection {
+    /// The position of the first candidate. Always `0`.
+    public var startIndex: Int { 0 }
+
+    /// The position one past the last candidate.
+    public var endIndex: Int { lengths.count }
+
+    /// The candidate string at the given position.
+    ///
+    /// The string is decoded from the corpus arena on each access.
+    public subscript(position: Int) -> String {
+        String(decoding: utf8[utf8Range(at: position)], as: UTF8.self)
+    }
+}
@@ -0,0 +1,390 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+import Synchronization
+
+/// The matching lines of an asynchronous sequence of lines, in input order.
+///
+/// ## Overview
+///
+/// Created by ``FuzzyMatcher/matchStream(_:against:chunkSize:concurrency:)``. Lines
+/// are read from the base sequence in chunks of `chunkSize`. Each chunk is scored by
+/// its own task with its own ``ScoringBuffer``, and up to `concurrency` chunks are
+/// scored at once. Chunks are not pinned to workers: whichever executor thread
+/// is free picks up the next chunk task. A slow chunk therefore doesn't hold
+/// back chunks that other workers could score.
+///
+/// The first call to `next()` starts a reader task that pulls lines from the base
+/// sequence, while the iterator waits only for the oldest chunk. Results are
+/// delivered strictly in input order, chunk by chunk, and each chunk as soon as it
+/// and the chunks before it are scored, however long the base sequence takes to
+/// produce the next lines. Iteration applies backpressure. The reader pauses
+/// while `concurrency` chunks are scoring or waiting to be consumed, so at most
+/// `concurrency` chunks of lines are buffered however quickly the base sequence
+/// produces them.
+///
+/// A chunk is scored only once it is full, or when the base sequence ends. For
+/// slow, latency-sensitive streams such as a live log tail, choose a small
+/// `chunkSize`.
+///
+/// Iteration throws errors thrown by the base sequence, after the matches of the
+/// chunks read before the error, and throws `CancellationError` when the consuming
+/// task is cancelled. The reader and the chunks still in flight when the iterator
+/// is discarded are cancelled.
+///
+/// ## Example
+///
+/// ```swift
+/// let matcher = FuzzyMatcher()
+/// let query = matcher.prepare("timeout")
+/// for try await result in matcher.matchStream(logLines, against: query, concurrency: 8) {
+///     print(result.candidate)
+/// }
+/// ```
+public struct FuzzyMatchStream<Base: AsyncSequence & Sendable>: AsyncSequence where Base.Element == String {
+    public typealias Element = MatchResult
+
+    let base: Base
+    let matcher: FuzzyMatcher
+    let query: FuzzyQuery
+    let chunkSize: Int
+    let concurrency: Int
+
+    init(base: Base, matcher: FuzzyMatcher, query: FuzzyQuery, chunkSize: Int, concurrency: Int) {
+        self.base = base
+        self.matcher = matcher
+        self.query = query
+        self.chunkSize = max(1, chunkSize)
+        self.concurrency = max(1, concurrency)
+    }
+
+    /// Creates an iterator over the matching lines.
+    public func makeAsyncIterator() -> AsyncIterator {
+        AsyncIterator(
+            base: base,
+            matcher: matcher,
+            query: query,
+            chunkSize: chunkSize,
+            concurrency: concurrency
+        )
+    }
+
+    /// An iterator over the matching lines of a ``FuzzyMatchStream``.
+    public struct AsyncIterator: AsyncIteratorProtocol {
+        let base: Base
+        let matcher: FuzzyMatcher
+        let query: FuzzyQuery
+        let chunkSize: Int
+        let inFlight: InFlightChunks
+        var readerStarted = false
+        var output: [MatchResult] = []
+        var outputIndex = 0
+
+        init(base: Base, matcher: FuzzyMatcher, query: FuzzyQuery, chunkSize: Int, concurrency: Int) {
+            self.base = base
+            self.matcher = matcher
+            self.query = query
+            self.chunkSize = chunkSize
+            self.inFlight = InFlightChunks(capacity: concurrency)
+        }
+
+        /// Returns the next matching line, or `nil` after the last one.
+        public mutating func next() async throws -> MatchResult? {
+            if !readerStarted {
+                readerStarted = true
+                startReader()
+            }
+            while outputIndex == output.count {
+                if Task.isCancelled {
+                    inFlight.cancelAll()
+                    throw CancellationError()
+                }
+                guard let head = try await inFlight.nextChunk() else { return nil }
+                output = await head.value
+                outputIndex = 0
+                inFlight.releaseHead()
+            }
+            defer { outputIndex += 1 }
+            return output[outputIndex]
+        }
+
+        /// Starts the task that reads chunks from the base sequence and starts
+        /// scoring them whenever fewer than `concurrency` chunks are in flight.
+        private func startReader() {
+            let base = base
+            let matcher = matcher
+            let query = query
+            let chunkSize = chunkSize
+            let chunks = inFlight.chunks
+            chunks.setReader(Task {
+                var iterator = base.makeAsyncIterator()
+                do {
+                    var baseFinished = false
+                    while !baseFinished, await chunks.waitForSlot() {
+                        var lines: [String] = []
+                        lines.reserveCapacity(chunkSize)
+                        while lines.count < chunkSize {
+                            guard let line = try await iterator.next() else {
+                                baseFinished = true
+                                break
+                            }
+                            lines.append(line)
+                        }
+                        if !lines.isEmpty {
+                            chunks.append(Task { [lines] in matcher.matchingLines(lines, against: query) })
+                        }
+                    }
+                    chunks.finish(throwing: nil)
+                } catch {
+                    chunks.finish(throwing: error)
+                }
+            })
+        }
+    }
+}
+
+/// The chunks of a ``FuzzyMatchStream`` iterator, owned by the iterator.
+///
+/// A class so that discarding the iterator cancels the reader and the chunks it
+/// started; the reader itself only holds the shared ``StreamChunks``.
+final class InFlightChunks {
+    let chunks: StreamChunks
+
+    init(capacity: Int) {
+        self.chunks = StreamChunks(capacity: capacity)
+    }
+
+    func nextChunk() async throws -> Task<[MatchResult], Never>? {
+        try await chunks.nextChunk()
+    }
+
+    func releaseHead() {
+        chunks.releaseHead()
+    }
+
+    func cancelAll() {
+        chunks.cancelAll()
+    }
+
+    deinit {
+        chunks.cancelAll()
+    }
+}
+
+/// Scoring tasks of a ``FuzzyMatchStream``, oldest first, shared between the reader
+/// task that starts them and the iterator that consumes them.
+///
+/// A chunk holds one of `capacity` slots from when the reader starts it until the
+/// iterator has taken its results, so the reader waits while all slots are held.
+final class StreamChunks: Sendable {
+    struct State {
+        var tasks: [Task<[MatchResult], Never>] = []
+        /// Whether the iterator holds the chunk it took last.
+        var headTaken = false
+        var finished = false
+        var failure: (any Error)?
+        var cancelled = false
+        var reader: Task<Void, Never>?
+        /// The iterator, waiting for a chunk or for the reader to finish.
+        var consumer: CheckedContinuation<Void, Never>?
+        /// The reader, waiting for a free slot.
+        var producer: CheckedContinuation<Void, Never>?
+
+        var slotsInUse: Int { tasks.count + (headTaken ? 1 : 0) }
+    }
+
+    let capacity: Int
+    private let state = Mutex(State())
+
+    init(capacity: Int) {
+        self.capacity = capacity
+    }
+
+    // MARK: Reader Side
+
+    func setReader(_ reader: Task<Void, Never>) {
+        let cancelled = state.withLock { state in
+            state.reader = reader
+            return state.cancelled
+        }
+        if cancelled {
+            reader.cancel()
+        }
+    }
+
+    /// Waits until a slot is free. Returns `false` once the chunks are cancelled.
+    func waitForSlot() async -> Bool {
+        while true {
+            let ready: Bool? = state.withLock { state in
+                if state.cancelled { return false }
+                return state.slotsInUse < capacity ? true : nil
+            }
+            if let ready { return ready }
+            await withCheckedContinuation { (continuation: CheckedContinuation<Void, Never>) in
+                let resumeNow = state.withLock { state in
+                    guard !state.cancelled, state.slotsInUse >= capacity else { return true }
+                    state.producer = continuation
+                    return false
+                }
+                if resumeNow {
+                    continuation.resume()
+                }
+            }
+        }
+    }
+
+    func append(_ task: Task<[MatchResult], Never>) {
+        let (cancelled, consumer) = state.withLock { state in
+            if !state.cancelled {
+                state.tasks.append(task)
+            }
+            return (state.cancelled, state.takeConsumer())
+        }
+        if cancelled {
+            task.cancel()
+        }
+        consumer?.resume()
+    }
+
+    func finish(throwing failure: (any Error)?) {
+        let consumer = state.withLock { state in
+            state.finished = true
+            state.failure = failure
+            return state.takeConsumer()
+        }
+        consumer?.resume()
+    }
+
+    // MARK: Iterator Side
+
+    /// Takes the oldest chunk, waiting for the reader to start one. Returns `nil`
+    /// after the last chunk, or throws the base sequence's error.
+    func nextChunk() async throws -> Task<[MatchResult], Never>? {
+        try await withTaskCancellationHandler {
+            while true {
+                if Task.isCancelled {
+                    throw CancellationError()
+                }
+                let next: Result<Task<[MatchResult], Never>?, any Error>? = state.withLock { state in
+                    if !state.tasks.isEmpty {
+                        state.headTaken = true
+                        return .success(state.tasks.removeFirst())
+                    }
+                    guard state.finished || state.cancelled else { return nil }
+                    if let failure = state.failure {
+                        state.failure = nil
+                        return .failure(failure)
+                    }
+                    return .success(nil)
+                }
+                if let next {
+                    return try next.get()
+                }
+                await withCheckedContinuation { (continuation: CheckedContinuation<Void, Never>) in
+                    let resumeNow = state.withLock { state in
+                        guard state.tasks.isEmpty, !state.finished, !state.cancelled else { return true }
+                        state.consumer = continuation
+                        return false
+                    }
+                    if resumeNow {
+                        continuation.resume()
+                    }
+                }
+            }
+        } onCancel: {
+            cancelAll()
+        }
+    }
+
+    /// Frees the slot of the chunk the iterator took last.
+    func releaseHead() {
+        let producer = state.withLock { state in
+            state.headTaken = false
+            return state.takeProducer()
+        }
+        producer?.resume()
+    }
+
+    /// Cancels the reader and every chunk in flight, and wakes both sides.
+    func cancelAll() {
+        let (reader, tasks, consumer, producer) = state.withLock { state in
+            state.cancelled = true
+            let tasks = state.tasks
+            state.tasks.removeAll()
+            return (state.reader, tasks, state.takeConsumer(), state.takeProducer())
+        }
+        reader?.cancel()
+        for task in tasks {
+            task.cancel()
+        }
+        consumer?.resume()
+        producer?.resume()
+    }
+}
+
+extension StreamChunks.State {
+    mutating func takeConsumer() -> CheckedContinuation<Void, Never>? {
+        defer { consumer = nil }
+        return consumer
+    }
+
+    mutating func takeProducer() -> CheckedContinuation<Void, Never>? {
+        defer { producer = nil }
+        return producer
+    }
+}
+
+// MARK: - Streaming
+
+extension FuzzyMatcher {
+    /// Returns the lines of `lines` that match `query`, in input order, scoring
+    /// chunks of lines concurrently.
+    ///
+    /// Every returned line matches exactly as it would with ``score(_:against:buffer:)``.
+    /// See ``FuzzyMatchStream`` for how chunks are scheduled and how backpressure works.
+    ///
+    /// - Parameters:
+    ///   - lines: The lines to search, for example a log or audit stream. They are
+    ///     read on a separate task, hence the `Sendable` requirement.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - chunkSize: Number of lines scored per task. Default is `4096`.
+    ///   - concurrency: Maximum number of chunks scored at once, typically the number
+    ///     of available cores.
+    /// - Returns: An asynchronous sequence of ``MatchResult`` in input order.
+    public func matchStream<Lines: AsyncSequence & Sendable>(
+        _ lines: Lines,
+        against query: FuzzyQuery,
+        chunkSize: Int = 4_096,
+        concurrency: Int
+    ) -> FuzzyMatchStream<Lines> where Lines.Element == String {
+        FuzzyMatchStream(base: lines, matcher: self, query: query, chunkSize: chunkSize, concurrency: concurrency)
+    }
+
+    /// Scores one chunk of a ``FuzzyMatchStream``, returning its matches in order.
+    ///
+    /// Checks for cancellation every 256 lines and returns what it has so far if the
+    /// task was cancelled (the iterator discards it).
+    internal func matchingLines(_ lines: [String], against query: FuzzyQuery) -> [MatchResult] {
+        var buffer = makeBuffer()
+        var results: [MatchResult] = []
+        for (offset, line) in lines.enumerated() {
+            if offset & 255 == 0 && Task.isCancelled {
+                break
+            }
+            if let match = score(line, against: query, buffer: &buffer) {
+                results.append(MatchResult(candidate: line, match: match))
+            }
+        }
+        return results
+    }
+}
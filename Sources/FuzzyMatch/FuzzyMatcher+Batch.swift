@@ -0,0 +1,237 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+extension FuzzyMatcher {
+    // MARK: - Batch Scoring
+
+    /// Scores a block of candidates against a prepared query.
+    ///
+    /// Returns exactly what calling ``score(_:against:buffer:)`` on each candidate
+    /// would, in the same order. In Smith-Waterman mode, consecutive groups of eight
+    /// candidates share one DP pass with one candidate per SIMD lane, which amortizes
+    /// the per-cell work across the group. Each group runs for as many positions as
+    /// its longest candidate, so the speedup is largest when candidates of similar
+    /// length are batched together (for example, after bucketing a corpus by length).
+    /// Edit distance mode scores one candidate at a time.
+    ///
+    /// - Parameters:
+    ///   - candidates: The candidates to score.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - buffer: A reusable scoring buffer from ``makeBuffer()``.
+    /// - Returns: One ``ScoredMatch`` or `nil` per candidate, in input order.
+    ///
+    /// ## Example
+    ///
+    /// ```swift
+    /// let matcher = FuzzyMatcher(config: .smithWaterman)
+    /// let query = matcher.prepare("user")
+    /// var buffer = matcher.makeBuffer()
+    ///
+    /// let bucket = ["getUserById", "setUserName", "fetchUsers1"]
+    /// let results = matcher.scoreBatch(bucket.span, against: query, buffer: &buffer)
+    /// ```
+    public func scoreBatch(
+        _ candidates: Span<String>,
+        against query: FuzzyQuery,
+        buffer: inout ScoringBuffer
+    ) -> [ScoredMatch?] {
+        guard case .smithWaterman(let swConfig) = query.config.algorithm else {
+            var results: [ScoredMatch?] = []
+            results.reserveCapacity(candidates.count)
+            for index in 0..<candidates.count {
+                results.append(score(candidates[index], against: query, buffer: &buffer))
+            }
+            return results
+        }
+
+        var results = [ScoredMatch?](repeating: nil, count: candidates.count)
+        let laneCount = SmithWatermanBatchState.laneCount
+        var blockStart = 0
+        while blockStart < candidates.count {
+            let blockEnd = min(blockStart + laneCount, candidates.count)
+            scoreSmithWatermanBlock(
+                candidates.extracting(blockStart..<blockEnd),
+                firstResult: blockStart,
+                against: query,
+                swConfig: swConfig,
+                buffer: &buffer,
+                results: &results
+            )
+            blockStart = blockEnd
+        }
+        return results
+    }
+
+    /// Scores up to eight candidates with one batched Smith-Waterman pass.
+    ///
+    /// Runs the same pipeline as
+    /// ``scoreSmithWatermanImpl(_:against:swConfig:candidateStorage:smithWatermanState:wordInitials:statistics:)``:
+    /// the per-candidate stages (bitmask, lowercase-and-bonus pass, exact match, and
+    /// the acronym fallback) stay per lane, and only the DP is shared. The lanes are
+    /// counted in ``ScoringBuffer/statistics`` but never timed.
+    @inlinable
+    internal func scoreSmithWatermanBlock(
+        _ block: Span<String>,
+        firstResult: Int,
+        against query: FuzzyQuery,
+        swConfig: SmithWatermanConfig,
+        buffer: inout ScoringBuffer,
+        results: inout [ScoredMatch?]
+    ) {
+        defer {
+            for lane in 0..<block.count {
+                buffer.statistics.countCandidate(matched: results[firstResult + lane] != nil)
+            }
+        }
+        let queryLength = query.lowercased.count
+        if queryLength == 0 {
+            for lane in 0..<block.count {
+                results[firstResult + lane] = ScoredMatch(score: 1.0, kind: .exact)
+            }
+            return
+        }
+
+        var maxCandidateLength = 0
+        for lane in 0..<block.count {
+            let candidateLength = block[lane].utf8.count
+            buffer.recordUsage(queryLength: queryLength, candidateLength: candidateLength)
+            maxCandidateLength = max(maxCandidateLength, candidateLength)
+        }
+        buffer.smithWatermanBatchState.ensureCapacity(maxCandidateLength)
+
+        // Per-lane prefilters and lowercase-and-bonus pass
+        var laneLengths = SIMD8<Int32>(repeating: 0)
+        var laneIsASCII = SIMD8<Int32>(repeating: 0)
+        var blockLength = 0
+        for lane in 0..<block.count {
+            let candidateUTF8 = block[lane].utf8.span
+            if candidateUTF8.isEmpty { continue }
+
+            let (candidateMask, candidateIsASCII) = computeCharBitmaskWithASCIICheck(candidateUTF8)
+            let passesBitmask = passesCharBitmask(queryMask: query.charBitmask, candidateMask: candidateMask, maxEditDistance: 0)
+            buffer.statistics.count(.bitmask, passed: passesBitmask)
+            if !passesBitmask {
+                continue
+            }
+
+            let length = lowercaseWithSmithWatermanBonuses(
+                candidateUTF8,
+                isASCII: candidateIsASCII,
+                swConfig: swConfig,
+                candidateStorage: &buffer.smithWatermanBatchState.lanes[lane]
+            )
+
+            buffer.statistics.count(.lowercase, passed: true)
+
+            // Exact match early exit (before atom split so multi-word self-matches return .exact)
+            if length == queryLength {
+                var isExact = true
+                for i in 0..<queryLength where buffer.smithWatermanBatchState.lanes[lane].bytes[i] != query.lowercased[i] {
+                    isExact = false
+                    break
+                }
+                if isExact {
+                    buffer.statistics.count(.exactMatch, passed: false)
+                    results[firstResult + lane] = ScoredMatch(score: 1.0, kind: .exact)
+                    continue
+                }
+            }
+            buffer.statistics.count(.exactMatch, passed: true)
+
+            laneLengths[lane] = Int32(length)
+            laneIsASCII[lane] = candidateIsASCII ? 1 : 0
+            blockLength = max(blockLength, length)
+        }
+        guard blockLength > 0 else { return }
+
+        // Transpose the active lanes; inactive and exhausted lanes read as -1
+        transposeSmithWatermanLanes(
+            &buffer.smithWatermanBatchState,
+            laneLengths: laneLengths,
+            blockLength: blockLength
+        )
+
+        let characters = buffer.smithWatermanBatchState.characters.span.extracting(0..<blockLength)
+        let bonuses = buffer.smithWatermanBatchState.bonuses.span.extracting(0..<blockLength)
+
+        if query.atoms.count > 1 {
+            // Multi-atom path: score each word independently, AND semantics
+            var totalRawScores = SIMD8<Int32>(repeating: 0)
+            var allAtomsMatched = laneLengths .> 0
+            for atom in query.atoms {
+                let atomScores = smithWatermanScoreBatch(
+                    query: query.lowercased.span.extracting(atom.start..<(atom.start + atom.length)),
+                    characters: characters,
+                    bonuses: bonuses,
+                    laneLengths: laneLengths,
+                    rows: &buffer.smithWatermanState.batchRows,
+                    config: swConfig
+                )
+                allAtomsMatched .&= atomScores .> 0
+                totalRawScores &+= atomScores
+            }
+            for lane in 0..<block.count where allAtomsMatched[lane] {
+                results[firstResult + lane] = finishSmithWatermanMultiAtomScore(
+                    totalRawScore: totalRawScores[lane],
+                    against: query
+                )
+            }
+            for lane in 0..<block.count where laneLengths[lane] > 0 {
+                buffer.statistics.count(.smithWaterman, passed: results[firstResult + lane] != nil)
+            }
+            return
+        }
+
+        // Single-word path
+        let rawScores = smithWatermanScoreBatch(
+            query: query.lowercased.span,
+            characters: characters,
+            bonuses: bonuses,
+            laneLengths: laneLengths,
+            rows: &buffer.smithWatermanState.batchRows,
+            config: swConfig
+        )
+        for lane in 0..<block.count where laneLengths[lane] > 0 {
+            let length = Int(laneLengths[lane])
+            results[firstResult + lane] = finishSmithWatermanScore(
+                rawScore: rawScores[lane],
+                candidateUTF8: block[lane].utf8.span,
+                candidateIsASCII: laneIsASCII[lane] != 0,
+                candidateSpan: buffer.smithWatermanBatchState.lanes[lane].bytes.span.extracting(0..<length),
+                against: query,
+                wordInitials: &buffer.wordInitials
+            )
+            buffer.statistics.count(.smithWaterman, passed: results[firstResult + lane] != nil)
+        }
+    }
+
+    /// Transposes the lane bytes and bonuses of `state` into its `characters` and
+    /// `bonuses` rows for positions `0..<blockLength`.
+    @inlinable
+    internal func transposeSmithWatermanLanes(
+        _ state: inout SmithWatermanBatchState,
+        laneLengths: SIMD8<Int32>,
+        blockLength: Int
+    ) {
+        for i in 0..<blockLength {
+            var characters = SIMD8<Int32>(repeating: -1)
+            var bonuses = SIMD8<Int32>(repeating: 0)
+            for lane in 0..<SmithWatermanBatchState.laneCount where i < Int(laneLengths[lane]) {
+                characters[lane] = Int32(state.lanes[lane].bytes[i])
+                bonuses[lane] = state.lanes[lane].bonus[i]
+            }
+            state.characters[i] = characters
+            state.bonuses[i] = bonuses
+        }
+    }
+}
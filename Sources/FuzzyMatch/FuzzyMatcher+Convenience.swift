@@ -65,31 +65,33 @@ extension FuzzyMatcher {
         against query: FuzzyQuery,
         limit: Int = 10
     ) -> [MatchResult] {
-        var buffer = makeBuffer()
-        var results: [MatchResult] = []
-        results.reserveCapacity(limit)
+        var top = TopKCollector<MatchResult>(limit: limit)
+        collectTopMatches(candidates, firstOrdinal: 0, against: query, into: &top)
+        return top.sortedElements()
+    }
 
+    /// Scores `candidates` into `top`, using `firstOrdinal + offset` as each
+    /// candidate's tie-breaking ordinal.
+    ///
+    /// Once `top` is full, its lowest score is passed as the score floor, so candidates
+    /// that provably cannot get in skip the alignment phases. Ordinals only increase,
+    /// so a candidate scoring below the floor could never be retained anyway.
+    @inlinable
+    internal func collectTopMatches(
+        _ candidates: some Sequence<String>,
+        firstOrdinal: Int,
+        against query: FuzzyQuery,
+        into top: inout TopKCollector<MatchResult>
+    ) {
+        var buffer = makeBuffer()
+        var ordinal = firstOrdinal
         for candidate in candidates {
-            guard let match = score(candidate, against: query, buffer: &buffer) else {
-                continue
-            }
-            let result = MatchResult(candidate: candidate, match: match)
-            if results.count < limit {
-                results.append(result)
-                if results.count == limit {
-                    results.sort { $0.match.score > $1.match.score }
-                }
-            } else if match.score > results[results.count - 1].match.score {
-                results[results.count - 1] = result
-                results.sort { $0.match.score > $1.match.score }
+            let scoreFloor = top.minimumScore ?? -.infinity
+            if let match = score(candidate, against: query, buffer: &buffer, scoreFloor: scoreFloor) {
+                top.insert(MatchResult(candidate: candidate, match: match), score: match.score, ordinal: ordinal)
             }
+            ordinal &+= 1
         }
-
-        if results.count < limit {
-            results.sort { $0.match.score > $1.match.score }
-        }
-
-        return results
     }
 
     /// Returns all matching candidates sorted by score descending.
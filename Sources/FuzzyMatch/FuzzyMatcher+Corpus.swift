@@ -0,0 +1,560 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+extension FuzzyMatcher {
+    // MARK: - Corpus Scoring
+
+    /// Scores one candidate of a prebuilt ``FuzzyCorpus`` against a prepared query.
+    ///
+    /// Produces exactly the same result as calling ``score(_:against:buffer:)`` with
+    /// `corpus[index]`, but reads the candidate's bitmask, length, lowercased bytes and
+    /// boundary mask from the corpus instead of recomputing them.
+    ///
+    /// - Parameters:
+    ///   - corpus: The corpus containing the candidate.
+    ///   - index: The position of the candidate in `corpus`.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - buffer: A reusable scoring buffer from ``makeBuffer()``.
+    /// - Returns: A ``ScoredMatch`` if the candidate matches, or `nil`.
+    ///
+    /// ## Example
+    ///
+    /// ```swift
+    /// let corpus = FuzzyCorpus(["getUserById", "setUser", "fetchData"])
+    /// let matcher = FuzzyMatcher()
+    /// let query = matcher.prepare("user")
+    /// var buffer = matcher.makeBuffer()
+    ///
+    /// for index in corpus.indices {
+    ///     if let match = matcher.score(corpus, at: index, against: query, buffer: &buffer) {
+    ///         print("\(corpus[index]): \(match.score)")
+    ///     }
+    /// }
+    /// ```
+    public func score(
+        _ corpus: FuzzyCorpus,
+        at index: Int,
+        against query: FuzzyQuery,
+        buffer: inout ScoringBuffer
+    ) -> ScoredMatch? {
+        score(corpus, at: index, against: query, buffer: &buffer, scoreFloor: -.infinity)
+    }
+
+    /// Scores one corpus candidate, allowing an early `nil` for candidates that cannot
+    /// reach `scoreFloor` (see ``score(_:against:buffer:scoreFloor:)``).
+    @inlinable
+    internal func score(
+        _ corpus: FuzzyCorpus,
+        at index: Int,
+        against query: FuzzyQuery,
+        buffer: inout ScoringBuffer,
+        scoreFloor: Double
+    ) -> ScoredMatch? {
+        let candidateLength = Int(corpus.lengths[index])
+        buffer.recordUsage(
+            queryLength: query.lowercased.count,
+            candidateLength: candidateLength
+        )
+
+        buffer.statistics.beginCandidate()
+        let result: ScoredMatch?
+        switch query.config.algorithm {
+        case .smithWaterman(let swConfig):
+            // Reject on the precomputed bitmask before touching candidate bytes;
+            // candidates that pass are counted by the bitmask check they repeat below
+            if !passesCharBitmask(
+                queryMask: query.charBitmask,
+                candidateMask: corpus.charBitmasks[index],
+                maxEditDistance: 0
+            ) {
+                buffer.statistics.count(.bitmask, passed: false)
+                result = nil
+                break
+            }
+            // The DP bonus row depends on the original casing, so the
+            // Smith-Waterman pass still runs over the original bytes.
+            result = scoreSmithWatermanImpl(
+                corpus.utf8.span.extracting(corpus.utf8Range(at: index)),
+                against: query,
+                swConfig: swConfig,
+                candidateStorage: &buffer.candidateStorage,
+                smithWatermanState: &buffer.smithWatermanState,
+                wordInitials: &buffer.wordInitials,
+                statistics: &buffer.statistics
+            )
+
+        case .editDistance(let edConfig):
+            if query.lowercased.count == 1 {
+                result = scoreTinyQuery1(
+                    corpus.utf8.span.extracting(corpus.utf8Range(at: index)),
+                    candidateLength: candidateLength,
+                    q0: query.lowercased[0],
+                    edConfig: edConfig,
+                    minScore: query.config.minScore
+                )
+            } else {
+                result = scoreCorpusCandidateImpl(
+                    corpus,
+                    at: index,
+                    against: query,
+                    edConfig: edConfig,
+                    editDistanceState: &buffer.editDistanceState,
+                    matchPositions: &buffer.matchPositions,
+                    alignmentState: &buffer.alignmentState,
+                    wordInitials: &buffer.wordInitials,
+                    statistics: &buffer.statistics,
+                    scoreFloor: scoreFloor
+                )
+            }
+        }
+        buffer.statistics.endCandidate(matched: result != nil)
+        return result
+    }
+
+    /// Edit distance scoring for a corpus candidate.
+    ///
+    /// Mirrors the prefilter sequence of
+    /// ``scoreImpl(_:against:edConfig:candidateStorage:editDistanceState:matchPositions:alignmentState:wordInitials:statistics:scoreFloor:)``
+    /// using the precomputed corpus columns, then hands the lowercased bytes and word
+    /// initials straight to the shared phase pipeline without copying them into the
+    /// scoring buffer.
+    @inlinable
+    internal func scoreCorpusCandidateImpl(
+        _ corpus: FuzzyCorpus,
+        at index: Int,
+        against query: FuzzyQuery,
+        edConfig: EditDistanceConfig,
+        editDistanceState: inout EditDistanceState,
+        matchPositions: inout [Int],
+        alignmentState: inout AlignmentState,
+        wordInitials: inout [UInt8],
+        statistics: inout ScoringStatistics,
+        scoreFloor: Double = -.infinity
+    ) -> ScoredMatch? {
+        let candidateLength = Int(corpus.lengths[index])
+        let queryLength = query.lowercased.count
+
+        // Handle empty cases
+        if queryLength == 0 {
+            return ScoredMatch(score: 1.0, kind: .exact)
+        }
+        if candidateLength == 0 {
+            return nil
+        }
+
+        // Prefilter 1: Length bounds
+        statistics.enter(.lengthBounds)
+        if candidateLength < query.minCandidateLength {
+            return nil
+        }
+        statistics.pass(.lengthBounds)
+
+        // Prefilter 2: Character bitmask (precomputed)
+        statistics.enter(.bitmask)
+        if !passesCharBitmask(
+            queryMask: query.charBitmask,
+            candidateMask: corpus.charBitmasks[index],
+            maxEditDistance: query.bitmaskTolerance
+        ) {
+            return nil
+        }
+        statistics.pass(.bitmask)
+
+        editDistanceState.ensureCapacity(queryLength)
+        if matchPositions.count < queryLength {
+            matchPositions = [Int](repeating: 0, count: queryLength)
+        }
+
+        let candidateSpan = corpus.lowercased.span.extracting(corpus.lowercasedRange(at: index))
+
+        // Prefilter 3: Trigrams
+        statistics.enter(.trigram)
+        if !passesQueryTrigramFilter(candidateSpan, query: query) {
+            return nil
+        }
+        statistics.pass(.trigram)
+
+        return scoreLowercasedCandidate(
+            candidateSpan,
+            candidateUTF8: corpus.utf8.span.extracting(corpus.utf8Range(at: index)),
+            boundaryMask: corpus.boundaryMasks[index],
+            against: query,
+            edConfig: edConfig,
+            editDistanceState: &editDistanceState,
+            matchPositions: &matchPositions,
+            alignmentState: &alignmentState,
+            wordInitials: &wordInitials,
+            statistics: &statistics,
+            wordInitialsColumn: corpus.wordInitials.span.extracting(corpus.wordInitialsRange(at: index)),
+            scoreFloor: scoreFloor
+        )
+    }
+
+    // MARK: - Corpus Convenience
+
+    /// Returns the top matches from a prebuilt corpus, sorted by score descending.
+    ///
+    /// Results are identical to passing the same candidates as a sequence of strings,
+    /// but per-candidate preprocessing was already done when the corpus was built,
+    /// and the length and bitmask prefilters run as one vectorized sweep over the
+    /// corpus columns before any candidate is scored.
+    ///
+    /// - Parameters:
+    ///   - corpus: The corpus to search.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - limit: Maximum number of results to return. Default is `10`.
+    /// - Returns: An array of ``MatchResult`` sorted by score descending,
+    ///   containing at most `limit` elements.
+    ///
+    /// ## Example
+    ///
+    /// ```swift
+    /// let corpus = FuzzyCorpus(symbols)
+    /// let matcher = FuzzyMatcher()
+    /// let results = matcher.topMatches(corpus, against: matcher.prepare("user"), limit: 5)
+    /// ```
+    public func topMatches(
+        _ corpus: FuzzyCorpus,
+        against query: FuzzyQuery,
+        limit: Int = 10
+    ) -> [MatchResult] {
+        var survivors: [UInt32] = []
+        corpus.collectPrefilterSurvivors(for: query, into: &survivors)
+        var top = TopKCollector<MatchResult>(limit: limit)
+        collectTopMatches(corpus, indices: survivors, against: query, into: &top)
+        return top.sortedElements()
+    }
+
+    /// Scores the corpus candidates at `indices` (typically prefilter survivors) into
+    /// `top`, using `firstOrdinal` plus the corpus index as the tie-breaking ordinal.
+    ///
+    /// The candidate string is only decoded when the match is retained, and once `top`
+    /// is full its lowest score is passed on as the score floor.
+    @inlinable
+    internal func collectTopMatches(
+        _ corpus: FuzzyCorpus,
+        indices: some Sequence<UInt32>,
+        against query: FuzzyQuery,
+        into top: inout TopKCollector<MatchResult>,
+        firstOrdinal: Int = 0
+    ) {
+        collectTopMatches(corpus, indices: indices, against: query, into: &top, firstOrdinal: firstOrdinal) { index, match in
+            MatchResult(candidate: corpus[index], match: match)
+        }
+    }
+
+    /// Scores the corpus candidates at `indices` into `top`, building each retained
+    /// element with `makeElement(index, match)`.
+    ///
+    /// Ties are broken by `firstOrdinal + index`, so several corpora searched into one
+    /// collector rank equal scores in the order the corpora are passed.
+    @inlinable
+    internal func collectTopMatches<Element>(
+        _ corpus: FuzzyCorpus,
+        indices: some Sequence<UInt32>,
+        against query: FuzzyQuery,
+        into top: inout TopKCollector<Element>,
+        firstOrdinal: Int = 0,
+        makeElement: (Int, ScoredMatch) -> Element
+    ) {
+        var buffer = makeBuffer()
+        collectTopMatches(
+            corpus,
+            indices: indices,
+            against: query,
+            into: &top,
+            firstOrdinal: firstOrdinal,
+            buffer: &buffer,
+            makeElement: makeElement
+        )
+    }
+
+    /// Scores the corpus candidates at `indices` into `top` with a caller-owned
+    /// `buffer`, so a caller scoring many batches reuses one buffer for all of them.
+    @inlinable
+    internal func collectTopMatches<Element>(
+        _ corpus: FuzzyCorpus,
+        indices: some Sequence<UInt32>,
+        against query: FuzzyQuery,
+        into top: inout TopKCollector<Element>,
+        firstOrdinal: Int = 0,
+        buffer: inout ScoringBuffer,
+        makeElement: (Int, ScoredMatch) -> Element
+    ) {
+        for survivor in indices {
+            let index = Int(survivor)
+            let ordinal = firstOrdinal &+ index
+            let scoreFloor = top.minimumScore ?? -.infinity
+            guard let match = score(corpus, at: index, against: query, buffer: &buffer, scoreFloor: scoreFloor),
+                top.wouldAccept(score: match.score, ordinal: ordinal) else {
+                continue
+            }
+            top.insert(makeElement(index, match), score: match.score, ordinal: ordinal)
+        }
+    }
+
+    /// Returns all matching candidates from a prebuilt corpus, sorted by score descending.
+    ///
+    /// - Parameters:
+    ///   - corpus: The corpus to search.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    /// - Returns: An array of ``MatchResult`` sorted by score descending.
+    public func matches(
+        _ corpus: FuzzyCorpus,
+        against query: FuzzyQuery
+    ) -> [MatchResult] {
+        var buffer = makeBuffer()
+        var results: [MatchResult] = []
+
+        var survivors: [UInt32] = []
+        corpus.collectPrefilterSurvivors(for: query, into: &survivors)
+
+        for survivor in survivors {
+            let index = Int(survivor)
+            if let match = score(corpus, at: index, against: query, buffer: &buffer) {
+                results.append(MatchResult(candidate: corpus[index], match: match))
+            }
+        }
+
+        results.sort { $0.match.score > $1.match.score }
+        return results
+    }
+
+    /// Returns the top matches from a prebuilt corpus, sorted by score descending.
+    ///
+    /// This is a convenience method that handles query preparation internally.
+    ///
+    /// - Parameters:
+    ///   - corpus: The corpus to search.
+    ///   - query: The query string to match against.
+    ///   - limit: Maximum number of results to return. Default is `10`.
+    /// - Returns: An array of ``MatchResult`` sorted by score descending,
+    ///   containing at most `limit` elements.
+    public func topMatches(
+        _ corpus: FuzzyCorpus,
+        against query: String,
+        limit: Int = 10
+    ) -> [MatchResult] {
+        topMatches(corpus, against: prepare(query), limit: limit)
+    }
+
+    /// Returns all matching candidates from a prebuilt corpus, sorted by score descending.
+    ///
+    /// This is a convenience method that handles query preparation internally.
+    ///
+    /// - Parameters:
+    ///   - corpus: The corpus to search.
+    ///   - query: The query string to match against.
+    /// - Returns: An array of ``MatchResult`` sorted by score descending.
+    public func matches(
+        _ corpus: FuzzyCorpus,
+        against query: String
+    ) -> [MatchResult] {
+        matches(corpus, against: prepare(query))
+    }
+
+    // MARK: - Corpus Index Results
+
+    /// Returns the corpus indices of the top matches, sorted by score descending.
+    ///
+    /// Same ranking as the corpus `topMatches(_:against:limit:)`, including ties
+    /// going to the lower index, but each result holds the candidate's
+    /// position in `corpus` instead of a decoded `String`, so no candidate is copied
+    /// out of the arena. Use `corpus[result.item]` to decode one when it is needed.
+    ///
+    /// - Parameters:
+    ///   - corpus: The corpus to search.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - limit: Maximum number of results to return. Default is `10`.
+    /// - Returns: An array of ``ItemMatchResult`` whose items are corpus indices,
+    ///   sorted by score descending and containing at most `limit` elements.
+    ///
+    /// ## Example
+    ///
+    /// ```swift
+    /// let corpus = FuzzyCorpus(utf8: arena, offsets: offsets)
+    /// for result in matcher.topMatchIndices(corpus, against: matcher.prepare("user")) {
+    ///     print(result.item, result.match.score)
+    /// }
+    /// ```
+    public func topMatchIndices(
+        _ corpus: FuzzyCorpus,
+        against query: FuzzyQuery,
+        limit: Int = 10
+    ) -> [ItemMatchResult<Int>] {
+        var survivors: [UInt32] = []
+        corpus.collectPrefilterSurvivors(for: query, into: &survivors)
+        var top = TopKCollector<ItemMatchResult<Int>>(limit: limit)
+        collectTopMatches(corpus, indices: survivors, against: query, into: &top) { index, match in
+            ItemMatchResult(item: index, match: match)
+        }
+        return top.sortedElements()
+    }
+
+    /// Returns the corpus indices of all matching candidates, sorted by score descending.
+    ///
+    /// Candidates with equal scores are listed in ascending index order.
+    ///
+    /// - Parameters:
+    ///   - corpus: The corpus to search.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    /// - Returns: An array of ``ItemMatchResult`` whose items are corpus indices,
+    ///   sorted by score descending.
+    public func matchIndices(
+        _ corpus: FuzzyCorpus,
+        against query: FuzzyQuery
+    ) -> [ItemMatchResult<Int>] {
+        var buffer = makeBuffer()
+        var results: [ItemMatchResult<Int>] = []
+
+        var survivors: [UInt32] = []
+        corpus.collectPrefilterSurvivors(for: query, into: &survivors)
+
+        for survivor in survivors {
+            let index = Int(survivor)
+            if let match = score(corpus, at: index, against: query, buffer: &buffer) {
+                results.append(ItemMatchResult(item: index, match: match))
+            }
+        }
+
+        results.sort { $0.match.score != $1.match.score ? $0.match.score > $1.match.score : $0.item < $1.item }
+        return results
+    }
+}
+
+// MARK: - Multi-Query Corpus Search
+
+extension FuzzyMatcher {
+    /// Number of corpus candidates per tile of the multi-query search. The columns of
+    /// one tile (offsets, bitmasks, lengths and lowercased bytes) stay well within L2.
+    @usableFromInline static let multiQueryTileSize = 1_024
+
+    /// Number of queries walked through the corpus together by the multi-query
+    /// search, which bounds its memory use for long query lists.
+    @usableFromInline static let multiQueryGroupSize = 64
+
+    /// Returns the top matches of several queries against one prebuilt corpus.
+    ///
+    /// Element `i` of the result equals the corpus `topMatches(_:against:limit:)` for
+    /// `queries[i]`, ties and score floors included. Instead of one full pass over the
+    /// corpus per query, the corpus is walked once per group of queries, in tiles of
+    /// candidates. For every query in the group, the tile's bitmask and length columns
+    /// are swept and the tile's survivors scored while its columns are still in cache,
+    /// so each tile is read from memory once per group rather than once per query.
+    /// Each query keeps its own top-K collector. This pays off when the corpus is
+    /// larger than the cache and many queries run against it, as in batch
+    /// reconciliation jobs.
+    ///
+    /// Queries answered from the corpus trigram index don't sweep the columns. Their
+    /// survivors are drawn from the posting lists in a per-query pass before the
+    /// group's walk, then scored tile by tile along with the other queries.
+    ///
+    /// - Parameters:
+    ///   - corpus: The corpus to search.
+    ///   - queries: Prepared queries from ``prepare(_:)``.
+    ///   - limit: Maximum number of results per query. Default is `10`.
+    /// - Returns: One array of ``MatchResult`` per query, in query order, each sorted
+    ///   by score descending and containing at most `limit` elements.
+    ///
+    /// ## Example
+    ///
+    /// ```swift
+    /// let corpus = FuzzyCorpus(names)
+    /// let queries = nightlyNames.map { matcher.prepare($0) }
+    /// for (name, results) in zip(nightlyNames, matcher.topMatches(corpus, against: queries, limit: 5)) {
+    ///     print(name, results.first?.candidate ?? "-")
+    /// }
+    /// ```
+    public func topMatches(
+        _ corpus: FuzzyCorpus,
+        against queries: [FuzzyQuery],
+        limit: Int = 10
+    ) -> [[MatchResult]] {
+        var tops = [TopKCollector<MatchResult>](repeating: TopKCollector(limit: limit), count: queries.count)
+        guard limit > 0 else { return tops.map { $0.sortedElements() } }
+
+        var buffer = makeBuffer()
+        let slotCount = min(queries.count, Self.multiQueryGroupSize)
+        var sweeps = [FuzzyCorpus.PrefilterSweep](repeating: .allIndices, count: slotCount)
+        // Trigram index survivors of each slot, and the next one to score
+        var indexSurvivors = [[UInt32]](repeating: [], count: slotCount)
+        var cursors = [Int](repeating: 0, count: slotCount)
+        var tileSurvivors: [UInt32] = []
+        tileSurvivors.reserveCapacity(Self.multiQueryTileSize)
+
+        var groupStart = 0
+        while groupStart < queries.count {
+            let group = groupStart..<min(groupStart + Self.multiQueryGroupSize, queries.count)
+            for slot in 0..<group.count {
+                let query = queries[group.lowerBound + slot]
+                sweeps[slot] = corpus.prefilterSweep(for: query)
+                cursors[slot] = 0
+                if case .trigramIndex = sweeps[slot] {
+                    corpus.collectPrefilterSurvivors(for: query, into: &indexSurvivors[slot])
+                } else {
+                    indexSurvivors[slot].removeAll(keepingCapacity: true)
+                }
+            }
+
+            var tileStart = 0
+            while tileStart < corpus.count {
+                let tile = tileStart..<min(tileStart + Self.multiQueryTileSize, corpus.count)
+                for slot in 0..<group.count {
+                    let queryIndex = group.lowerBound + slot
+                    let query = queries[queryIndex]
+                    tileSurvivors.removeAll(keepingCapacity: true)
+                    switch sweeps[slot] {
+                    case .allIndices:
+                        for index in tile {
+                            tileSurvivors.append(UInt32(truncatingIfNeeded: index))
+                        }
+                    case .trigramIndex:
+                        // Survivors are ascending, so this query's part of the tile is next
+                        let survivors = indexSurvivors[slot]
+                        while cursors[slot] < survivors.count, Int(survivors[cursors[slot]]) < tile.upperBound {
+                            tileSurvivors.append(survivors[cursors[slot]])
+                            cursors[slot] += 1
+                        }
+                    case let .columns(maxMissingCharacters, minCandidateLength):
+                        sweepPrefilters(
+                            charBitmasks: corpus.charBitmasks,
+                            lengths: corpus.lengths,
+                            in: tile,
+                            queryMask: query.charBitmask,
+                            maxMissingCharacters: maxMissingCharacters,
+                            minCandidateLength: minCandidateLength,
+                            appendingTo: &tileSurvivors
+                        )
+                    }
+
+                    for survivor in tileSurvivors {
+                        let index = Int(survivor)
+                        let scoreFloor = tops[queryIndex].minimumScore ?? -.infinity
+                        guard let match = score(corpus, at: index, against: query, buffer: &buffer, scoreFloor: scoreFloor),
+                              tops[queryIndex].wouldAccept(score: match.score, ordinal: index) else {
+                            continue
+                        }
+                        tops[queryIndex].insert(
+                            MatchResult(candidate: corpus[index], match: match),
+                            score: match.score,
+                            ordinal: index
+                        )
+                    }
+                }
+                tileStart = tile.upperBound
+            }
+            groupStart = group.upperBound
+        }
+        return tops.map { $0.sortedElements() }
+    }
+}
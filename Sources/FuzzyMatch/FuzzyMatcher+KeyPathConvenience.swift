@@ -55,30 +55,18 @@ extension FuzzyMatcher {
         limit: Int = 10
     ) -> [ItemMatchResult<Item>] {
         var buffer = makeBuffer()
-        var results: [ItemMatchResult<Item>] = []
-        results.reserveCapacity(limit)
+        var top = TopKCollector<ItemMatchResult<Item>>(limit: limit)
 
         for candidate in candidates {
-            guard let match = score(candidate[keyPath: keyPath], against: query, buffer: &buffer) else {
+            let scoreFloor = top.minimumScore ?? -.infinity
+            let text = candidate[keyPath: keyPath]
+            guard let match = score(text, against: query, buffer: &buffer, scoreFloor: scoreFloor) else {
                 continue
             }
-            let result = ItemMatchResult(item: candidate, match: match)
-            if results.count < limit {
-                results.append(result)
-                if results.count == limit {
-                    results.sort { $0.match.score > $1.match.score }
-                }
-            } else if match.score > results[results.count - 1].match.score {
-                results[results.count - 1] = result
-                results.sort { $0.match.score > $1.match.score }
-            }
+            top.insert(ItemMatchResult(item: candidate, match: match), score: match.score)
         }
 
-        if results.count < limit {
-            results.sort { $0.match.score > $1.match.score }
-        }
-
-        return results
+        return top.sortedElements()
     }
 
     /// Returns all matching items sorted by score descending, matching against a
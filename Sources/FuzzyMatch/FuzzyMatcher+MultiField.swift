@@ -0,0 +1,130 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+extension FuzzyMatcher {
+    // MARK: - Multi-Field Search
+
+    /// Returns the top records of a multi-field corpus, sorted by score descending.
+    ///
+    /// Each field is scored exactly as ``score(_:at:against:buffer:)`` would score it,
+    /// and a record's score is its best field score times that field's weight. Ties
+    /// go to the lower record index.
+    ///
+    /// The query is prepared once and shared by every field. The length and bitmask
+    /// prefilters sweep each field's columns, and the surviving (record, field) pairs
+    /// are then scored in one pass in record order. Once `limit` records are
+    /// collected, a field that cannot beat both the lowest collected score and the
+    /// record's best field so far skips alignment.
+    ///
+    /// - Parameters:
+    ///   - corpus: The corpus to search.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - weights: One non-negative weight per field, or `nil` to weigh every field
+    ///     `1.0`. A field with weight `0` is not scored. Default is `nil`.
+    ///   - limit: Maximum number of results to return. Default is `10`.
+    /// - Returns: An array of ``MultiFieldMatchResult`` sorted by score descending,
+    ///   containing at most `limit` elements.
+    public func topMatches(
+        _ corpus: MultiFieldCorpus,
+        against query: FuzzyQuery,
+        weights: [Double]? = nil,
+        limit: Int = 10
+    ) -> [MultiFieldMatchResult] {
+        guard limit > 0 else { return [] }
+        var top = TopKCollector<MultiFieldMatchResult>(limit: limit)
+        forEachMultiFieldMatch(corpus, against: query, weights: weights) { result in
+            top.insert(result, score: result.score, ordinal: result.record)
+            return top.minimumScore
+        }
+        return top.sortedElements()
+    }
+
+    /// Returns every matching record of a multi-field corpus, sorted by score descending.
+    ///
+    /// Records are scored as in ``topMatches(_:against:weights:limit:)``. Records
+    /// with equal scores are listed in ascending record order.
+    ///
+    /// - Parameters:
+    ///   - corpus: The corpus to search.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - weights: One non-negative weight per field, or `nil` to weigh every field
+    ///     `1.0`. Default is `nil`.
+    /// - Returns: An array of ``MultiFieldMatchResult`` sorted by score descending.
+    public func matches(
+        _ corpus: MultiFieldCorpus,
+        against query: FuzzyQuery,
+        weights: [Double]? = nil
+    ) -> [MultiFieldMatchResult] {
+        var results: [MultiFieldMatchResult] = []
+        forEachMultiFieldMatch(corpus, against: query, weights: weights) { result in
+            results.append(result)
+            return nil
+        }
+        results.sort { $0.score != $1.score ? $0.score > $1.score : $0.record < $1.record }
+        return results
+    }
+
+    /// Scores every record with at least one surviving field and passes the records
+    /// that match to `body`, in ascending record order.
+    ///
+    /// `body` returns the score floor for the following records, or `nil` for none;
+    /// a record whose weighted score would fall below it may be dropped without
+    /// running the alignment phases.
+    @inlinable
+    internal func forEachMultiFieldMatch(
+        _ corpus: MultiFieldCorpus,
+        against query: FuzzyQuery,
+        weights: [Double]?,
+        _ body: (MultiFieldMatchResult) -> Double?
+    ) {
+        let fieldCount = corpus.fieldCount
+        let weights = weights ?? [Double](repeating: 1.0, count: fieldCount)
+        precondition(weights.count == fieldCount, "weights must have one entry per field")
+        precondition(weights.allSatisfy { $0 >= 0 }, "weights must not be negative")
+
+        var survivors = [[UInt32]](repeating: [], count: fieldCount)
+        for field in 0..<fieldCount where weights[field] > 0 {
+            corpus.fields[field].collectPrefilterSurvivors(for: query, into: &survivors[field])
+        }
+
+        var buffer = makeBuffer()
+        var cursors = [Int](repeating: 0, count: fieldCount)
+        var recordFloor = -Double.infinity
+        while true {
+            // Next record in any field's survivor list
+            var record = Int.max
+            for field in 0..<fieldCount where cursors[field] < survivors[field].count {
+                record = min(record, Int(survivors[field][cursors[field]]))
+            }
+            if record == Int.max { break }
+
+            var best: MultiFieldMatchResult?
+            for field in 0..<fieldCount
+            where cursors[field] < survivors[field].count && Int(survivors[field][cursors[field]]) == record {
+                cursors[field] += 1
+                let weight = weights[field]
+                let floor = max(recordFloor, best?.score ?? -.infinity) / weight
+                guard let match = score(corpus.fields[field], at: record, against: query, buffer: &buffer, scoreFloor: floor) else {
+                    continue
+                }
+                let weighted = match.score * weight
+                if weighted > best?.score ?? -.infinity {
+                    best = MultiFieldMatchResult(record: record, field: field, match: match, score: weighted)
+                }
+            }
+            if let best {
+                recordFloor = body(best) ?? -.infinity
+            }
+        }
+    }
+}
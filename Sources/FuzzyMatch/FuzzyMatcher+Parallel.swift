@@ -0,0 +1,162 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+extension FuzzyMatcher {
+    // MARK: - Parallel Top-K
+
+    /// Minimum number of candidates per worker. Below this, task creation and the
+    /// merge cost more than the scoring they parallelize.
+    @usableFromInline
+    internal static let minimumCandidatesPerWorker = 2_048
+
+    /// Number of workers to use for `count` candidates with at most `concurrency` tasks.
+    @inlinable
+    internal static func workerCount(forCandidates count: Int, concurrency: Int) -> Int {
+        max(1, min(concurrency, count / minimumCandidatesPerWorker))
+    }
+
+    /// Returns the top matches from a collection of candidates, scoring chunks of the
+    /// collection concurrently.
+    ///
+    /// The collection is split into up to `concurrency` contiguous chunks. Each chunk is
+    /// scored by its own child task with its own ``ScoringBuffer`` and bounded top-K list,
+    /// and the per-worker lists are merged at the end. Ties are broken by position in
+    /// `candidates`, so results are identical to ``topMatches(_:against:limit:)-7q3wo``.
+    ///
+    /// Small collections are scored on the calling task.
+    ///
+    /// - Parameters:
+    ///   - candidates: The candidates to search.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - limit: Maximum number of results to return. Default is `10`.
+    ///   - concurrency: Maximum number of concurrent scoring tasks, typically the
+    ///     number of available cores.
+    /// - Returns: An array of ``MatchResult`` sorted by score descending,
+    ///   containing at most `limit` elements.
+    ///
+    /// ## Example
+    ///
+    /// ```swift
+    /// let matcher = FuzzyMatcher()
+    /// let query = matcher.prepare("apple")
+    /// let results = await matcher.topMatches(
+    ///     instruments,
+    ///     against: query,
+    ///     limit: 10,
+    ///     concurrency: ProcessInfo.processInfo.activeProcessorCount
+    /// )
+    /// ```
+    public func topMatches<Candidates: RandomAccessCollection & Sendable>(
+        _ candidates: Candidates,
+        against query: FuzzyQuery,
+        limit: Int = 10,
+        concurrency: Int
+    ) async -> [MatchResult] where Candidates.Element == String {
+        guard limit > 0 else { return [] }
+        let count = candidates.count
+        let workers = Self.workerCount(forCandidates: count, concurrency: concurrency)
+        if workers == 1 {
+            return topMatches(candidates, against: query, limit: limit)
+        }
+
+        let chunkSize = (count + workers - 1) / workers
+        return await withTaskGroup(of: TopKCollector<MatchResult>.self) { group in
+            for chunkStart in stride(from: 0, to: count, by: chunkSize) {
+                let chunkEnd = min(chunkStart + chunkSize, count)
+                group.addTask {
+                    let lower = candidates.index(candidates.startIndex, offsetBy: chunkStart)
+                    let upper = candidates.index(lower, offsetBy: chunkEnd - chunkStart)
+                    var top = TopKCollector<MatchResult>(limit: limit)
+                    self.collectTopMatches(candidates[lower..<upper], firstOrdinal: chunkStart, against: query, into: &top)
+                    return top
+                }
+            }
+
+            var merged = TopKCollector<MatchResult>(limit: limit)
+            for await partial in group {
+                merged.merge(partial)
+            }
+            return merged.sortedElements()
+        }
+    }
+
+    /// Returns the top matches from a prebuilt corpus, scoring chunks of it concurrently.
+    ///
+    /// The vectorized prefilter sweep runs once on the calling task; the surviving
+    /// indices are then split into up to `concurrency` chunks, each scored by its own
+    /// child task with its own ``ScoringBuffer`` and bounded top-K list, and the
+    /// per-worker lists are merged at the end. Ties are broken by corpus index, so
+    /// results are identical to the sequential corpus `topMatches`.
+    ///
+    /// - Parameters:
+    ///   - corpus: The corpus to search.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - limit: Maximum number of results to return. Default is `10`.
+    ///   - concurrency: Maximum number of concurrent scoring tasks.
+    /// - Returns: An array of ``MatchResult`` sorted by score descending,
+    ///   containing at most `limit` elements.
+    public func topMatches(
+        _ corpus: FuzzyCorpus,
+        against query: FuzzyQuery,
+        limit: Int = 10,
+        concurrency: Int
+    ) async -> [MatchResult] {
+        await collectTopMatches(corpus, against: query, limit: limit, concurrency: concurrency).sortedElements()
+    }
+
+    /// Runs the parallel corpus search and returns the merged collector, whose
+    /// ordinals are `firstOrdinal` plus the corpus index.
+    internal func collectTopMatches(
+        _ corpus: FuzzyCorpus,
+        against query: FuzzyQuery,
+        limit: Int,
+        firstOrdinal: Int = 0,
+        concurrency: Int
+    ) async -> TopKCollector<MatchResult> {
+        guard limit > 0 else { return TopKCollector(limit: 0) }
+        var survivors: [UInt32] = []
+        corpus.collectPrefilterSurvivors(for: query, into: &survivors)
+
+        let count = survivors.count
+        let workers = Self.workerCount(forCandidates: count, concurrency: concurrency)
+        if workers == 1 {
+            var top = TopKCollector<MatchResult>(limit: limit)
+            collectTopMatches(corpus, indices: survivors, against: query, into: &top, firstOrdinal: firstOrdinal)
+            return top
+        }
+
+        let chunkSize = (count + workers - 1) / workers
+        return await withTaskGroup(of: TopKCollector<MatchResult>.self) { [survivors] group in
+            for chunkStart in stride(from: 0, to: count, by: chunkSize) {
+                let chunkEnd = min(chunkStart + chunkSize, count)
+                group.addTask {
+                    var top = TopKCollector<MatchResult>(limit: limit)
+                    self.collectTopMatches(
+                        corpus,
+                        indices: survivors[chunkStart..<chunkEnd],
+                        against: query,
+                        into: &top,
+                        firstOrdinal: firstOrdinal
+                    )
+                    return top
+                }
+            }
+
+            var merged = TopKCollector<MatchResult>(limit: limit)
+            for await partial in group {
+                merged.merge(partial)
+            }
+            return merged
+        }
+    }
+}
@@ -0,0 +1,158 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+/// Slack subtracted from a score floor before comparing it with an upper bound, so
+/// rounding in the bound can never reject a candidate that ties the floor.
+@usableFromInline
+let scoreBoundTolerance = 1e-9
+
+extension FuzzyMatcher {
+    // MARK: - Score Upper Bound
+
+    /// Upper bound on the edit distance score of a lowercased, non-exact candidate.
+    ///
+    /// Evaluates every scoring phase with the parts that need an alignment replaced
+    /// by their largest possible value, using only linear-time work: the prefix and
+    /// substring edit distances (bit-parallel for queries up to 64 bytes), one greedy
+    /// subsequence scan, and the boundary mask popcount.
+    ///
+    /// - **Prefix / substring**: The base score from the edit distance, plus the
+    ///   largest alignment bonus the phase can add. That bonus is the smaller of the
+    ///   phase's cap and the most the configuration can award: a boundary bonus per
+    ///   boundary the query can land on, a consecutive bonus per query step, and the
+    ///   full first-match bonus. The length penalty and its recoveries are applied
+    ///   the same way the phase applies them.
+    /// - **Subsequence**: Any alignment ends no earlier than the greedy leftmost
+    ///   embedding, which bounds the gap ratio from below.
+    /// - **Acronym**: The initials count is at least the boundary popcount (and at
+    ///   least the query length), which bounds coverage from above.
+    ///
+    /// Each step is monotone in the quantity it bounds, so the result is never below
+    /// the score the phase pipeline returns. Returns `-infinity` when no phase can
+    /// match, and `+infinity` when a negative gap penalty lets gaps add bonus.
+    @inlinable
+    internal func edScoreUpperBound(
+        querySpan: Span<UInt8>,
+        candidateSpan: Span<UInt8>,
+        boundaryMask: UInt64,
+        query: FuzzyQuery,
+        edConfig: EditDistanceConfig,
+        editDistanceState: inout EditDistanceState
+    ) -> Double {
+        let queryLength = querySpan.count
+        let candidateLength = candidateSpan.count
+
+        let needsAlignment = query.needsAlignment
+
+        // Largest bonus any alignment can collect
+        var maxBonus = 0.0
+        if needsAlignment {
+            if query.hasNegativeGapPenalty { return .infinity }
+            let boundaryCount = candidateLength <= 64 ? boundaryMask.nonzeroBitCount : candidateLength
+            maxBonus = Double(min(queryLength, boundaryCount)) * max(0, edConfig.wordBoundaryBonus)
+                + Double(queryLength - 1) * max(0, edConfig.consecutiveBonus)
+                + max(0, edConfig.firstMatchBonus)
+        }
+
+        let lengthPenalty = candidateLength > queryLength
+            ? Double(candidateLength - queryLength) * edConfig.lengthPenalty
+            : 0.0
+        var bound = -Double.infinity
+
+        // Phase 3: Prefix
+        let prefixDistance = boundedPrefixDistance(
+            querySpan: querySpan,
+            candidateSpan: candidateSpan,
+            query: query,
+            editDistanceState: &editDistanceState
+        )
+        if let distance = prefixDistance, !(queryLength <= 3 && distance > 0 && candidateLength != queryLength) {
+            var score = normalizedScore(editDistance: distance, queryLength: queryLength, kind: .prefix, config: edConfig)
+            if candidateLength == queryLength && distance > 0 {
+                score += (1.0 - score) * 0.7
+            }
+            score = addingMaxBonus(maxBonus, to: score, distance: distance, needsAlignment: needsAlignment)
+            if candidateLength > queryLength {
+                score -= lengthPenalty
+                if distance == 0 {
+                    score += min(lengthPenalty * 0.9, 0.15)
+                }
+            }
+            bound = max(bound, min(score, 1.0))
+        }
+
+        // Phase 4: Substring (skipped by the scorer after an exact prefix)
+        if prefixDistance != 0,
+            let distance = boundedSubstringDistance(
+                querySpan: querySpan,
+                candidateSpan: candidateSpan,
+                query: query,
+                editDistanceState: &editDistanceState
+            ),
+            !(queryLength <= 3 && distance > 0 && candidateLength != queryLength) {
+            var score = normalizedScore(editDistance: distance, queryLength: queryLength, kind: .substring, config: edConfig)
+            score = addingMaxBonus(maxBonus, to: score, distance: distance, needsAlignment: needsAlignment)
+            if candidateLength > queryLength {
+                score -= lengthPenalty
+                if distance == 0 {
+                    score += min(lengthPenalty * 0.8, 0.15)
+                }
+            }
+            bound = max(bound, min(score, 1.0))
+        }
+
+        // Phase 5: Subsequence, bounded by the greedy leftmost embedding
+        var qi = 0
+        var greedyEnd = -1
+        for ci in 0..<candidateLength where candidateSpan[ci] == querySpan[qi] {
+            qi &+= 1
+            if qi == queryLength {
+                greedyEnd = ci
+                break
+            }
+        }
+        if greedyEnd >= 0 {
+            let minGaps = greedyEnd + 1 - queryLength
+            let gapRatio = Double(minGaps) / Double(candidateLength)
+            var score = max(0.3, 1.0 - gapRatio)
+            score *= edConfig.substringWeight
+            score += min(maxBonus, (1.0 - score) * 0.8)
+            if candidateLength > queryLength {
+                score -= lengthPenalty
+            }
+            bound = max(bound, score)
+        }
+
+        // Phase 6: Acronym
+        if queryLength >= 2 && queryLength <= 8 {
+            let boundaryCount = boundaryMask.nonzeroBitCount
+            if candidateLength > 64 || (boundaryCount >= 3 && boundaryCount >= queryLength) {
+                let minInitials = max(boundaryCount, queryLength, 3)
+                let coverage = Double(queryLength) / Double(minInitials)
+                bound = max(bound, (0.55 + 0.4 * coverage) * edConfig.acronymWeight)
+            }
+        }
+
+        return bound
+    }
+
+    /// Adds the largest alignment bonus a prefix or substring phase can apply to `score`.
+    @inlinable
+    internal func addingMaxBonus(_ maxBonus: Double, to score: Double, distance: Int, needsAlignment: Bool) -> Double {
+        guard needsAlignment else { return score }
+        if distance > 0 {
+            return score + min(maxBonus, (1.0 - score) * 0.8)
+        }
+        return min(score + maxBonus, 1.0)
+    }
+}
@@ -0,0 +1,116 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+extension FuzzyMatcher {
+    // MARK: - Segmented Corpus Search
+
+    /// Returns the top matches from a view of a ``LiveCorpus``, sorted by score descending.
+    ///
+    /// Runs the corpus prefilter sweep over the base and the delta segments, skips
+    /// deleted base candidates, and scores the survivors of both into one collector.
+    /// Results are identical to the corpus `topMatches(_:against:limit:)` over a
+    /// ``FuzzyCorpus`` built from `corpus.candidates`.
+    ///
+    /// - Parameters:
+    ///   - corpus: The view to search, typically ``LiveCorpus/current``.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - limit: Maximum number of results to return. Default is `10`.
+    /// - Returns: An array of ``MatchResult`` sorted by score descending,
+    ///   containing at most `limit` elements.
+    public func topMatches(
+        _ corpus: SegmentedCorpus,
+        against query: FuzzyQuery,
+        limit: Int = 10
+    ) -> [MatchResult] {
+        var top = TopKCollector<MatchResult>(limit: limit)
+        collectTopMatches(corpus, against: query, into: &top) { segment, row, _, match in
+            MatchResult(candidate: segment[row], match: match)
+        }
+        return top.sortedElements()
+    }
+
+    /// Returns the ids of the top matches from a view of a ``LiveCorpus``, sorted by
+    /// score descending.
+    ///
+    /// Same ranking as `topMatches(_:against:limit:)` for the view, but each result
+    /// holds the candidate's id instead of a decoded `String`. Use
+    /// `corpus[id: result.item]` to decode one when it is needed.
+    ///
+    /// - Parameters:
+    ///   - corpus: The view to search, typically ``LiveCorpus/current``.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - limit: Maximum number of results to return. Default is `10`.
+    /// - Returns: An array of ``ItemMatchResult`` whose items are candidate ids,
+    ///   sorted by score descending and containing at most `limit` elements.
+    public func topMatchIDs(
+        _ corpus: SegmentedCorpus,
+        against query: FuzzyQuery,
+        limit: Int = 10
+    ) -> [ItemMatchResult<Int>] {
+        var top = TopKCollector<ItemMatchResult<Int>>(limit: limit)
+        collectTopMatches(corpus, against: query, into: &top) { _, _, id, match in
+            ItemMatchResult(item: id, match: match)
+        }
+        return top.sortedElements()
+    }
+
+    /// Returns the top matches from a view of a ``LiveCorpus``, answering repeated
+    /// queries from `cache`.
+    ///
+    /// Entries are keyed on the view's ``SegmentedCorpus/generation``, so results
+    /// cached before an append, removal or compaction are never returned afterwards.
+    ///
+    /// - Parameters:
+    ///   - corpus: The view to search, typically ``LiveCorpus/current``.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - limit: Maximum number of results to return. Default is `10`.
+    ///   - cache: The cache to consult and fill.
+    /// - Returns: An array of ``MatchResult`` sorted by score descending,
+    ///   containing at most `limit` elements.
+    public func topMatches(
+        _ corpus: SegmentedCorpus,
+        against query: FuzzyQuery,
+        limit: Int = 10,
+        cache: FuzzyResultCache
+    ) -> [MatchResult] {
+        let key = FuzzyResultCache.Key(query: query, limit: limit, generation: corpus.generation)
+        return cache.results(for: key) {
+            topMatches(corpus, against: query, limit: limit)
+        }
+    }
+
+    /// Scores the live candidates of both segments into `top`, building each retained
+    /// element with `makeElement(segment, row, id, match)`.
+    ///
+    /// Base rows take ordinals `0..<base.count` and delta rows follow them. Ids
+    /// ascend through both segments in the same order, so ties go to the lower id.
+    internal func collectTopMatches<Element>(
+        _ corpus: SegmentedCorpus,
+        against query: FuzzyQuery,
+        into top: inout TopKCollector<Element>,
+        makeElement: (FuzzyCorpus, Int, Int, ScoredMatch) -> Element
+    ) {
+        var survivors: [UInt32] = []
+        corpus.base.collectPrefilterSurvivors(for: query, into: &survivors)
+        corpus.removeDeletedBaseRows(from: &survivors)
+        collectTopMatches(corpus.base, indices: survivors, against: query, into: &top) { row, match in
+            makeElement(corpus.base, row, corpus.baseIDs[row], match)
+        }
+
+        survivors.removeAll(keepingCapacity: true)
+        corpus.delta.collectPrefilterSurvivors(for: query, into: &survivors)
+        collectTopMatches(corpus.delta, indices: survivors, against: query, into: &top, firstOrdinal: corpus.base.count) { row, match in
+            makeElement(corpus.delta, row, corpus.deltaIDs[row], match)
+        }
+    }
+}
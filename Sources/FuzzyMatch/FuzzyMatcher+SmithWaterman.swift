@@ -31,7 +31,8 @@ extension FuzzyMatcher {
         swConfig: SmithWatermanConfig,
         candidateStorage: inout CandidateStorage,
         smithWatermanState: inout SmithWatermanState,
-        wordInitials: inout [UInt8]
+        wordInitials: inout [UInt8],
+        statistics: inout ScoringStatistics
     ) -> ScoredMatch? {
         let candidateLength = candidateUTF8.count
         let queryLength = query.lowercased.count
@@ -49,6 +50,7 @@ extension FuzzyMatcher {
         smithWatermanState.ensureCapacity(queryLength)
 
         // Bitmask prefilter with O(1) ASCII detection (tolerance 0)
+        statistics.enter(.bitmask)
         let (candidateMask, candidateIsASCII) = computeCharBitmaskWithASCIICheck(candidateUTF8)
         if !passesCharBitmask(
             queryMask: query.charBitmask,
@@ -57,8 +59,190 @@ extension FuzzyMatcher {
         ) {
             return nil
         }
+        statistics.pass(.bitmask)
 
+        statistics.enter(.lowercase)
+        let actualCandidateLength = lowercaseWithSmithWatermanBonuses(
+            candidateUTF8,
+            isASCII: candidateIsASCII,
+            swConfig: swConfig,
+            candidateStorage: &candidateStorage
+        )
         let sw = swConfig
+
+        let candidateSpan = candidateStorage.bytes.span.extracting(0..<actualCandidateLength)
+        let bonusSpan = candidateStorage.bonus.span.extracting(0..<actualCandidateLength)
+        statistics.pass(.lowercase)
+
+        // Exact match early exit (before atom split so multi-word self-matches return .exact)
+        statistics.enter(.exactMatch)
+        if actualCandidateLength == queryLength {
+            var isExact = true
+            for i in 0..<queryLength {
+                if candidateStorage.bytes[i] != query.lowercased[i] {
+                    isExact = false
+                    break
+                }
+            }
+            if isExact {
+                return ScoredMatch(score: 1.0, kind: .exact)
+            }
+        }
+        statistics.pass(.exactMatch)
+
+        statistics.enter(.smithWaterman)
+        if query.atoms.count > 1 {
+            // Multi-atom path: score each word independently, AND semantics
+            var totalRawScore: Int32 = 0
+            for atom in query.atoms {
+                let atomQuery = query.lowercased.span.extracting(
+                    atom.start..<(atom.start + atom.length)
+                )
+                let atomScore = smithWatermanScore(
+                    query: atomQuery,
+                    candidate: candidateSpan,
+                    bonus: bonusSpan,
+                    state: &smithWatermanState,
+                    config: sw
+                )
+                if atomScore <= 0 {
+                    return nil
+                }
+                totalRawScore += atomScore
+            }
+
+            let match = finishSmithWatermanMultiAtomScore(totalRawScore: totalRawScore, against: query)
+            if match != nil {
+                statistics.pass(.smithWaterman)
+            }
+            return match
+        }
+
+        // Single-word path
+        let querySpan = query.lowercased.span
+
+        // Run Smith-Waterman DP with precomputed bonus array
+        let rawScore = smithWatermanScore(
+            query: querySpan,
+            candidate: candidateSpan,
+            bonus: bonusSpan,
+            state: &smithWatermanState,
+            config: sw
+        )
+
+        let match = finishSmithWatermanScore(
+            rawScore: rawScore,
+            candidateUTF8: candidateUTF8,
+            candidateIsASCII: candidateIsASCII,
+            candidateSpan: candidateSpan,
+            against: query,
+            wordInitials: &wordInitials
+        )
+        if match != nil {
+            statistics.pass(.smithWaterman)
+        }
+        return match
+    }
+
+    /// Turns a single-word raw Smith-Waterman score into the final match: normalizes
+    /// it, lets the acronym matcher compete for short queries, and applies `minScore`.
+    @inlinable
+    internal func finishSmithWatermanScore(
+        rawScore: Int32,
+        candidateUTF8: Span<UInt8>,
+        candidateIsASCII: Bool,
+        candidateSpan: Span<UInt8>,
+        against query: FuzzyQuery,
+        wordInitials: inout [UInt8]
+    ) -> ScoredMatch? {
+        let queryLength = query.lowercased.count
+        let actualCandidateLength = candidateSpan.count
+        let querySpan = query.lowercased.span
+
+        // Compute best SW score
+        var bestScore: Double = -1
+        var bestKind: MatchKind = .alignment
+
+        if rawScore > 0 {
+            let maxScore = query.maxSmithWatermanScore
+            if maxScore > 0 {
+                let normalizedScore = min(1.0, max(0.0, Double(rawScore) / Double(maxScore)))
+                if normalizedScore >= query.config.minScore {
+                    bestScore = normalizedScore
+                }
+            }
+        }
+
+        // Acronym fallback: compete with SW score for short queries (2-8 chars)
+        if queryLength >= 2 && queryLength <= 8 {
+            let boundaryMask = computeBoundaryMaskCompressed(originalBytes: candidateUTF8, isASCII: candidateIsASCII)
+            var wordCount = boundaryMask.nonzeroBitCount
+            if actualCandidateLength > 64 {
+                for i in 64..<actualCandidateLength {
+                    if isWordBoundary(at: i, in: candidateSpan) {
+                        wordCount += 1
+                    }
+                }
+            }
+            if wordCount >= 3 && wordCount >= queryLength {
+                var acronymState = ScoringState()
+                acronymState.boundaryMask = boundaryMask
+                acronymState.bestScore = bestScore
+
+                scoreAcronym(
+                    querySpan: querySpan,
+                    candidateSpan: candidateSpan,
+                    candidateUTF8: candidateUTF8,
+                    query: query,
+                    candidateLength: actualCandidateLength,
+                    acronymWeight: 1.0,
+                    state: &acronymState,
+                    wordInitials: &wordInitials
+                )
+
+                if acronymState.bestScore > bestScore {
+                    bestScore = acronymState.bestScore
+                    bestKind = acronymState.bestKind
+                }
+            }
+        }
+
+        if bestScore >= query.config.minScore {
+            return ScoredMatch(score: bestScore, kind: bestKind)
+        }
+
+        return nil
+    }
+
+    /// Normalizes the summed atom scores of a multi-word query and applies `minScore`.
+    @inlinable
+    internal func finishSmithWatermanMultiAtomScore(totalRawScore: Int32, against query: FuzzyQuery) -> ScoredMatch? {
+        let maxScore = query.maxSmithWatermanScore
+        guard maxScore > 0 else { return nil }
+        let normalizedScore = min(1.0, max(0.0, Double(totalRawScore) / Double(maxScore)))
+        if normalizedScore >= query.config.minScore {
+            return ScoredMatch(score: normalizedScore, kind: .alignment)
+        }
+        return nil
+    }
+
+    /// Lowercases a candidate into `candidateStorage.bytes` and fills
+    /// `candidateStorage.bonus` with the tiered per-position Smith-Waterman bonuses.
+    ///
+    /// The caller must have ensured `candidateStorage` holds at least
+    /// `candidateUTF8.count` bytes.
+    ///
+    /// - Returns: The lowercased length (combining marks and Latin-1 diacritics may
+    ///   shorten the candidate).
+    @inlinable
+    internal func lowercaseWithSmithWatermanBonuses(
+        _ candidateUTF8: Span<UInt8>,
+        isASCII candidateIsASCII: Bool,
+        swConfig: SmithWatermanConfig,
+        candidateStorage: inout CandidateStorage
+    ) -> Int {
+        let sw = swConfig
+        let candidateLength = candidateUTF8.count
         let bonusBoundaryVal = Int32(sw.bonusBoundary)
         let bonusBoundaryWhitespaceVal = Int32(sw.bonusBoundaryWhitespace)
         let bonusBoundaryDelimiterVal = Int32(sw.bonusBoundaryDelimiter)
@@ -267,117 +451,6 @@ extension FuzzyMatcher {
             }
             actualCandidateLength = outIdx
         }
-
-        let candidateSpan = candidateStorage.bytes.span.extracting(0..<actualCandidateLength)
-        let bonusSpan = candidateStorage.bonus.span.extracting(0..<actualCandidateLength)
-
-        // Exact match early exit (before atom split so multi-word self-matches return .exact)
-        if actualCandidateLength == queryLength {
-            var isExact = true
-            for i in 0..<queryLength {
-                if candidateStorage.bytes[i] != query.lowercased[i] {
-                    isExact = false
-                    break
-                }
-            }
-            if isExact {
-                return ScoredMatch(score: 1.0, kind: .exact)
-            }
-        }
-
-        if query.atoms.count > 1 {
-            // Multi-atom path: score each word independently, AND semantics
-            var totalRawScore: Int32 = 0
-            for atom in query.atoms {
-                let atomQuery = query.lowercased.span.extracting(
-                    atom.start..<(atom.start + atom.length)
-                )
-                let atomScore = smithWatermanScore(
-                    query: atomQuery,
-                    candidate: candidateSpan,
-                    bonus: bonusSpan,
-                    state: &smithWatermanState,
-                    config: sw
-                )
-                if atomScore <= 0 {
-                    return nil
-                }
-                totalRawScore += atomScore
-            }
-
-            let maxScore = query.maxSmithWatermanScore
-            guard maxScore > 0 else { return nil }
-            let normalizedScore = min(1.0, max(0.0, Double(totalRawScore) / Double(maxScore)))
-            if normalizedScore >= query.config.minScore {
-                return ScoredMatch(score: normalizedScore, kind: .alignment)
-            }
-            return nil
-        }
-
-        // Single-word path
-        let querySpan = query.lowercased.span
-
-        // Run Smith-Waterman DP with precomputed bonus array
-        let rawScore = smithWatermanScore(
-            query: querySpan,
-            candidate: candidateSpan,
-            bonus: bonusSpan,
-            state: &smithWatermanState,
-            config: sw
-        )
-
-        // Compute best SW score
-        var bestScore: Double = -1
-        var bestKind: MatchKind = .alignment
-
-        if rawScore > 0 {
-            let maxScore = query.maxSmithWatermanScore
-            if maxScore > 0 {
-                let normalizedScore = min(1.0, max(0.0, Double(rawScore) / Double(maxScore)))
-                if normalizedScore >= query.config.minScore {
-                    bestScore = normalizedScore
-                }
-            }
-        }
-
-        // Acronym fallback: compete with SW score for short queries (2-8 chars)
-        if queryLength >= 2 && queryLength <= 8 {
-            let boundaryMask = computeBoundaryMaskCompressed(originalBytes: candidateUTF8, isASCII: candidateIsASCII)
-            var wordCount = boundaryMask.nonzeroBitCount
-            if actualCandidateLength > 64 {
-                for i in 64..<actualCandidateLength {
-                    if isWordBoundary(at: i, in: candidateSpan) {
-                        wordCount += 1
-                    }
-                }
-            }
-            if wordCount >= 3 && wordCount >= queryLength {
-                var acronymState = ScoringState()
-                acronymState.boundaryMask = boundaryMask
-                acronymState.bestScore = bestScore
-
-                scoreAcronym(
-                    querySpan: querySpan,
-                    candidateSpan: candidateSpan,
-                    candidateUTF8: candidateUTF8,
-                    query: query,
-                    candidateLength: actualCandidateLength,
-                    acronymWeight: 1.0,
-                    state: &acronymState,
-                    wordInitials: &wordInitials
-                )
-
-                if acronymState.bestScore > bestScore {
-                    bestScore = acronymState.bestScore
-                    bestKind = acronymState.bestKind
-                }
-            }
-        }
-
-        if bestScore >= query.config.minScore {
-            return ScoredMatch(score: bestScore, kind: bestKind)
-        }
-
-        return nil
+        return actualCandidateLength
     }
 }
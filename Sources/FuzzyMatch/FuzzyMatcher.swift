@@ -223,6 +223,19 @@ public struct FuzzyMatcher: Sendable {
         ScoringBuffer()
     }
 
+    /// Creates a fixed-capacity scoring buffer that never allocates for inputs
+    /// within the given lengths.
+    ///
+    /// See ``ScoringBuffer/init(maxQueryLength:maxCandidateLength:)``.
+    ///
+    /// - Parameters:
+    ///   - maxQueryLength: Longest prepared query, in lowercased UTF-8 bytes.
+    ///   - maxCandidateLength: Longest candidate, in UTF-8 bytes.
+    /// - Returns: A new ``ScoringBuffer`` with every scoring state preallocated.
+    public func makeBuffer(maxQueryLength: Int, maxCandidateLength: Int) -> ScoringBuffer {
+        ScoringBuffer(maxQueryLength: maxQueryLength, maxCandidateLength: maxCandidateLength)
+    }
+
     /// Scores a candidate string against a prepared query.
     ///
     /// This is the primary hot-path method optimized for performance:
@@ -274,22 +287,84 @@ public struct FuzzyMatcher: Sendable {
         _ candidate: String,
         against query: FuzzyQuery,
         buffer: inout ScoringBuffer
+    ) -> ScoredMatch? {
+        score(candidate, against: query, buffer: &buffer, scoreFloor: -.infinity)
+    }
+
+    /// Scores a candidate, allowing an early `nil` for candidates that cannot reach
+    /// `scoreFloor`.
+    ///
+    /// Returns the same result as ``score(_:against:buffer:)``, except that edit distance
+    /// scoring may return `nil` without running the alignment phases when
+    /// ``edScoreUpperBound(querySpan:candidateSpan:boundaryMask:query:edConfig:editDistanceState:)``
+    /// proves the score is below `scoreFloor`. Top-K collection passes its current
+    /// ``TopKCollector/minimumScore`` here.
+    @inlinable
+    internal func score(
+        _ candidate: String,
+        against query: FuzzyQuery,
+        buffer: inout ScoringBuffer,
+        scoreFloor: Double
+    ) -> ScoredMatch? {
+        score(utf8: candidate.utf8.span, against: query, buffer: &buffer, scoreFloor: scoreFloor)
+    }
+
+    /// Scores a candidate given as UTF-8 bytes against a prepared query.
+    ///
+    /// For valid UTF-8, produces exactly the same result as ``score(_:against:buffer:)``
+    /// with the `String` those bytes decode to. Use it to score candidates stored in a byte
+    /// arena (a memory-mapped file, a network buffer) without creating a `String`
+    /// per candidate; to search a whole arena, build a ``FuzzyCorpus`` with
+    /// ``FuzzyCorpus/init(utf8:offsets:buildTrigramIndex:)``.
+    ///
+    /// - Parameters:
+    ///   - candidate: The candidate's UTF-8 bytes.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - buffer: A reusable scoring buffer from ``makeBuffer()``.
+    /// - Returns: A ``ScoredMatch`` if the candidate matches, or `nil`.
+    ///
+    /// ## Example
+    ///
+    /// ```swift
+    /// let arena: [UInt8] = Array("getUserById".utf8)
+    /// if let match = matcher.score(utf8: arena.span, against: query, buffer: &buffer) {
+    ///     print(match.score)
+    /// }
+    /// ```
+    public func score(
+        utf8 candidate: Span<UInt8>,
+        against query: FuzzyQuery,
+        buffer: inout ScoringBuffer
+    ) -> ScoredMatch? {
+        score(utf8: candidate, against: query, buffer: &buffer, scoreFloor: -.infinity)
+    }
+
+    /// Scores UTF-8 candidate bytes with a score floor (see ``score(_:against:buffer:scoreFloor:)``).
+    @inlinable
+    internal func score(
+        utf8 candidate: Span<UInt8>,
+        against query: FuzzyQuery,
+        buffer: inout ScoringBuffer,
+        scoreFloor: Double
     ) -> ScoredMatch? {
         // Record usage for shrink policy
         buffer.recordUsage(
             queryLength: query.lowercased.count,
-            candidateLength: candidate.utf8.count
+            candidateLength: candidate.count
         )
+        buffer.statistics.beginCandidate()
+        let result: ScoredMatch?
         // Dispatch based on matching algorithm
         switch query.config.algorithm {
         case .smithWaterman(let swConfig):
-            return scoreSmithWatermanImpl(
-                candidate.utf8.span,
+            result = scoreSmithWatermanImpl(
+                candidate,
                 against: query,
                 swConfig: swConfig,
                 candidateStorage: &buffer.candidateStorage,
                 smithWatermanState: &buffer.smithWatermanState,
-                wordInitials: &buffer.wordInitials
+                wordInitials: &buffer.wordInitials,
+                statistics: &buffer.statistics
             )
 
         case .editDistance(let edConfig):
@@ -297,27 +372,31 @@ public struct FuzzyMatcher: Sendable {
             // Skip for multi-byte queries (e.g. Latin Extended "à" = 2 UTF-8 bytes).
             let queryLength = query.lowercased.count
             if queryLength == 1 {
-                return scoreTinyQuery1(
-                    candidate.utf8.span,
-                    candidateLength: candidate.utf8.count,
+                result = scoreTinyQuery1(
+                    candidate,
+                    candidateLength: candidate.count,
                     q0: query.lowercased[0],
                     edConfig: edConfig,
                     minScore: query.config.minScore
                 )
+            } else {
+                // Pass components separately to avoid exclusivity conflicts with Span borrowing
+                result = scoreImpl(
+                    candidate,
+                    against: query,
+                    edConfig: edConfig,
+                    candidateStorage: &buffer.candidateStorage,
+                    editDistanceState: &buffer.editDistanceState,
+                    matchPositions: &buffer.matchPositions,
+                    alignmentState: &buffer.alignmentState,
+                    wordInitials: &buffer.wordInitials,
+                    statistics: &buffer.statistics,
+                    scoreFloor: scoreFloor
+                )
             }
-
-            // Pass components separately to avoid exclusivity conflicts with Span borrowing
-            return scoreImpl(
-                candidate.utf8.span,
-                against: query,
-                edConfig: edConfig,
-                candidateStorage: &buffer.candidateStorage,
-                editDistanceState: &buffer.editDistanceState,
-                matchPositions: &buffer.matchPositions,
-                alignmentState: &buffer.alignmentState,
-                wordInitials: &buffer.wordInitials
-            )
         }
+        buffer.statistics.endCandidate(matched: result != nil)
+        return result
     }
 
     // MARK: - Scoring State
@@ -353,7 +432,9 @@ public struct FuzzyMatcher: Sendable {
         editDistanceState: inout EditDistanceState,
         matchPositions: inout [Int],
         alignmentState: inout AlignmentState,
-        wordInitials: inout [UInt8]
+        wordInitials: inout [UInt8],
+        statistics: inout ScoringStatistics,
+        scoreFloor: Double = -.infinity
     ) -> ScoredMatch? {
         let candidateLength = candidateUTF8.count
         let queryLength = query.lowercased.count
@@ -367,12 +448,15 @@ public struct FuzzyMatcher: Sendable {
         }
 
         // Prefilter 1: Length bounds (uses precomputed minCandidateLength)
+        statistics.enter(.lengthBounds)
         if candidateLength < query.minCandidateLength {
             return nil
         }
+        statistics.pass(.lengthBounds)
 
         // Prefilter 2: Character bitmask — check BEFORE lowercasing to reject early
         // Combined bitmask + ASCII detection in a single O(n) pass (eliminates separate ASCII scan)
+        statistics.enter(.bitmask)
         let (candidateMask, candidateIsASCII) = computeCharBitmaskWithASCIICheck(candidateUTF8)
         if !passesCharBitmask(
             queryMask: query.charBitmask,
@@ -381,10 +465,10 @@ public struct FuzzyMatcher: Sendable {
         ) {
             return nil
         }
-
-        let effectiveMaxEditDistance = query.effectiveMaxEditDistance
+        statistics.pass(.bitmask)
 
         // Ensure buffer capacity and lowercase the candidate
+        statistics.enter(.lowercase)
         editDistanceState.ensureCapacity(queryLength)
         candidateStorage.ensureCapacity(candidateLength)
         if matchPositions.count < queryLength {
@@ -396,23 +480,14 @@ public struct FuzzyMatcher: Sendable {
         // Get span from candidateStorage - this borrows from candidateStorage parameter,
         // which allows us to mutate editDistanceState and matchPositions (separate parameters)
         let candidateSpan = candidateStorage.bytes.span.extracting(0..<actualCandidateLength)
-        let querySpan = query.lowercased.span
+        statistics.pass(.lowercase)
 
-        // Prefilter 3: Trigrams (only if query has enough trigrams to be selective)
-        // Skip when threshold (queryTrigrams.count - 3*maxED) is non-positive,
-        // since the filter would accept every candidate anyway.
-        // Space-containing trigrams are excluded at computation time, so this
-        // is safe for multi-word queries (see computeTrigrams for rationale).
-        if query.lowercased.count >= 4
-            && query.trigrams.count > 3 * effectiveMaxEditDistance {
-            if !passesTrigramFilter(
-                candidateBytes: candidateSpan,
-                queryTrigrams: query.trigrams,
-                maxEditDistance: effectiveMaxEditDistance
-            ) {
-                return nil
-            }
+        // Prefilter 3: Trigrams
+        statistics.enter(.trigram)
+        if !passesQueryTrigramFilter(candidateSpan, query: query) {
+            return nil
         }
+        statistics.pass(.trigram)
 
         // Compute word boundary mask for bonus calculation
         // Use the ORIGINAL (non-lowercased) bytes to detect camelCase transitions,
@@ -420,26 +495,88 @@ public struct FuzzyMatcher: Sendable {
         // with candidateSpan indices used downstream.
         let boundaryMask = computeBoundaryMaskCompressed(originalBytes: candidateUTF8, isASCII: candidateIsASCII)
 
-        let needsAlignment = edConfig.wordBoundaryBonus > 0
-            || edConfig.consecutiveBonus > 0
-            || edConfig.gapPenalty != .none
-            || edConfig.firstMatchBonus > 0
+        return scoreLowercasedCandidate(
+            candidateSpan,
+            candidateUTF8: candidateUTF8,
+            boundaryMask: boundaryMask,
+            against: query,
+            edConfig: edConfig,
+            editDistanceState: &editDistanceState,
+            matchPositions: &matchPositions,
+            alignmentState: &alignmentState,
+            wordInitials: &wordInitials,
+            statistics: &statistics,
+            scoreFloor: scoreFloor
+        )
+    }
+
+    /// Runs scoring phases 2–6 on an already lowercased candidate.
+    ///
+    /// Shared by ``scoreImpl(_:against:edConfig:candidateStorage:editDistanceState:matchPositions:alignmentState:wordInitials:statistics:scoreFloor:)``,
+    /// which lowercases into the scoring buffer, and the ``FuzzyCorpus`` path, which
+    /// reads the lowercased bytes and boundary mask precomputed at corpus build time.
+    /// The caller is responsible for the length, bitmask and trigram prefilters and
+    /// for ensuring `editDistanceState` and `matchPositions` capacity.
+    ///
+    /// When `wordInitialsColumn` holds the candidate's precomputed word initials, the
+    /// acronym phase matches against them instead of collecting them again.
+    ///
+    /// When `scoreFloor` is finite, a candidate whose score upper bound is below it is
+    /// rejected after the exact-match check, before any alignment work.
+    @inlinable
+    internal func scoreLowercasedCandidate(
+        _ candidateSpan: Span<UInt8>,
+        candidateUTF8: Span<UInt8>,
+        boundaryMask: UInt64,
+        against query: FuzzyQuery,
+        edConfig: EditDistanceConfig,
+        editDistanceState: inout EditDistanceState,
+        matchPositions: inout [Int],
+        alignmentState: inout AlignmentState,
+        wordInitials: inout [UInt8],
+        statistics: inout ScoringStatistics,
+        wordInitialsColumn: Span<UInt8>? = nil,
+        scoreFloor: Double = -.infinity
+    ) -> ScoredMatch? {
+        let actualCandidateLength = candidateSpan.count
+        let querySpan = query.lowercased.span
+        let effectiveMaxEditDistance = query.effectiveMaxEditDistance
 
         var state = ScoringState()
         state.boundaryMask = boundaryMask
         state.effectiveMaxEditDistance = effectiveMaxEditDistance
-        state.needsAlignment = needsAlignment
+        state.needsAlignment = query.needsAlignment
 
         // Phase 2: Exact match (early exit)
+        statistics.enter(.exactMatch)
         if let exact = checkExactMatch(
-            candidateBytes: candidateStorage.bytes,
+            candidateBytes: candidateSpan,
             query: query,
             candidateLength: actualCandidateLength
         ) {
             return exact
         }
+        statistics.pass(.exactMatch)
+
+        // Score bound: skip the alignment phases when this candidate cannot reach the floor
+        if scoreFloor > -.infinity {
+            statistics.enter(.scoreBound)
+            let upperBound = edScoreUpperBound(
+                querySpan: querySpan,
+                candidateSpan: candidateSpan,
+                boundaryMask: boundaryMask,
+                query: query,
+                edConfig: edConfig,
+                editDistanceState: &editDistanceState
+            )
+            if upperBound < scoreFloor - scoreBoundTolerance {
+                return nil
+            }
+            statistics.pass(.scoreBound)
+        }
 
         // Phase 3: Prefix scoring
+        statistics.enter(.editDistance)
         let prefixDistance = scorePrefix(
             querySpan: querySpan,
             candidateSpan: candidateSpan,
@@ -449,7 +586,8 @@ public struct FuzzyMatcher: Sendable {
             state: &state,
             editDistanceState: &editDistanceState,
             matchPositions: &matchPositions,
-            alignmentState: &alignmentState
+            alignmentState: &alignmentState,
+            statistics: &statistics
         )
 
         // Phase 4: Substring scoring
@@ -463,7 +601,8 @@ public struct FuzzyMatcher: Sendable {
             state: &state,
             editDistanceState: &editDistanceState,
             matchPositions: &matchPositions,
-            alignmentState: &alignmentState
+            alignmentState: &alignmentState,
+            statistics: &statistics
         )
 
         // Phase 5: Subsequence scoring
@@ -475,34 +614,67 @@ public struct FuzzyMatcher: Sendable {
             candidateLength: actualCandidateLength,
             state: &state,
             matchPositions: &matchPositions,
-            alignmentState: &alignmentState
+            alignmentState: &alignmentState,
+            statistics: &statistics
         )
 
         // Phase 6: Acronym scoring
-        scoreAcronym(
-            querySpan: querySpan,
-            candidateSpan: candidateSpan,
-            candidateUTF8: candidateUTF8,
-            query: query,
-            candidateLength: actualCandidateLength,
-            acronymWeight: edConfig.acronymWeight,
-            state: &state,
-            wordInitials: &wordInitials
-        )
+        if let wordInitialsColumn {
+            scoreAcronymInitials(
+                querySpan: querySpan,
+                initials: wordInitialsColumn,
+                query: query,
+                acronymWeight: edConfig.acronymWeight,
+                state: &state
+            )
+        } else {
+            scoreAcronym(
+                querySpan: querySpan,
+                candidateSpan: candidateSpan,
+                candidateUTF8: candidateUTF8,
+                query: query,
+                candidateLength: actualCandidateLength,
+                acronymWeight: edConfig.acronymWeight,
+                state: &state,
+                wordInitials: &wordInitials
+            )
+        }
 
         if state.bestScore >= query.config.minScore {
+            statistics.pass(.editDistance)
             return ScoredMatch(score: state.bestScore, kind: state.bestKind)
         }
 
         return nil
     }
 
+    /// Prefilter 3: Trigram similarity against the lowercased candidate.
+    ///
+    /// Only applied when the query has enough trigrams to be selective: when the
+    /// threshold (queryTrigrams.count - 3*maxED) is non-positive the filter would
+    /// accept every candidate anyway. Space-containing trigrams are excluded at
+    /// computation time, so this is safe for multi-word queries (see
+    /// computeTrigrams for rationale).
+    @inlinable
+    internal func passesQueryTrigramFilter(_ candidateSpan: Span<UInt8>, query: FuzzyQuery) -> Bool {
+        let effectiveMaxEditDistance = query.effectiveMaxEditDistance
+        guard query.lowercased.count >= 4
+            && query.trigrams.count > 3 * effectiveMaxEditDistance else {
+            return true
+        }
+        return passesTrigramFilter(
+            candidateBytes: candidateSpan,
+            queryTrigrams: query.trigramTable,
+            maxEditDistance: effectiveMaxEditDistance
+        )
+    }
+
     // MARK: - Phase Methods
 
     /// Phase 2: Check for exact match (case-insensitive).
     @inlinable
     internal func checkExactMatch(
-        candidateBytes: [UInt8],
+        candidateBytes: Span<UInt8>,
         query: FuzzyQuery,
         candidateLength: Int
     ) -> ScoredMatch? {
@@ -528,18 +700,17 @@ public struct FuzzyMatcher: Sendable {
         state: inout ScoringState,
         editDistanceState: inout EditDistanceState,
         matchPositions: inout [Int],
-        alignmentState: inout AlignmentState
+        alignmentState: inout AlignmentState,
+        statistics: inout ScoringStatistics
     ) -> Int? {
         let queryLength = query.lowercased.count
 
-        let prefixDistance = prefixEditDistance(
-            query: querySpan,
-            candidate: candidateSpan,
-            state: &editDistanceState,
-            maxEditDistance: state.effectiveMaxEditDistance
-        )
-
-        guard let distance = prefixDistance else { return nil }
+        guard let distance = boundedPrefixDistance(
+            querySpan: querySpan,
+            candidateSpan: candidateSpan,
+            query: query,
+            editDistanceState: &editDistanceState
+        ) else { return nil }
 
         // Short query same-length restriction: for queries <= 3 chars, only allow
         // prefix ED typos against same-length candidates. Prevents "UDS" from
@@ -573,7 +744,8 @@ public struct FuzzyMatcher: Sendable {
                 edConfig: edConfig,
                 state: &state,
                 matchPositions: &matchPositions,
-                alignmentState: &alignmentState
+                alignmentState: &alignmentState,
+                statistics: &statistics
             )
             if positionCount > 0 {
                 // Cap bonuses: only exact (distance=0) can reach 1.0.
@@ -620,7 +792,8 @@ public struct FuzzyMatcher: Sendable {
         state: inout ScoringState,
         editDistanceState: inout EditDistanceState,
         matchPositions: inout [Int],
-        alignmentState: inout AlignmentState
+        alignmentState: inout AlignmentState,
+        statistics: inout ScoringStatistics
     ) {
         let queryLength = query.lowercased.count
 
@@ -628,14 +801,12 @@ public struct FuzzyMatcher: Sendable {
         // (prefix score with recovery 0.9 always beats substring with 0.8)
         guard state.bestScore < 0.7 && prefixDistance != 0 else { return }
 
-        let substringDist = substringEditDistance(
-            query: querySpan,
-            candidate: candidateSpan,
-            state: &editDistanceState,
-            maxEditDistance: state.effectiveMaxEditDistance
-        )
-
-        guard let distance = substringDist else { return }
+        guard let distance = boundedSubstringDistance(
+            querySpan: querySpan,
+            candidateSpan: candidateSpan,
+            query: query,
+            editDistanceState: &editDistanceState
+        ) else { return }
 
         // Short query same-length restriction (see scorePrefix for rationale).
         if queryLength <= 3 && distance > 0 && candidateLength != queryLength {
@@ -652,6 +823,7 @@ public struct FuzzyMatcher: Sendable {
         // Calculate bonuses using cached or fresh DP-optimal alignment
         if state.needsAlignment {
             if state.cachedPositionCount < 0 {
+                statistics.beginAlignment()
                 // For short queries with exact substring, try contiguous recovery
                 if queryLength <= 4 {
                     let positionCount = findMatchPositions(
@@ -700,6 +872,7 @@ public struct FuzzyMatcher: Sendable {
                     state.cachedPositionCount = positionCount
                     state.cachedBonus = bonus
                 }
+                statistics.endAlignment(found: state.cachedPositionCount > 0)
             }
             if state.cachedPositionCount > 0 {
                 // Cap bonuses for non-exact substring matches
@@ -759,7 +932,8 @@ public struct FuzzyMatcher: Sendable {
         candidateLength: Int,
         state: inout ScoringState,
         matchPositions: inout [Int],
-        alignmentState: inout AlignmentState
+        alignmentState: inout AlignmentState,
+        statistics: inout ScoringStatistics
     ) {
         let queryLength = query.lowercased.count
 
@@ -788,7 +962,8 @@ public struct FuzzyMatcher: Sendable {
             edConfig: edConfig,
             state: &state,
             matchPositions: &matchPositions,
-            alignmentState: &alignmentState
+            alignmentState: &alignmentState,
+            statistics: &statistics
         )
 
         // If we found all query characters in order, compute a subsequence score
@@ -854,37 +1029,35 @@ public struct FuzzyMatcher: Sendable {
         guard wordCount >= 3 && wordCount >= queryLength else { return }
 
         // Extract word-initial characters from the lowercased candidate
-        var initialCount = 0
-        let limit = min(candidateLength, 64)
-        for i in 0..<limit {
-            if (state.boundaryMask & (1 << i)) != 0 {
-                if initialCount >= wordInitials.count {
-                    wordInitials.append(contentsOf: repeatElement(UInt8(0), count: wordInitials.count))
-                }
-                wordInitials[initialCount] = candidateSpan[i]
-                initialCount += 1
-            }
-        }
-        if candidateLength > 64 {
-            for i in 64..<candidateLength {
-                // Use compressed candidateSpan for boundary check (consistent with mask)
-                // Note: camelCase detection is lost on lowercased bytes, but this is an
-                // existing limitation — boundaries from underscores, digits, non-alnum
-                // are still detected correctly.
-                if isWordBoundary(at: i, in: candidateSpan) {
-                    if initialCount >= wordInitials.count {
-                        wordInitials.append(contentsOf: repeatElement(UInt8(0), count: wordInitials.count))
-                    }
-                    wordInitials[initialCount] = candidateSpan[i]
-                    initialCount += 1
-                }
-            }
-        }
+        let initialCount = collectWordInitials(candidateSpan, boundaryMask: state.boundaryMask, into: &wordInitials)
+        scoreAcronymInitials(
+            querySpan: querySpan,
+            initials: wordInitials.span.extracting(0..<initialCount),
+            query: query,
+            acronymWeight: acronymWeight,
+            state: &state
+        )
+    }
 
-        // Subsequence check: is query a subsequence of wordInitials[0..<initialCount]?
+    /// Phase 6 against a candidate's word initials, for example the ones a
+    /// ``FuzzyCorpus`` precomputed (see ``collectWordInitials(_:boundaryMask:into:)``).
+    @inlinable
+    internal func scoreAcronymInitials(
+        querySpan: Span<UInt8>,
+        initials: Span<UInt8>,
+        query: FuzzyQuery,
+        acronymWeight: Double,
+        state: inout ScoringState
+    ) {
+        let queryLength = query.lowercased.count
+        let initialCount = initials.count
+        guard queryLength >= 2 && queryLength <= 8 else { return }
+        guard initialCount >= 3 && initialCount >= queryLength else { return }
+
+        // Subsequence check: is query a subsequence of the initials?
         var qi = 0
         for wi in 0..<initialCount {
-            if qi < queryLength && querySpan[qi] == wordInitials[wi] {
+            if qi < queryLength && querySpan[qi] == initials[wi] {
                 qi += 1
             }
         }
@@ -898,6 +1071,60 @@ public struct FuzzyMatcher: Sendable {
         }
     }
 
+    // MARK: - Edit Distance Helpers
+
+    /// Prefix edit distance of the query against the candidate, or `nil` above the
+    /// query's edit distance budget.
+    ///
+    /// Queries of up to 64 bytes use the bit-parallel kernel (same result).
+    @inlinable
+    internal func boundedPrefixDistance(
+        querySpan: Span<UInt8>,
+        candidateSpan: Span<UInt8>,
+        query: FuzzyQuery,
+        editDistanceState: inout EditDistanceState
+    ) -> Int? {
+        if query.patternMasks.isEmpty {
+            return prefixEditDistance(
+                query: querySpan,
+                candidate: candidateSpan,
+                state: &editDistanceState,
+                maxEditDistance: query.effectiveMaxEditDistance
+            )
+        }
+        return prefixEditDistanceBitParallel(
+            patternMasks: query.patternMasks.span,
+            queryLength: querySpan.count,
+            candidate: candidateSpan,
+            maxEditDistance: query.effectiveMaxEditDistance
+        )
+    }
+
+    /// Substring edit distance of the query against the candidate, or `nil` above the
+    /// query's edit distance budget.
+    @inlinable
+    internal func boundedSubstringDistance(
+        querySpan: Span<UInt8>,
+        candidateSpan: Span<UInt8>,
+        query: FuzzyQuery,
+        editDistanceState: inout EditDistanceState
+    ) -> Int? {
+        if query.patternMasks.isEmpty {
+            return substringEditDistance(
+                query: querySpan,
+                candidate: candidateSpan,
+                state: &editDistanceState,
+                maxEditDistance: query.effectiveMaxEditDistance
+            )
+        }
+        return substringEditDistanceBitParallel(
+            patternMasks: query.patternMasks.span,
+            queryLength: querySpan.count,
+            candidate: candidateSpan,
+            maxEditDistance: query.effectiveMaxEditDistance
+        )
+    }
+
     // MARK: - Alignment Cache Helper
 
     /// Computes alignment if not already cached, updating state. Returns (positionCount, bonus).
@@ -909,11 +1136,13 @@ public struct FuzzyMatcher: Sendable {
         edConfig: EditDistanceConfig,
         state: inout ScoringState,
         matchPositions: inout [Int],
-        alignmentState: inout AlignmentState
+        alignmentState: inout AlignmentState,
+        statistics: inout ScoringStatistics
     ) -> (positionCount: Int, bonus: Double) {
         if state.cachedPositionCount >= 0 {
             return (state.cachedPositionCount, state.cachedBonus)
         }
+        statistics.beginAlignment()
 
         let queryLength = query.lowercased.count
         let positionCount: Int
@@ -946,6 +1175,7 @@ public struct FuzzyMatcher: Sendable {
 
         state.cachedPositionCount = positionCount
         state.cachedBonus = bonus
+        statistics.endAlignment(found: positionCount > 0)
         return (positionCount, bonus)
     }
 
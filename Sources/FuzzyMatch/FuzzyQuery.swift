@@ -47,7 +47,15 @@
 /// `FuzzyQuery` is immutable and `Sendable`, making it safe to share across threads.
 /// Multiple threads can use the same prepared query simultaneously with their own
 /// ``ScoringBuffer`` instances.
-public struct FuzzyQuery: Sendable, Equatable {
+///
+/// Every other property is derived from ``original`` and ``config``, so equal
+/// queries hash alike and a query can key a ``FuzzyResultCache`` or a dictionary.
+public struct FuzzyQuery: Sendable, Hashable {
+    public func hash(into hasher: inout Hasher) {
+        hasher.combine(original)
+        hasher.combine(config)
+    }
+
     public static func == (lhs: Self, rhs: Self) -> Bool {
         lhs.original == rhs.original
             && lhs.lowercased == rhs.lowercased
@@ -91,6 +99,9 @@ public struct FuzzyQuery: Sendable, Equatable {
     /// Set of 3-byte trigram hashes for the query.
     @usableFromInline let trigrams: Set<UInt32>
 
+    /// The contents of ``trigrams`` in a flat table for the scoring hot path.
+    @usableFromInline let trigramTable: TrigramTable
+
     /// Whether the query contains space characters.
     @usableFromInline let containsSpaces: Bool
 
@@ -106,6 +117,21 @@ public struct FuzzyQuery: Sendable, Equatable {
     /// Minimum candidate length that can pass the length bounds prefilter.
     @usableFromInline let minCandidateLength: Int
 
+    /// Whether the edit distance configuration awards any alignment bonus or gap
+    /// penalty, so match positions must be computed. Resolved once here instead of
+    /// per candidate; always `false` for Smith-Waterman.
+    @usableFromInline let needsAlignment: Bool
+
+    /// Whether a negative gap penalty lets gaps add bonus, which leaves edit
+    /// distance scores without a finite upper bound.
+    @usableFromInline let hasNegativeGapPenalty: Bool
+
+    /// Pattern-match vectors for the bit-parallel edit distance kernels.
+    ///
+    /// Empty for Smith-Waterman and for queries longer than 64 bytes, which use the
+    /// row-by-row DP kernels instead.
+    @usableFromInline let patternMasks: [UInt64]
+
     /// Maximum possible Smith-Waterman raw score for this query.
     @usableFromInline let maxSmithWatermanScore: Int
 
@@ -126,6 +152,7 @@ public struct FuzzyQuery: Sendable, Equatable {
         self.lowercased = lowercased
         self.charBitmask = charBitmask
         self.trigrams = trigrams
+        self.trigramTable = TrigramTable(trigrams)
         self.containsSpaces = containsSpaces
         self.config = config
 
@@ -140,11 +167,27 @@ public struct FuzzyQuery: Sendable, Equatable {
             self.effectiveMaxEditDistance = emed
             self.bitmaskTolerance = queryLength <= 3 ? 0 : emed
             self.minCandidateLength = queryLength - emed
+            self.patternMasks = buildPatternMatchVectors(lowercased)
+            self.needsAlignment = edConfig.wordBoundaryBonus > 0
+                || edConfig.consecutiveBonus > 0
+                || edConfig.gapPenalty != .none
+                || edConfig.firstMatchBonus > 0
+            switch edConfig.gapPenalty {
+            case .none:
+                self.hasNegativeGapPenalty = false
+            case .linear(let perCharacter):
+                self.hasNegativeGapPenalty = perCharacter < 0
+            case .affine(let open, let extend):
+                self.hasNegativeGapPenalty = open < 0 || extend < 0
+            }
 
         case .smithWaterman:
             self.effectiveMaxEditDistance = 0
             self.bitmaskTolerance = 0
             self.minCandidateLength = 0
+            self.patternMasks = []
+            self.needsAlignment = false
+            self.hasNegativeGapPenalty = false
         }
 
         // Split multi-word Smith-Waterman queries into atoms
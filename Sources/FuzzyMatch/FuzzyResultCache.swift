@@ -0,0 +1,277 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+import Synchronization
+
+/// A concurrent least-recently-used cache of corpus search results.
+///
+/// ## Overview
+///
+/// Search traffic often repeats: the same popular queries arrive many times a
+/// minute. `FuzzyResultCache` sits in front of the corpus
+/// `topMatches(_:against:limit:cache:)` of ``FuzzyMatcher`` and
+/// ``FuzzySearchSession/topMatches(limit:cache:)`` and returns the stored results
+/// when the same prepared query asks for the same number of results from the same
+/// corpus again.
+///
+/// An entry is keyed on the ``FuzzyQuery`` (its text and ``MatchConfig``), the result
+/// limit and the corpus ``FuzzyCorpus/generation``. A rebuilt or reloaded corpus has a
+/// new generation, so it never sees results cached for its predecessor; those
+/// entries simply age out.
+///
+/// ## Concurrency
+///
+/// The cache is split into shards, each a small LRU list behind its own lock, and a
+/// key always maps to the same shard. Requests for different queries therefore
+/// rarely wait for each other, and a lock is held only to look up or store an entry,
+/// never while searching. Two requests that miss on the same key at the same time
+/// both search, and the second stores the same results again.
+///
+/// ## Example
+///
+/// ```swift
+/// let cache = FuzzyResultCache(capacity: 4_096)
+///
+/// // On every request thread
+/// let query = matcher.prepare(text)
+/// let results = matcher.topMatches(corpus, against: query, limit: 10, cache: cache)
+/// ```
+public final class FuzzyResultCache: Sendable {
+    /// Hit and eviction counters, summed over all shards.
+    public struct Statistics: Sendable, Equatable {
+        /// Lookups that returned stored results.
+        public var hits: Int = 0
+
+        /// Lookups that found nothing and searched.
+        public var misses: Int = 0
+
+        /// Entries dropped to make room for newer ones.
+        public var evictions: Int = 0
+
+        public init() {}
+    }
+
+    struct Key: Hashable, Sendable {
+        let query: FuzzyQuery
+        let limit: Int
+        let generation: UInt64
+    }
+
+    /// One shard: an LRU list threaded through `entries` by index.
+    struct Shard {
+        struct Entry {
+            var key: Key
+            var results: [MatchResult]
+            var previous: Int
+            var next: Int
+        }
+
+        let capacity: Int
+        var slots: [Key: Int] = [:]
+        var entries: [Entry] = []
+        /// Most recently used entry, or -1 when empty.
+        var head = -1
+        /// Least recently used entry, or -1 when empty.
+        var tail = -1
+        var statistics = Statistics()
+
+        init(capacity: Int) {
+            self.capacity = capacity
+        }
+
+        mutating func results(for key: Key) -> [MatchResult]? {
+            guard let slot = slots[key] else {
+                statistics.misses += 1
+                return nil
+            }
+            statistics.hits += 1
+            moveToFront(slot)
+            return entries[slot].results
+        }
+
+        mutating func store(_ results: [MatchResult], for key: Key) {
+            if let slot = slots[key] {
+                entries[slot].results = results
+                moveToFront(slot)
+                return
+            }
+            let slot: Int
+            if entries.count < capacity {
+                slot = entries.count
+                entries.append(Entry(key: key, results: results, previous: -1, next: -1))
+            } else {
+                slot = tail
+                unlink(slot)
+                slots.removeValue(forKey: entries[slot].key)
+                entries[slot].key = key
+                entries[slot].results = results
+                statistics.evictions += 1
+            }
+            slots[key] = slot
+            linkAtFront(slot)
+        }
+
+        mutating func removeAll() {
+            slots.removeAll()
+            entries.removeAll()
+            head = -1
+            tail = -1
+        }
+
+        private mutating func moveToFront(_ slot: Int) {
+            guard slot != head else { return }
+            unlink(slot)
+            linkAtFront(slot)
+        }
+
+        private mutating func unlink(_ slot: Int) {
+            let previous = entries[slot].previous
+            let next = entries[slot].next
+            if previous >= 0 { entries[previous].next = next } else { head = next }
+            if next >= 0 { entries[next].previous = previous } else { tail = previous }
+        }
+
+        private mutating func linkAtFront(_ slot: Int) {
+            entries[slot].previous = -1
+            entries[slot].next = head
+            if head >= 0 { entries[head].previous = slot }
+            head = slot
+            if tail < 0 { tail = slot }
+        }
+    }
+
+    /// A shard's lock; a class so the shards can live in an array.
+    final class LockedShard: Sendable {
+        let state: Mutex<Shard>
+
+        init(capacity: Int) {
+            state = Mutex(Shard(capacity: capacity))
+        }
+    }
+
+    /// Maximum number of entries the cache holds: the requested capacity rounded up
+    /// to a multiple of the shard count.
+    public let capacity: Int
+
+    private let shards: [LockedShard]
+    private let shardMask: Int
+
+    /// Creates an empty cache.
+    ///
+    /// - Parameters:
+    ///   - capacity: Maximum number of entries. Each shard holds an equal share, so
+    ///     the least recently used entry of a full shard is evicted even if other
+    ///     shards have room. Default is `1024`.
+    ///   - shardCount: Number of independently locked shards, rounded up to a power of
+    ///     two and capped at `capacity`. More shards mean less contention between
+    ///     request threads. Default is `16`.
+    public init(capacity: Int = 1_024, shardCount: Int = 16) {
+        precondition(capacity > 0, "capacity must be positive")
+        var count = 1
+        while count < min(max(1, shardCount), capacity) {
+            count <<= 1
+        }
+        if count > capacity {
+            count >>= 1
+        }
+        let perShard = (capacity + count - 1) / count
+        self.capacity = perShard * count
+        self.shards = (0..<count).map { _ in LockedShard(capacity: perShard) }
+        self.shardMask = count - 1
+    }
+
+    /// The number of stored entries.
+    public var count: Int {
+        shards.reduce(0) { total, shard in total + shard.state.withLock { $0.slots.count } }
+    }
+
+    /// Hit, miss and eviction counts since the cache was created.
+    public var statistics: Statistics {
+        shards.reduce(into: Statistics()) { total, shard in
+            let counts = shard.state.withLock { $0.statistics }
+            total.hits += counts.hits
+            total.misses += counts.misses
+            total.evictions += counts.evictions
+        }
+    }
+
+    /// Removes every entry, keeping the statistics.
+    public func removeAll() {
+        for shard in shards {
+            shard.state.withLock { $0.removeAll() }
+        }
+    }
+
+    /// Returns the stored results for `key`, or runs `search` and stores what it returns.
+    func results(for key: Key, search: () -> [MatchResult]) -> [MatchResult] {
+        let shard = shards[key.hashValue & shardMask]
+        if let cached = shard.state.withLock({ $0.results(for: key) }) {
+            return cached
+        }
+        let results = search()
+        shard.state.withLock { $0.store(results, for: key) }
+        return results
+    }
+}
+
+// MARK: - Cached Searches
+
+extension FuzzyMatcher {
+    /// Returns the top matches from a prebuilt corpus, answering repeated queries from `cache`.
+    ///
+    /// Returns the same results as `topMatches(_:against:limit:)` without the cache.
+    /// On a miss the corpus is searched and the results are stored.
+    ///
+    /// - Parameters:
+    ///   - corpus: The corpus to search.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - limit: Maximum number of results to return. Default is `10`.
+    ///   - cache: The cache to consult and fill.
+    /// - Returns: An array of ``MatchResult`` sorted by score descending,
+    ///   containing at most `limit` elements.
+    public func topMatches(
+        _ corpus: FuzzyCorpus,
+        against query: FuzzyQuery,
+        limit: Int = 10,
+        cache: FuzzyResultCache
+    ) -> [MatchResult] {
+        let key = FuzzyResultCache.Key(query: query, limit: limit, generation: corpus.generation)
+        return cache.results(for: key) {
+            topMatches(corpus, against: query, limit: limit)
+        }
+    }
+}
+
+extension FuzzySearchSession {
+    /// Returns the top matches for the current query, answering repeated queries from `cache`.
+    ///
+    /// Shares entries with the corpus `topMatches(_:against:limit:cache:)` of
+    /// ``FuzzyMatcher``: a query typed in one session is answered from the cache in
+    /// another session, or for a one-off search, over the same corpus. On a miss
+    /// only the session's narrowed candidates are scored, as in
+    /// ``topMatches(limit:)``. Sharing the key is sound because a session only
+    /// narrows when the result is identical to a full search. It selects through
+    /// the trigram index again whenever the index picks the survivors.
+    ///
+    /// - Parameters:
+    ///   - limit: Maximum number of results to return. Default is `10`.
+    ///   - cache: The cache to consult and fill.
+    /// - Returns: An array of ``MatchResult`` sorted by score descending,
+    ///   containing at most `limit` elements.
+    public func topMatches(limit: Int = 10, cache: FuzzyResultCache) -> [MatchResult] {
+        let key = FuzzyResultCache.Key(query: query, limit: limit, generation: corpus.generation)
+        return cache.results(for: key) {
+            topMatches(limit: limit)
+        }
+    }
+}
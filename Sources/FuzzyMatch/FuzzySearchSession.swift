@@ -0,0 +1,210 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+/// A type-ahead search over a ``FuzzyCorpus`` that narrows the previous result set
+/// as the query grows.
+///
+/// ## Overview
+///
+/// A search box prepares a new query and searches the whole corpus on every keystroke.
+/// The length and character-bitmask prefilters are monotone, though. Appending
+/// characters never lowers the minimum candidate length and never removes characters
+/// from the query bitmask, so a candidate they rejected for the previous query stays
+/// rejected. `FuzzySearchSession` keeps the prefilter survivors of the current query.
+/// When the next query extends it, only those survivors are checked again.
+///
+/// The session falls back to a full prefilter sweep whenever reuse could lose a
+/// match:
+/// - the new query does not start with the previous one (backspace, an edit in the
+///   middle, a paste that replaces the text)
+/// - the matcher configuration differs
+/// - the edit distance budget grew. With edit distance scoring, short queries get a
+///   larger budget as they grow, so the first few keystrokes still sweep. Smith-Waterman
+///   queries can always be refined.
+/// - either query draws its survivors from the trigram index of a corpus built with
+///   `buildTrigramIndex: true`. The shared-trigram threshold is not monotone, so
+///   the longer query is selected through the index again.
+///
+/// Results are identical to calling the corpus `topMatches(_:against:limit:)` or
+/// `matches(_:against:)` of ``FuzzyMatcher`` with the current query.
+///
+/// ## Example
+///
+/// ```swift
+/// let corpus = FuzzyCorpus(symbols)
+/// var session = FuzzySearchSession(corpus: corpus, matcher: FuzzyMatcher())
+///
+/// for text in ["g", "ge", "get", "getu", "getus", "getuse", "getuser"] {
+///     session.update(text)
+///     let results = session.topMatches(limit: 10)
+///     // ...
+/// }
+/// ```
+///
+/// ## Thread Safety
+///
+/// `FuzzySearchSession` is a value type holding per-session state. Use one session
+/// per search box; sessions over the same corpus are independent.
+public struct FuzzySearchSession: Sendable {
+    /// The corpus being searched.
+    public let corpus: FuzzyCorpus
+
+    /// The matcher used to prepare and score queries.
+    public let matcher: FuzzyMatcher
+
+    /// The current prepared query.
+    public private(set) var query: FuzzyQuery
+
+    /// Prefilter survivors of ``query``, in ascending corpus order.
+    @usableFromInline var survivors: [UInt32]
+
+    /// Whether the last ``update(_:)`` narrowed the previous survivors instead of sweeping.
+    internal private(set) var lastUpdateWasIncremental = false
+
+    /// Creates a session over `corpus` with an empty query.
+    ///
+    /// - Parameters:
+    ///   - corpus: The corpus to search.
+    ///   - matcher: The matcher used to prepare and score queries. Default is
+    ///     `FuzzyMatcher()`.
+    public init(corpus: FuzzyCorpus, matcher: FuzzyMatcher = FuzzyMatcher()) {
+        self.corpus = corpus
+        self.matcher = matcher
+        self.query = matcher.prepare("")
+        self.survivors = []
+        corpus.collectPrefilterSurvivors(for: query, into: &survivors)
+    }
+
+    /// The number of candidates that passed the prefilters for ``query``.
+    ///
+    /// The candidates scored by the next ``topMatches(limit:)`` or ``matches()``.
+    public var candidateCount: Int { survivors.count }
+
+    /// Replaces the current query with `text`.
+    ///
+    /// If `text` extends the current query, the previous prefilter survivors are
+    /// narrowed in place. Otherwise the corpus is swept again.
+    ///
+    /// - Parameter text: The new query text.
+    public mutating func update(_ text: String) {
+        update(matcher.prepare(text))
+    }
+
+    /// Replaces the current query with a prepared query.
+    ///
+    /// - Parameter newQuery: A query prepared by ``matcher``.
+    public mutating func update(_ newQuery: FuzzyQuery) {
+        if reusesSurvivors(from: query, for: newQuery) {
+            let (maxMissingCharacters, minCandidateLength) = newQuery.monotonePrefilterBounds
+            corpus.retainPrefilterSurvivors(
+                &survivors,
+                queryMask: newQuery.charBitmask,
+                maxMissingCharacters: maxMissingCharacters,
+                minCandidateLength: minCandidateLength
+            )
+            lastUpdateWasIncremental = true
+        } else {
+            corpus.collectPrefilterSurvivors(for: newQuery, into: &survivors)
+            lastUpdateWasIncremental = false
+        }
+        query = newQuery
+    }
+
+    /// Whether the survivors of `previous` can be narrowed to those of `next`.
+    ///
+    /// Requires ``FuzzyQuery/narrows(_:)``, and that neither query draws its survivors
+    /// from the corpus trigram index. A candidate sharing no trigram with "abcdefghi"
+    /// can share two with "abcdefghij", enough for the longer query's threshold.
+    @inlinable
+    func reusesSurvivors(from previous: FuzzyQuery, for next: FuzzyQuery) -> Bool {
+        guard next.narrows(previous) else { return false }
+        if case .trigramIndex = corpus.prefilterSweep(for: previous) { return false }
+        if case .trigramIndex = corpus.prefilterSweep(for: next) { return false }
+        return true
+    }
+
+    /// Returns the top matches for the current query, sorted by score descending.
+    ///
+    /// - Parameter limit: Maximum number of results to return. Default is `10`.
+    /// - Returns: An array of ``MatchResult`` sorted by score descending,
+    ///   containing at most `limit` elements.
+    public func topMatches(limit: Int = 10) -> [MatchResult] {
+        var top = TopKCollector<MatchResult>(limit: limit)
+        matcher.collectTopMatches(corpus, indices: survivors, against: query, into: &top)
+        return top.sortedElements()
+    }
+
+    /// Returns all matches for the current query, sorted by score descending.
+    ///
+    /// - Returns: An array of ``MatchResult`` sorted by score descending.
+    public func matches() -> [MatchResult] {
+        var buffer = matcher.makeBuffer()
+        var results: [MatchResult] = []
+        for survivor in survivors {
+            let index = Int(survivor)
+            if let match = matcher.score(corpus, at: index, against: query, buffer: &buffer) {
+                results.append(MatchResult(candidate: corpus[index], match: match))
+            }
+        }
+        results.sort { $0.match.score > $1.match.score }
+        return results
+    }
+}
+
+// MARK: - Refinement
+
+extension FuzzyQuery {
+    /// Length and bitmask prefilter bounds, matching the sweep in
+    /// ``FuzzyCorpus/collectPrefilterSurvivors(for:into:)``.
+    @inlinable
+    var monotonePrefilterBounds: (maxMissingCharacters: Int, minCandidateLength: Int) {
+        switch config.algorithm {
+        case .editDistance:
+            return (bitmaskTolerance, minCandidateLength)
+        case .smithWaterman:
+            return (0, 0)
+        }
+    }
+
+    /// Whether every candidate that can match `self` survived the prefilters of `previous`.
+    ///
+    /// Holds when `self` extends `previous` under the same configuration without
+    /// loosening any prefilter bound:
+    /// - the lowercased bytes of `previous` are a prefix of `self`'s, so the bitmask and
+    ///   trigram set only grow
+    /// - the bitmask tolerance and edit distance budget did not grow
+    /// - the minimum candidate length did not shrink
+    ///
+    /// Only the length and bitmask prefilters are monotone. The trigram index counts
+    /// shared trigrams per occurrence, so a candidate that missed the previous
+    /// query's threshold can reach the next one; see
+    /// ``FuzzySearchSession/reusesSurvivors(from:for:)``.
+    @inlinable
+    func narrows(_ previous: FuzzyQuery) -> Bool {
+        guard config == previous.config,
+            lowercased.count >= previous.lowercased.count,
+            lowercased.starts(with: previous.lowercased),
+            charBitmask & previous.charBitmask == previous.charBitmask else {
+            return false
+        }
+        // Edit distance queries under two bytes are not prefiltered at all
+        if case .editDistance = config.algorithm, lowercased.count < 2 {
+            return false
+        }
+        let bounds = monotonePrefilterBounds
+        let previousBounds = previous.monotonePrefilterBounds
+        return bounds.maxMissingCharacters <= previousBounds.maxMissingCharacters
+            && bounds.minCandidateLength >= previousBounds.minCandidateLength
+            && effectiveMaxEditDistance <= previous.effectiveMaxEditDistance
+    }
+}
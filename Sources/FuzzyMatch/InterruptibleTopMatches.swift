@@ -0,0 +1,202 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+/// The top matches of a corpus search that may have stopped before scoring every
+/// candidate.
+///
+/// ## Overview
+///
+/// Created by ``FuzzyMatcher/interruptibleTopMatches(_:against:limit:deadline:chunkSize:concurrency:)``.
+/// The search scores the prefilter survivors in chunks and stops between chunks
+/// when its task is cancelled or its deadline passes. ``results`` then holds the
+/// best matches among the chunks scored so far, and ``isComplete`` is `false`.
+///
+/// When ``isComplete`` is `true`, ``results`` is identical to the corpus
+/// `topMatches(_:against:limit:)`.
+public struct InterruptibleTopMatches: Sendable, Equatable {
+    /// The best matches found, sorted by score descending.
+    public let results: [MatchResult]
+
+    /// Whether every prefilter survivor was scored.
+    public let isComplete: Bool
+
+    /// Number of prefilter survivors that were scored.
+    public let scoredCount: Int
+
+    /// Number of candidates that passed the prefilters, scored or not. `0` when the
+    /// task was cancelled before the prefilter sweep.
+    public let candidateCount: Int
+}
+
+// MARK: - Interruptible Searches
+
+extension FuzzyMatcher {
+    /// Returns the top matches from a prebuilt corpus, stopping early when the calling
+    /// task is cancelled or `deadline` passes.
+    ///
+    /// The vectorized prefilter sweep runs once on the calling task. The surviving
+    /// indices are then split into chunks of `chunkSize`, dealt round-robin to up to
+    /// `concurrency` workers, the way `fuzzygrep` distributes input chunks. Each
+    /// worker has its own ``ScoringBuffer`` and bounded top-K list, and between
+    /// chunks it:
+    ///
+    /// - stops if the task is cancelled or `deadline` has passed
+    /// - calls `Task.yield()`, so a newer query started on the same executor gets
+    ///   to run instead of waiting for this search to finish
+    ///
+    /// The per-worker lists are merged at the end, so a stopped search returns the
+    /// best matches among the chunks it scored. Ties are broken by corpus index,
+    /// and a search that finishes returns the same results as the corpus
+    /// `topMatches(_:against:limit:)`.
+    ///
+    /// A deadline that has already passed, or a task cancelled before the call,
+    /// returns no results. A smaller `chunkSize` reacts sooner, at the cost of
+    /// more frequent checks and yields.
+    ///
+    /// - Parameters:
+    ///   - corpus: The corpus to search.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - limit: Maximum number of results to return. Default is `10`.
+    ///   - deadline: The instant after which no further chunk is started, or `nil`
+    ///     to stop only on cancellation. Default is `nil`.
+    ///   - chunkSize: Number of prefilter survivors scored between checks. Default
+    ///     is `4096`.
+    ///   - concurrency: Maximum number of concurrent scoring tasks. Default is `1`,
+    ///     which scores on the calling task.
+    /// - Returns: The best matches found, and whether every candidate was scored.
+    ///
+    /// ## Example
+    ///
+    /// ```swift
+    /// // On every keystroke, supersede the previous search
+    /// searchTask?.cancel()
+    /// searchTask = Task {
+    ///     let search = await matcher.interruptibleTopMatches(
+    ///         corpus,
+    ///         against: matcher.prepare(text),
+    ///         limit: 20,
+    ///         deadline: .now + .milliseconds(8)
+    ///     )
+    ///     guard !Task.isCancelled else { return }
+    ///     show(search.results, stillSearching: !search.isComplete)
+    /// }
+    /// ```
+    public func interruptibleTopMatches(
+        _ corpus: FuzzyCorpus,
+        against query: FuzzyQuery,
+        limit: Int = 10,
+        deadline: ContinuousClock.Instant? = nil,
+        chunkSize: Int = 4_096,
+        concurrency: Int = 1
+    ) async -> InterruptibleTopMatches {
+        guard limit > 0 else {
+            return InterruptibleTopMatches(results: [], isComplete: true, scoredCount: 0, candidateCount: 0)
+        }
+        guard !Task.isCancelled else {
+            return InterruptibleTopMatches(results: [], isComplete: false, scoredCount: 0, candidateCount: 0)
+        }
+        var survivors: [UInt32] = []
+        corpus.collectPrefilterSurvivors(for: query, into: &survivors)
+
+        let count = survivors.count
+        let chunkSize = max(1, chunkSize)
+        let chunkCount = (count + chunkSize - 1) / chunkSize
+        let workers = max(1, min(concurrency, chunkCount))
+
+        let merged: ChunkedTopMatches
+        if workers == 1 {
+            merged = await scoreChunks(
+                corpus,
+                survivors: survivors,
+                against: query,
+                limit: limit,
+                chunks: stride(from: 0, to: count, by: chunkSize),
+                chunkSize: chunkSize,
+                deadline: deadline
+            )
+        } else {
+            merged = await withTaskGroup(of: ChunkedTopMatches.self) { [survivors] group in
+                for worker in 0..<workers {
+                    group.addTask {
+                        await self.scoreChunks(
+                            corpus,
+                            survivors: survivors,
+                            against: query,
+                            limit: limit,
+                            chunks: stride(from: worker * chunkSize, to: count, by: workers * chunkSize),
+                            chunkSize: chunkSize,
+                            deadline: deadline
+                        )
+                    }
+                }
+
+                var merged = ChunkedTopMatches(top: TopKCollector(limit: limit))
+                for await partial in group {
+                    merged.top.merge(partial.top)
+                    merged.scoredCount += partial.scoredCount
+                }
+                return merged
+            }
+        }
+
+        return InterruptibleTopMatches(
+            results: merged.top.sortedElements(),
+            isComplete: merged.scoredCount == count,
+            scoredCount: merged.scoredCount,
+            candidateCount: count
+        )
+    }
+
+    /// One worker's share of an interruptible search.
+    internal struct ChunkedTopMatches: Sendable {
+        var top: TopKCollector<MatchResult>
+        var scoredCount = 0
+    }
+
+    /// Scores the chunks of `survivors` starting at each offset in `chunks` with one
+    /// buffer, checking for cancellation and the deadline before each chunk and
+    /// yielding after it.
+    private func scoreChunks(
+        _ corpus: FuzzyCorpus,
+        survivors: [UInt32],
+        against query: FuzzyQuery,
+        limit: Int,
+        chunks: StrideTo<Int>,
+        chunkSize: Int,
+        deadline: ContinuousClock.Instant?
+    ) async -> ChunkedTopMatches {
+        var result = ChunkedTopMatches(top: TopKCollector(limit: limit))
+        var buffer = makeBuffer()
+        for chunkStart in chunks {
+            if Task.isCancelled {
+                break
+            }
+            if let deadline, ContinuousClock.now >= deadline {
+                break
+            }
+            let chunkEnd = min(chunkStart + chunkSize, survivors.count)
+            collectTopMatches(
+                corpus,
+                indices: survivors[chunkStart..<chunkEnd],
+                against: query,
+                into: &result.top,
+                buffer: &buffer
+            ) { index, match in
+                MatchResult(candidate: corpus[index], match: match)
+            }
+            result.scoredCount += chunkEnd - chunkStart
+            await Task.yield()
+        }
+        return result
+    }
+}
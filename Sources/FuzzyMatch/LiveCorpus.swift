@@ -0,0 +1,315 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+import Synchronization
+
+/// A corpus that accepts appends and removals while it is being searched.
+///
+/// ## Overview
+///
+/// A ``FuzzyCorpus`` is immutable, and rebuilding one with hundreds of thousands
+/// or millions of candidates on every change is not viable when instruments are
+/// listed and delisted during the day. `LiveCorpus` keeps the candidates it was
+/// created with as a *base* segment and collects changes next to it:
+///
+/// - ``append(_:)`` precomputes the new candidates' columns once and adds them to a
+///   small *delta* segment. Only the delta is copied, never the base.
+/// - ``remove(id:)`` marks a base candidate as deleted, or drops a delta candidate
+///   from the delta.
+/// - Once the delta and the deleted rows together reach ``compactionThreshold``, a
+///   background task merges them into a new base. The merge copies the columns
+///   that were precomputed when each candidate was added; only the length buckets
+///   and the optional trigram index are rebuilt.
+///
+/// Every write publishes a new ``SegmentedCorpus``. Searches run against the view
+/// in ``current``, so a search never observes a half-applied write, and writes and
+/// compactions never wait for searches. Readers only take a lock long enough to
+/// copy the current view.
+///
+/// ## Ids
+///
+/// Candidates are identified by the id `append` returned for them (the initial
+/// candidates get ids `0..<n`). Ids increase with every append, are never reused,
+/// and survive compaction. Searches break score ties by id, so a view always
+/// returns the same results as a ``FuzzyCorpus`` rebuilt from its live candidates
+/// in id order.
+///
+/// ## Example
+///
+/// ```swift
+/// let live = LiveCorpus(symbols)
+/// let matcher = FuzzyMatcher()
+///
+/// // Writer
+/// let id = live.append("NEWCO")
+/// live.remove(id: delistedID)
+///
+/// // Any number of readers
+/// let results = matcher.topMatches(live.current, against: matcher.prepare("newc"), limit: 10)
+/// ```
+public final class LiveCorpus: Sendable {
+    struct State {
+        var view: SegmentedCorpus
+        var nextID: Int
+        /// While a compaction runs, the first id it does not merge.
+        var compactingBelow: Int?
+        /// Ids below `compactingBelow` removed while the compaction runs.
+        var removedWhileCompacting: [Int] = []
+        var compactionScheduled = false
+    }
+
+    /// Number of delta candidates plus deleted base candidates at which a write
+    /// schedules a background compaction.
+    public let compactionThreshold: Int
+
+    /// Whether each compacted base builds a trigram index.
+    public let buildsTrigramIndex: Bool
+
+    /// Serializes writers; held while the delta is rebuilt, never while searching.
+    private let writer: Mutex<State>
+
+    /// The view handed to readers.
+    private let published: Mutex<SegmentedCorpus>
+
+    /// Creates a live corpus whose base holds `candidates`, with ids `0..<n`.
+    ///
+    /// - Parameters:
+    ///   - candidates: The initial candidates.
+    ///   - buildTrigramIndex: Whether the base segment builds a trigram index, now and
+    ///     after every compaction. The delta never has one. Default is `false`.
+    ///   - compactionThreshold: Delta plus deleted candidates at which a write starts a
+    ///     background compaction. Pass `Int.max` to compact only when ``compact()`` is
+    ///     called. Default is `4096`.
+    public init(_ candidates: some Sequence<String>, buildTrigramIndex: Bool = false, compactionThreshold: Int = 4_096) {
+        precondition(compactionThreshold > 0, "compactionThreshold must be positive")
+        let base = FuzzyCorpus(candidates, buildTrigramIndex: buildTrigramIndex)
+        let view = SegmentedCorpus(
+            base: base,
+            baseIDs: Array(base.indices),
+            deletedBaseRows: [],
+            delta: FuzzyCorpus([]),
+            deltaIDs: []
+        )
+        self.compactionThreshold = compactionThreshold
+        self.buildsTrigramIndex = buildTrigramIndex
+        self.writer = Mutex(State(view: view, nextID: base.count))
+        self.published = Mutex(view)
+    }
+
+    /// The latest view, to search or to read candidates from.
+    public var current: SegmentedCorpus {
+        published.withLock { $0 }
+    }
+
+    /// Whether the delta and deleted candidates have reached ``compactionThreshold``.
+    public var needsCompaction: Bool {
+        writer.withLock { needsCompaction($0) }
+    }
+
+    // MARK: - Writes
+
+    /// Appends a candidate and returns its id.
+    @discardableResult
+    public func append(_ candidate: String) -> Int {
+        append(contentsOf: CollectionOfOne(candidate)).lowerBound
+    }
+
+    /// Appends candidates and returns their ids, in order.
+    ///
+    /// The candidates' columns are precomputed before the writer lock is taken;
+    /// under it the delta is copied once, however many candidates are appended.
+    @discardableResult
+    public func append(contentsOf candidates: some Sequence<String>) -> Range<Int> {
+        let added = FuzzyCorpus(candidates)
+        let (ids, compactionDue) = writer.withLock { state in
+            let first = state.nextID
+            guard !added.isEmpty else { return (first..<first, false) }
+            state.nextID += added.count
+            let view = state.view
+            let delta = FuzzyCorpus(
+                gathering: [(view.delta, Array(view.delta.indices)), (added, Array(added.indices))],
+                buildTrigramIndex: false
+            )
+            publish(
+                SegmentedCorpus(
+                    base: view.base,
+                    baseIDs: view.baseIDs,
+                    deletedBaseRows: view.deletedBaseRows,
+                    delta: delta,
+                    deltaIDs: view.deltaIDs + Array(first..<state.nextID)
+                ),
+                in: &state
+            )
+            return (first..<state.nextID, scheduleCompactionIfNeeded(&state))
+        }
+        if compactionDue {
+            startBackgroundCompaction()
+        }
+        return ids
+    }
+
+    /// Removes the candidate with `id`. Returns `false` if it was not live.
+    @discardableResult
+    public func remove(id: Int) -> Bool {
+        remove(ids: CollectionOfOne(id)) == 1
+    }
+
+    /// Removes the candidates with the given ids and returns how many were live.
+    ///
+    /// Removed base candidates are only marked as deleted; removed delta candidates
+    /// are dropped by copying the delta once.
+    @discardableResult
+    public func remove(ids: some Sequence<Int>) -> Int {
+        let unique = Set(ids)
+        let (removed, compactionDue) = writer.withLock { state in
+            let view = state.view
+            var deletedBaseRows = view.deletedBaseRows
+            var keepsDeltaRow = [Bool](repeating: true, count: view.delta.count)
+            var removed = 0
+            var droppedDeltaRows = false
+            for id in unique {
+                switch view.location(of: id) {
+                case .base(let row):
+                    deletedBaseRows.append(UInt32(row))
+                case .delta(let row):
+                    keepsDeltaRow[row] = false
+                    droppedDeltaRows = true
+                case nil:
+                    continue
+                }
+                removed += 1
+                if let bound = state.compactingBelow, id < bound {
+                    state.removedWhileCompacting.append(id)
+                }
+            }
+            guard removed > 0 else { return (0, false) }
+            deletedBaseRows.sort()
+
+            var delta = view.delta
+            var deltaIDs = view.deltaIDs
+            if droppedDeltaRows {
+                let rows = keepsDeltaRow.indices.filter { keepsDeltaRow[$0] }
+                delta = FuzzyCorpus(gathering: [(view.delta, rows)], buildTrigramIndex: false)
+                deltaIDs = rows.map { view.deltaIDs[$0] }
+            }
+            publish(
+                SegmentedCorpus(
+                    base: view.base,
+                    baseIDs: view.baseIDs,
+                    deletedBaseRows: deletedBaseRows,
+                    delta: delta,
+                    deltaIDs: deltaIDs
+                ),
+                in: &state
+            )
+            return (removed, scheduleCompactionIfNeeded(&state))
+        }
+        if compactionDue {
+            startBackgroundCompaction()
+        }
+        return removed
+    }
+
+    // MARK: - Compaction
+
+    /// Merges the delta into the base and drops deleted candidates, on the calling thread.
+    ///
+    /// The merge runs without holding the writer lock, so appends and removals made
+    /// meanwhile are not blocked; they are carried over to the new view when the
+    /// merge is published, and if they reach ``compactionThreshold`` on their own, a
+    /// background compaction is started for them. Returns `false` without doing
+    /// anything if another compaction is already running.
+    @discardableResult
+    public func compact() -> Bool {
+        let snapshot: SegmentedCorpus? = writer.withLock { state in
+            guard state.compactingBelow == nil else { return nil }
+            state.compactingBelow = state.nextID
+            state.removedWhileCompacting = []
+            state.compactionScheduled = false
+            return state.view
+        }
+        guard let snapshot else { return false }
+
+        var baseRows: [Int] = []
+        baseRows.reserveCapacity(snapshot.base.count - snapshot.deletedCount)
+        snapshot.forEachLiveBaseRow { baseRows.append($0) }
+        let merged = FuzzyCorpus(
+            gathering: [(snapshot.base, baseRows), (snapshot.delta, Array(snapshot.delta.indices))],
+            buildTrigramIndex: buildsTrigramIndex
+        )
+        let mergedIDs = snapshot.ids
+
+        let compactionDue = writer.withLock { state in
+            let view = state.view
+            let bound = state.compactingBelow ?? state.nextID
+            let firstNewRow = SegmentedCorpus.insertionPoint(of: bound, in: view.deltaIDs).index
+            let deletedBaseRows = state.removedWhileCompacting
+                .compactMap { SegmentedCorpus.row(of: $0, in: mergedIDs) }
+                .map { UInt32($0) }
+                .sorted()
+            publish(
+                SegmentedCorpus(
+                    base: merged,
+                    baseIDs: mergedIDs,
+                    deletedBaseRows: deletedBaseRows,
+                    delta: FuzzyCorpus(
+                        gathering: [(view.delta, Array(firstNewRow..<view.delta.count))],
+                        buildTrigramIndex: false
+                    ),
+                    deltaIDs: Array(view.deltaIDs[firstNewRow...])
+                ),
+                in: &state
+            )
+            state.compactingBelow = nil
+            state.removedWhileCompacting = []
+            // Writes made during a long merge may have reached the threshold again
+            return scheduleCompactionIfNeeded(&state)
+        }
+        if compactionDue {
+            startBackgroundCompaction()
+        }
+        return true
+    }
+
+    /// Compacts on the calling thread if ``needsCompaction`` is `true`.
+    @discardableResult
+    public func compactIfNeeded() -> Bool {
+        needsCompaction ? compact() : false
+    }
+
+    private func needsCompaction(_ state: State) -> Bool {
+        let pending = state.view.deltaCount + state.view.deletedCount
+        return pending >= compactionThreshold
+    }
+
+    /// Marks a background compaction as scheduled when one is due and none is
+    /// scheduled or running; returns whether the caller should start it.
+    private func scheduleCompactionIfNeeded(_ state: inout State) -> Bool {
+        guard needsCompaction(state), state.compactingBelow == nil, !state.compactionScheduled else {
+            return false
+        }
+        state.compactionScheduled = true
+        return true
+    }
+
+    private func startBackgroundCompaction() {
+        Task.detached(priority: .background) {
+            self.compact()
+        }
+    }
+
+    private func publish(_ view: SegmentedCorpus, in state: inout State) {
+        state.view = view
+        published.withLock { $0 = view }
+    }
+}
@@ -42,7 +42,7 @@
 ///     algorithm: .smithWaterman(SmithWatermanConfig(penaltyGapStart: 8))
 /// ))
 /// ```
-public enum MatchingAlgorithm: Sendable, Equatable, Codable {
+public enum MatchingAlgorithm: Sendable, Hashable, Codable {
     /// Damerau-Levenshtein edit distance with multi-phase scoring pipeline.
     ///
     /// - Parameter config: Configuration for edit distance scoring.
@@ -115,7 +115,7 @@ public enum MatchingAlgorithm: Sendable, Equatable, Codable {
 /// // No gap penalty
 /// let config3 = EditDistanceConfig(gapPenalty: .none)
 /// ```
-public enum GapPenalty: Sendable, Equatable, Codable {
+public enum GapPenalty: Sendable, Hashable, Codable {
     /// No penalty for gaps between matched characters.
     case none
 
@@ -258,7 +258,7 @@ public enum GapPenalty: Sendable, Equatable, Codable {
 ///     firstMatchBonus: 0.0
 /// )
 /// ```
-public struct EditDistanceConfig: Sendable, Equatable, Codable {
+public struct EditDistanceConfig: Sendable, Hashable, Codable {
     /// Maximum allowed edit distance for a match to be considered valid.
     ///
     /// Edit distance is the minimum number of single-character edits (insertions,
@@ -595,7 +595,7 @@ public struct EditDistanceConfig: Sendable, Equatable, Codable {
 ///
 /// let matcher = FuzzyMatcher(config: autocompleteConfig)
 /// ```
-public struct MatchConfig: Sendable, Equatable, Codable {
+public struct MatchConfig: Sendable, Hashable, Codable {
     /// Minimum score threshold (0.0 to 1.0) for a match to be returned.
     ///
     /// Candidates with scores below this threshold are rejected even if they
@@ -0,0 +1,108 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+/// A prebuilt collection of records with several searchable string fields.
+///
+/// ## Overview
+///
+/// Searching several fields of a record (a symbol, a name and an ISIN) with one
+/// ``FuzzyCorpus`` per field takes one full pass per field and a merge of the
+/// per-field results. `MultiFieldCorpus` keeps one corpus column set per field. Its
+/// searches sweep the prefilter columns of every field and then score each
+/// surviving record's fields together in a single pass in record order. A record
+/// ranks by its best weighted field score.
+///
+/// Field `f` of record `r` is available as `corpus[r, f]`.
+///
+/// ## Example
+///
+/// ```swift
+/// struct Instrument {
+///     let symbol: String
+///     let name: String
+///     let isin: String
+/// }
+///
+/// let corpus = MultiFieldCorpus(instruments, fields: [\.symbol, \.name, \.isin])
+/// let matcher = FuzzyMatcher()
+/// let results = matcher.topMatches(corpus, against: matcher.prepare("aapl"), weights: [1.0, 0.9, 1.0])
+/// for result in results {
+///     print(instruments[result.record].name, result.field, result.score)
+/// }
+/// ```
+///
+/// ## Thread Safety
+///
+/// `MultiFieldCorpus` is immutable and `Sendable`. Multiple threads can search the
+/// same corpus simultaneously.
+public struct MultiFieldCorpus: Sendable {
+    /// One corpus per field, each holding every record's value of that field.
+    @usableFromInline let fields: [FuzzyCorpus]
+
+    /// Number of records.
+    public let recordCount: Int
+
+    /// Builds a multi-field corpus from records and the key paths of their searchable fields.
+    ///
+    /// Records keep their order; the record at position `r` of the sequence is record `r`.
+    ///
+    /// - Parameters:
+    ///   - records: The records to index.
+    ///   - fields: Key paths to the string fields to search, in field order. Must not
+    ///     be empty.
+    ///   - buildTrigramIndex: Whether to build a trigram index for each field. Default
+    ///     is `false`.
+    public init<Record>(
+        _ records: some Sequence<Record>,
+        fields: [KeyPath<Record, String>],
+        buildTrigramIndex: Bool = false
+    ) {
+        precondition(!fields.isEmpty, "a multi-field corpus needs at least one field")
+        var arenas = [[UInt8]](repeating: [], count: fields.count)
+        var offsets = [[Int]](repeating: [0], count: fields.count)
+        var recordCount = 0
+        for record in records {
+            for field in fields.indices {
+                arenas[field].append(contentsOf: record[keyPath: fields[field]].utf8)
+                offsets[field].append(arenas[field].count)
+            }
+            recordCount += 1
+        }
+        self.fields = fields.indices.map {
+            FuzzyCorpus(utf8: arenas[$0], offsets: offsets[$0], buildTrigramIndex: buildTrigramIndex)
+        }
+        self.recordCount = recordCount
+    }
+
+    /// Builds a multi-field corpus from one string column per field.
+    ///
+    /// - Parameters:
+    ///   - columns: The values of each field, in field order. All columns must have
+    ///     the same number of records, and there must be at least one column.
+    ///   - buildTrigramIndex: Whether to build a trigram index for each field. Default
+    ///     is `false`.
+    public init(columns: [[String]], buildTrigramIndex: Bool = false) {
+        precondition(!columns.isEmpty, "a multi-field corpus needs at least one field")
+        precondition(columns.allSatisfy { $0.count == columns[0].count }, "all columns must have the same length")
+        self.fields = columns.map { FuzzyCorpus($0, buildTrigramIndex: buildTrigramIndex) }
+        self.recordCount = columns[0].count
+    }
+
+    /// Number of searchable fields per record.
+    public var fieldCount: Int { fields.count }
+
+    /// The value of `field` in the record at `record`.
+    public subscript(record: Int, field: Int) -> String {
+        fields[field][record]
+    }
+}
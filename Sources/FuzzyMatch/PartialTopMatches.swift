@@ -0,0 +1,389 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+/// The top matches of one shard of a search, ready to be merged with other shards'.
+///
+/// ## Overview
+///
+/// A corpus too large for one process can be split into shards that each hold a
+/// contiguous range of the candidates. A coordinator sends the query text and its
+/// ``MatchConfig`` to every shard, each shard searches its corpus with
+/// ``FuzzyMatcher/partialTopMatches(_:against:limit:firstOrdinal:)``, and the
+/// coordinator merges the partial results it gets back with ``merged(_:limit:)``.
+///
+/// Every entry keeps its *ordinal*: the candidate's position in the whole,
+/// unsharded candidate list, obtained by passing the shard's first position as
+/// `firstOrdinal`. Entries rank by score, then by lower ordinal, exactly like the
+/// single-corpus `topMatches`, so the merged results are identical to searching
+/// all candidates in one corpus, whichever shards finish first.
+///
+/// ## Wire Encoding
+///
+/// ``encoded()`` produces a compact binary form to send between processes, and
+/// ``init(encoded:)`` reads it back. Scores travel as their exact bit patterns, so
+/// a decoded value compares equal to the original and merged results are
+/// byte-identical to an unsharded run.
+///
+/// | Field | Encoding |
+/// |-------|----------|
+/// | Magic | `FZMTOPK\0` |
+/// | Format version | `UInt32`, little-endian |
+/// | Limit, entry count | LEB128 varints |
+/// | Each entry: score | bit pattern as `UInt64`, little-endian |
+/// | Each entry: match kind | one byte |
+/// | Each entry: ordinal | varint of the `Int64` bit pattern |
+/// | Each entry: candidate | UTF-8 length as a varint, then the bytes |
+///
+/// Unlike corpus snapshots, the encoding does not depend on the host's byte order
+/// or word size.
+///
+/// ## Example
+///
+/// ```swift
+/// // On shard `k`, holding candidates `shardStart..<shardEnd`
+/// let query = matcher.prepare(text)
+/// let partial = await matcher.partialTopMatches(
+///     shard, against: query, limit: 10, firstOrdinal: shardStart, concurrency: cores
+/// )
+/// reply(partial.encoded())
+///
+/// // On the coordinator
+/// let partials = try replies.map { try PartialTopMatches(encoded: $0) }
+/// let results = PartialTopMatches.merged(partials, limit: 10).results
+/// ```
+public struct PartialTopMatches: Sendable, Hashable {
+    /// A retained match with its position in the unsharded candidate list.
+    public struct Entry: Sendable, Hashable {
+        /// The matched candidate and its score.
+        public let result: MatchResult
+
+        /// The candidate's position in the unsharded candidate list; lower ordinals
+        /// win ties.
+        public let ordinal: Int
+
+        /// Creates an entry.
+        public init(result: MatchResult, ordinal: Int) {
+            self.result = result
+            self.ordinal = ordinal
+        }
+
+        /// Whether `self` ranks ahead of `other`: higher score, then lower ordinal.
+        func ranksAhead(of other: Entry) -> Bool {
+            TopKCollector<MatchResult>.ranksBelow(other.result.match.score, other.ordinal, result.match.score, ordinal)
+        }
+    }
+
+    /// Errors thrown when decoding an encoded value.
+    public enum DecodingError: Error, Equatable, Sendable {
+        /// The data does not start with the magic bytes.
+        case notPartialTopMatches
+        /// The data uses a format version this library cannot read.
+        case unsupportedVersion(UInt32)
+        /// The data ends before the encoded value does.
+        case truncated
+        /// The data holds an invalid field, such as an unknown match kind,
+        /// malformed UTF-8, or more entries than the limit.
+        case corrupted
+    }
+
+    /// The maximum number of entries retained.
+    public let limit: Int
+
+    /// The retained entries, best first.
+    public private(set) var entries: [Entry]
+
+    /// Creates an empty value.
+    ///
+    /// - Parameter limit: The maximum number of entries to retain. Values below `0`
+    ///   are treated as `0`.
+    public init(limit: Int) {
+        self.limit = max(0, limit)
+        self.entries = []
+    }
+
+    /// Creates a value from entries in any order, keeping the best `limit`.
+    ///
+    /// Ordinals should be unique across everything that is merged.
+    public init(limit: Int, entries: some Sequence<Entry>) {
+        self.limit = max(0, limit)
+        var sorted = Array(entries)
+        sorted.sort { $0.ranksAhead(of: $1) }
+        self.entries = Array(sorted.prefix(self.limit))
+    }
+
+    init(_ top: TopKCollector<MatchResult>) {
+        self.limit = top.limit
+        self.entries = top.sortedScoredElements().map { Entry(result: $0.element, ordinal: $0.ordinal) }
+    }
+
+    /// The retained matches, best first.
+    public var results: [MatchResult] {
+        entries.map(\.result)
+    }
+
+    /// The number of retained entries.
+    public var count: Int { entries.count }
+
+    /// Whether no entry is retained.
+    public var isEmpty: Bool { entries.isEmpty }
+
+    // MARK: - Merging
+
+    /// Merges the entries of `other`, keeping the best ``limit`` of both.
+    public mutating func merge(_ other: PartialTopMatches) {
+        var merged: [Entry] = []
+        merged.reserveCapacity(min(limit, entries.count + other.entries.count))
+        var left = 0
+        var right = 0
+        while merged.count < limit && (left < entries.count || right < other.entries.count) {
+            if right == other.entries.count
+                || (left < entries.count && !other.entries[right].ranksAhead(of: entries[left])) {
+                merged.append(entries[left])
+                left += 1
+            } else {
+                merged.append(other.entries[right])
+                right += 1
+            }
+        }
+        entries = merged
+    }
+
+    /// Merges any number of partial results into the best `limit` entries of all of them.
+    ///
+    /// The result does not depend on the order of `partials`.
+    public static func merged(_ partials: some Sequence<PartialTopMatches>, limit: Int) -> PartialTopMatches {
+        var result = PartialTopMatches(limit: limit)
+        for partial in partials {
+            result.merge(partial)
+        }
+        return result
+    }
+
+    // MARK: - Wire Encoding
+
+    /// `FZMTOPK\0`.
+    static let magic: [UInt8] = [0x46, 0x5A, 0x4D, 0x54, 0x4F, 0x50, 0x4B, 0x00]
+
+    /// Bumped whenever the encoding changes.
+    static let version: UInt32 = 1
+
+    /// Encodes the value in the compact binary wire format.
+    public func encoded() -> [UInt8] {
+        var writer = WireWriter()
+        writer.bytes.reserveCapacity(24 + entries.reduce(0) { $0 + 12 + $1.result.candidate.utf8.count })
+        writer.bytes.append(contentsOf: Self.magic)
+        writer.appendLittleEndian(Self.version)
+        writer.appendVarint(UInt64(limit))
+        writer.appendVarint(UInt64(entries.count))
+        for entry in entries {
+            writer.appendLittleEndian(entry.result.match.score.bitPattern)
+            writer.bytes.append(entry.result.match.kind.wireCode)
+            writer.appendVarint(UInt64(bitPattern: Int64(entry.ordinal)))
+            let candidate = entry.result.candidate.utf8
+            writer.appendVarint(UInt64(candidate.count))
+            writer.bytes.append(contentsOf: candidate)
+        }
+        return writer.bytes
+    }
+
+    /// Decodes a value produced by ``encoded()``.
+    ///
+    /// - Parameter encoded: The encoded bytes.
+    /// - Throws: ``DecodingError`` if the bytes are not a valid encoding.
+    public init(encoded: [UInt8]) throws(DecodingError) {
+        let result = encoded.withUnsafeBytes { bytes in
+            Result { () throws(DecodingError) in try PartialTopMatches(encoded: bytes) }
+        }
+        self = try result.get()
+    }
+
+    /// Decodes a value produced by ``encoded()`` from bytes in memory, such as a
+    /// received network buffer. `encoded` isn't referenced after the initializer returns.
+    ///
+    /// - Parameter encoded: The encoded bytes.
+    /// - Throws: ``DecodingError`` if the bytes are not a valid encoding.
+    public init(encoded: UnsafeRawBufferPointer) throws(DecodingError) {
+        var reader = WireReader(bytes: encoded)
+        for byte in Self.magic {
+            guard try reader.readByte() == byte else { throw .notPartialTopMatches }
+        }
+        let version = try reader.readLittleEndian(UInt32.self)
+        guard version == Self.version else { throw .unsupportedVersion(version) }
+        let limit64 = try reader.readVarint()
+        let count64 = try reader.readVarint()
+        // Every entry takes at least 11 bytes, which bounds the allocation below.
+        guard limit64 <= UInt64(Int.max), count64 <= limit64 else { throw .corrupted }
+        guard count64 <= UInt64(reader.remaining / 11) else { throw .truncated }
+
+        var entries: [Entry] = []
+        entries.reserveCapacity(Int(count64))
+        for _ in 0..<Int(count64) {
+            let score = Double(bitPattern: try reader.readLittleEndian(UInt64.self))
+            guard let kind = MatchKind(wireCode: try reader.readByte()), !score.isNaN else { throw .corrupted }
+            // Ordinals beyond a 32-bit host's `Int` cannot come from a corpus it holds
+            guard let ordinal = Int(exactly: Int64(bitPattern: try reader.readVarint())) else { throw .corrupted }
+            let length = try reader.readVarint()
+            guard length <= UInt64(reader.remaining) else { throw .truncated }
+            guard let candidate = String(validating: reader.readBytes(Int(length)), as: UTF8.self) else {
+                throw .corrupted
+            }
+            let match = ScoredMatch(score: score, kind: kind)
+            entries.append(Entry(result: MatchResult(candidate: candidate, match: match), ordinal: ordinal))
+        }
+        guard reader.remaining == 0 else { throw .corrupted }
+        self.init(limit: Int(limit64), entries: entries)
+    }
+}
+
+// MARK: - Sharded Searches
+
+extension FuzzyMatcher {
+    /// Returns the top matches of one shard of a sharded corpus, for merging with
+    /// the other shards' results.
+    ///
+    /// Ranks exactly like the corpus `topMatches(_:against:limit:)`, with candidate
+    /// `i` of `corpus` carrying ordinal `firstOrdinal + i`.
+    ///
+    /// - Parameters:
+    ///   - corpus: The shard's corpus.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - limit: Maximum number of entries to return. Use the same limit on every
+    ///     shard as in the final merge. Default is `10`.
+    ///   - firstOrdinal: The position of the shard's first candidate in the whole,
+    ///     unsharded candidate list. Default is `0`.
+    /// - Returns: The shard's best entries.
+    public func partialTopMatches(
+        _ corpus: FuzzyCorpus,
+        against query: FuzzyQuery,
+        limit: Int = 10,
+        firstOrdinal: Int = 0
+    ) -> PartialTopMatches {
+        var survivors: [UInt32] = []
+        corpus.collectPrefilterSurvivors(for: query, into: &survivors)
+        var top = TopKCollector<MatchResult>(limit: limit)
+        collectTopMatches(corpus, indices: survivors, against: query, into: &top, firstOrdinal: firstOrdinal)
+        return PartialTopMatches(top)
+    }
+
+    /// Returns the top matches of one shard of a sharded corpus, scoring chunks of it
+    /// concurrently as the parallel corpus `topMatches(_:against:limit:concurrency:)` does.
+    ///
+    /// - Parameters:
+    ///   - corpus: The shard's corpus.
+    ///   - query: A prepared query from ``prepare(_:)``.
+    ///   - limit: Maximum number of entries to return. Default is `10`.
+    ///   - firstOrdinal: The position of the shard's first candidate in the whole,
+    ///     unsharded candidate list. Default is `0`.
+    ///   - concurrency: Maximum number of concurrent scoring tasks.
+    /// - Returns: The shard's best entries.
+    public func partialTopMatches(
+        _ corpus: FuzzyCorpus,
+        against query: FuzzyQuery,
+        limit: Int = 10,
+        firstOrdinal: Int = 0,
+        concurrency: Int
+    ) async -> PartialTopMatches {
+        let top = await collectTopMatches(
+            corpus,
+            against: query,
+            limit: limit,
+            firstOrdinal: firstOrdinal,
+            concurrency: concurrency
+        )
+        return PartialTopMatches(top)
+    }
+}
+
+// MARK: - Wire Coding
+
+extension MatchKind {
+    /// The kind's byte in the wire encoding; fixed, independent of declaration order.
+    var wireCode: UInt8 {
+        switch self {
+        case .exact: 0
+        case .prefix: 1
+        case .substring: 2
+        case .acronym: 3
+        case .alignment: 4
+        }
+    }
+
+    init?(wireCode: UInt8) {
+        switch wireCode {
+        case 0: self = .exact
+        case 1: self = .prefix
+        case 2: self = .substring
+        case 3: self = .acronym
+        case 4: self = .alignment
+        default: return nil
+        }
+    }
+}
+
+/// Appends little-endian integers and LEB128 varints.
+internal struct WireWriter {
+    var bytes: [UInt8] = []
+
+    mutating func appendLittleEndian<T: FixedWidthInteger>(_ value: T) {
+        withUnsafeBytes(of: value.littleEndian) { bytes.append(contentsOf: $0) }
+    }
+
+    mutating func appendVarint(_ value: UInt64) {
+        var value = value
+        while value >= 0x80 {
+            bytes.append(UInt8(truncatingIfNeeded: value) | 0x80)
+            value >>= 7
+        }
+        bytes.append(UInt8(value))
+    }
+}
+
+/// Reads little-endian integers and LEB128 varints, throwing on truncation.
+internal struct WireReader {
+    let bytes: UnsafeRawBufferPointer
+    var offset = 0
+
+    var remaining: Int { bytes.count - offset }
+
+    mutating func readByte() throws(PartialTopMatches.DecodingError) -> UInt8 {
+        guard offset < bytes.count else { throw .truncated }
+        defer { offset += 1 }
+        return bytes[offset]
+    }
+
+    mutating func readLittleEndian<T: FixedWidthInteger>(_: T.Type) throws(PartialTopMatches.DecodingError) -> T {
+        let size = MemoryLayout<T>.size
+        guard remaining >= size else { throw .truncated }
+        let value = bytes.loadUnaligned(fromByteOffset: offset, as: T.self)
+        offset += size
+        return T(littleEndian: value)
+    }
+
+    mutating func readVarint() throws(PartialTopMatches.DecodingError) -> UInt64 {
+        var value: UInt64 = 0
+        var shift: UInt64 = 0
+        while true {
+            let byte = try readByte()
+            guard shift < 64, shift < 63 || byte <= 1 else { throw .corrupted }
+            value |= UInt64(byte & 0x7F) << shift
+            if byte < 0x80 { return value }
+            shift += 7
+        }
+    }
+
+    /// Returns the next `count` bytes; the caller checks `remaining` first.
+    mutating func readBytes(_ count: Int) -> UnsafeRawBufferPointer {
+        defer { offset += count }
+        return UnsafeRawBufferPointer(rebasing: bytes[offset..<(offset + count)])
+    }
+}
@@ -193,6 +193,14 @@ internal func lowercaseCyrillic(lead: UInt8, second: UInt8) -> (UInt8, UInt8) {
 ///   - destination: Pre-allocated array to write lowercased bytes into.
 ///   - isASCII: If `true`, uses the faster ASCII-only path (no multi-byte dispatch).
 /// - Returns: The number of bytes written to `destination`.
+///
+/// ## Performance Note
+///
+/// Both paths work in 16-byte blocks: a block with no byte `>= 0x80` is
+/// lowercased with ``lowercaseASCIIBlock(_:)`` and stored in one go. On the
+/// general path only blocks that contain a multi-byte lead fall back to the
+/// per-byte dispatch, and a character that straddles the block end is finished
+/// before the next block is loaded.
 @inlinable @discardableResult
 internal func lowercaseUTF8(
     from source: Span<UInt8>,
@@ -200,53 +208,93 @@ internal func lowercaseUTF8(
     isASCII: Bool
 ) -> Int {
     let count = source.count
+    let bytes = source.bytes
     if isASCII {
-        for i in 0..<count {
+        var i = 0
+        while i &+ 16 <= count {
+            let block = bytes.unsafeLoadUnaligned(fromByteOffset: i, as: SIMD16<UInt8>.self)
+            storeBlock(lowercaseASCIIBlock(block), into: &destination, at: i)
+            i &+= 16
+        }
+        while i < count {
             destination[i] = lowercaseASCII(source[i])
+            i &+= 1
         }
         return count
     } else {
         var i = 0
         var outIdx = 0
         while i < count {
-            let byte = source[i]
-            // Skip combining diacritical marks (U+0300–U+036F)
-            if i + 1 < count && isCombiningMark(lead: byte, second: source[i + 1]) {
-                i += 2
-            } else if byte == 0xC3 && i + 1 < count {
-                let lowered = lowercaseLatinExtended(source[i + 1])
-                let ascii = latin1ToASCII(lowered)
-                if ascii != 0 {
-                    destination[outIdx] = ascii
-                    outIdx += 1
-                } else {
-                    destination[outIdx] = byte
-                    destination[outIdx + 1] = lowered
+            if i &+ 16 <= count {
+                let block = bytes.unsafeLoadUnaligned(fromByteOffset: i, as: SIMD16<UInt8>.self)
+                if !any(block .>= 0x80) {
+                    // outIdx <= i, so the store stays within source.count
+                    storeBlock(lowercaseASCIIBlock(block), into: &destination, at: outIdx)
+                    i &+= 16
+                    outIdx &+= 16
+                    continue
+                }
+            }
+            let blockEnd = min(i &+ 16, count)
+            while i < blockEnd {
+                let byte = source[i]
+                // Skip combining diacritical marks (U+0300–U+036F)
+                if i + 1 < count && isCombiningMark(lead: byte, second: source[i + 1]) {
+                    i += 2
+                } else if byte == 0xC3 && i + 1 < count {
+                    let lowered = lowercaseLatinExtended(source[i + 1])
+                    let ascii = latin1ToASCII(lowered)
+                    if ascii != 0 {
+                        destination[outIdx] = ascii
+                        outIdx += 1
+                    } else {
+                        destination[outIdx] = byte
+                        destination[outIdx + 1] = lowered
+                        outIdx += 2
+                    }
+                    i += 2
+                } else if (byte == 0xCE || byte == 0xCF) && i + 1 < count {
+                    let (newLead, newSecond) = lowercaseGreek(lead: byte, second: source[i + 1])
+                    destination[outIdx] = newLead
+                    destination[outIdx + 1] = newSecond
+                    outIdx += 2
+                    i += 2
+                } else if (byte == 0xD0 || byte == 0xD1) && i + 1 < count {
+                    let (newLead, newSecond) = lowercaseCyrillic(lead: byte, second: source[i + 1])
+                    destination[outIdx] = newLead
+                    destination[outIdx + 1] = newSecond
                     outIdx += 2
+                    i += 2
+                } else {
+                    destination[outIdx] = lowercaseASCII(byte)
+                    outIdx += 1
+                    i += 1
                 }
-                i += 2
-            } else if (byte == 0xCE || byte == 0xCF) && i + 1 < count {
-                let (newLead, newSecond) = lowercaseGreek(lead: byte, second: source[i + 1])
-                destination[outIdx] = newLead
-                destination[outIdx + 1] = newSecond
-                outIdx += 2
-                i += 2
-            } else if (byte == 0xD0 || byte == 0xD1) && i + 1 < count {
-                let (newLead, newSecond) = lowercaseCyrillic(lead: byte, second: source[i + 1])
-                destination[outIdx] = newLead
-                destination[outIdx + 1] = newSecond
-                outIdx += 2
-                i += 2
-            } else {
-                destination[outIdx] = lowercaseASCII(byte)
-                outIdx += 1
-                i += 1
             }
         }
         return outIdx
     }
 }
 
+/// Lowercases the ASCII letters of a 16-byte block: one wrapping subtract and
+/// unsigned compare find `A`–`Z`, and those lanes get bit 5 set.
+///
+/// Bytes `>= 0x80` are left unchanged, like ``lowercaseASCII(_:)``.
+@inlinable
+internal func lowercaseASCIIBlock(_ block: SIMD16<UInt8>) -> SIMD16<UInt8> {
+    let isUpper = (block &- 0x41) .< 26
+    return block.replacing(with: block | 0x20, where: isUpper)
+}
+
+/// Stores a 16-byte block at `offset`; `destination` must hold `offset + 16` bytes.
+@inlinable
+internal func storeBlock(_ block: SIMD16<UInt8>, into destination: inout [UInt8], at offset: Int) {
+    precondition(offset &+ 16 <= destination.count)
+    destination.withUnsafeMutableBytes { buffer in
+        buffer.storeBytes(of: block, toByteOffset: offset, as: SIMD16<UInt8>.self)
+    }
+}
+
 /// Maps a 2-byte UTF-8 character pair into a bit position in the extended bitmask.
 ///
 /// Hashes the lowercased (lead, second) pair into bits 37–63 (27 available bits)
@@ -393,9 +441,10 @@ internal let charBitmaskMask: UInt64 = (UInt64(1) << 37) &- 1
 
 /// Computes a case-insensitive character bitmask and detects ASCII in a single O(n) pass.
 ///
-/// Uses a 256-entry lookup table: one table load + one OR per byte with zero branches
-/// in the ASCII fast path. If a non-ASCII byte is detected (via bit 63 sentinel),
-/// falls back to the general multi-byte path.
+/// Sweeps 16-byte vector blocks, then finishes with a 256-entry lookup table: one
+/// table load + one OR per byte with zero branches. If a non-ASCII byte is detected
+/// (by a block compare or the bit 63 sentinel), falls back to the general
+/// multi-byte path.
 ///
 /// - Parameter bytes: Raw UTF-8 bytes (not necessarily lowercased).
 /// - Returns: A tuple of (bitmask, isASCII) where bitmask has bits set for present character types
@@ -407,12 +456,35 @@ internal let charBitmaskMask: UInt64 = (UInt64(1) << 37) &- 1
 /// Adding a per-byte early-exit check (e.g. `if mask & queryMask == queryMask`) was
 /// benchmarked and caused a ~10% regression: the added data-dependent branch prevents
 /// compiler auto-vectorization and adds pipeline overhead that outweighs any savings
-/// from scanning fewer bytes on typical-length candidates (20-50 bytes).
+/// from scanning fewer bytes on typical-length candidates (20-50 bytes). The vector
+/// sweep's only branch is the per-block non-ASCII test, which is taken at most once.
+///
+/// Inputs of 16 bytes or more are swept 16 bytes at a time with vector compares
+/// (see ``accumulateCharBitmaskBlock(_:letters:others:)``), leaving only the last
+/// `count % 16` bytes to the table. The first block holding a byte `>= 0x80` ends
+/// the sweep and goes straight to the multi-byte path.
 @inlinable
 internal func computeCharBitmaskWithASCIICheck(_ bytes: Span<UInt8>) -> (mask: UInt64, isASCII: Bool) {
+    let count = bytes.count
     var mask: UInt64 = 0
-    for i in 0..<bytes.count {
+    var i = 0
+    if count >= 16 {
+        let raw = bytes.bytes
+        var letters = SIMD16<UInt32>(repeating: 0)
+        var others = SIMD16<UInt32>(repeating: 0)
+        while i &+ 16 <= count {
+            let block = raw.unsafeLoadUnaligned(fromByteOffset: i, as: SIMD16<UInt8>.self)
+            if any(block .>= 0x80) {
+                return (computeCharBitmaskCaseInsensitive(bytes), false)
+            }
+            accumulateCharBitmaskBlock(block, letters: &letters, others: &others)
+            i &+= 16
+        }
+        mask = UInt64(orReduce(letters)) | UInt64(orReduce(others)) << 26
+    }
+    while i < count {
         mask |= charBitmaskLookup[Int(bytes[i])]
+        i &+= 1
     }
     // Check sentinel bit: if set, at least one byte was >= 0x80
     if mask & (UInt64(1) << 63) != 0 {
@@ -421,6 +493,42 @@ internal func computeCharBitmaskWithASCIICheck(_ bytes: Span<UInt8>) -> (mask: U
     return (mask, true)
 }
 
+/// ORs the character bits of an all-ASCII 16-byte block into per-lane accumulators.
+///
+/// `letters` collects bits 0–25 (`a`–`z`, case-insensitive) and `others` collects
+/// digits and underscore as bits 0–10, which are bits 26–36 of the full mask once
+/// shifted. Each class is found with a wrapping subtract and one unsigned compare,
+/// and each lane contributes `1 << index` through a per-lane variable shift; the
+/// lanes are folded with ``orReduce(_:)`` once per input, not per block.
+@inlinable
+internal func accumulateCharBitmaskBlock(
+    _ block: SIMD16<UInt8>,
+    letters: inout SIMD16<UInt32>,
+    others: inout SIMD16<UInt32>
+) {
+    let zero = SIMD16<UInt8>(repeating: 0)
+    let letterIndex = (block | 0x20) &- 0x61
+    let isLetter = letterIndex .< 26
+    let digitIndex = block &- 0x30
+    let isUnderscore = block .== 0x5F
+    let isOther = (digitIndex .< 10) .| isUnderscore
+    let otherIndex = digitIndex.replacing(with: 10, where: isUnderscore)
+
+    let letterOnes = SIMD16<UInt32>(truncatingIfNeeded: zero.replacing(with: 1, where: isLetter))
+    let otherOnes = SIMD16<UInt32>(truncatingIfNeeded: zero.replacing(with: 1, where: isOther))
+    letters |= letterOnes &<< SIMD16<UInt32>(truncatingIfNeeded: letterIndex)
+    others |= otherOnes &<< SIMD16<UInt32>(truncatingIfNeeded: otherIndex)
+}
+
+/// ORs the lanes of a vector together.
+@inlinable
+internal func orReduce(_ vector: SIMD16<UInt32>) -> UInt32 {
+    let eight = vector.lowHalf | vector.highHalf
+    let four = eight.lowHalf | eight.highHalf
+    let two = four.lowHalf | four.highHalf
+    return two[0] | two[1]
+}
+
 /// Checks if a candidate passes the length bounds prefilter.
 ///
 /// This check rejects candidates that are impossibly short. The minimum length
@@ -501,3 +609,199 @@ internal func passesCharBitmask(
     let missingChars = queryMask & ~candidateMask
     return missingChars.nonzeroBitCount <= maxEditDistance
 }
+
+/// Applies the length bounds and character bitmask prefilters to whole columns of
+/// precomputed candidate data, appending the indices of surviving candidates.
+///
+/// A candidate at index `i` survives when
+/// `popcount(queryMask & ~charBitmasks[i]) <= maxMissingCharacters` and
+/// `lengths[i] >= minCandidateLength` — the same predicates as
+/// ``passesCharBitmask(queryMask:candidateMask:maxEditDistance:)`` and
+/// ``passesLengthBounds(candidateLength:queryLength:maxEditDistance:)``.
+///
+/// - Parameters:
+///   - charBitmasks: Candidate bitmasks from ``computeCharBitmaskWithASCIICheck(_:)``.
+///   - lengths: Candidate UTF-8 lengths, parallel to `charBitmasks`.
+///   - queryMask: The query's character bitmask.
+///   - maxMissingCharacters: Bitmask tolerance (number of query character types
+///     that may be absent from the candidate).
+///   - minCandidateLength: Minimum candidate length; `0` disables the length check.
+///   - survivors: Receives the surviving indices in ascending order. Existing
+///     contents are discarded; capacity is kept.
+///
+/// ## Performance Note
+///
+/// Candidates are processed eight at a time: one `SIMD8<UInt64>` load of masks and
+/// one `SIMD8<UInt32>` load of lengths, a vector popcount and two lane-wise compares.
+/// Blocks where no lane passes are skipped with a single `any` test, so on selective
+/// queries the sweep runs at close to memory bandwidth and never touches candidate
+/// bytes. Lengths use 32-bit lanes so each length block lines up with a mask block.
+@inlinable
+internal func sweepPrefilters(
+    charBitmasks: [UInt64],
+    lengths: [UInt32],
+    queryMask: UInt64,
+    maxMissingCharacters: Int,
+    minCandidateLength: Int,
+    into survivors: inout [UInt32]
+) {
+    survivors.removeAll(keepingCapacity: true)
+    sweepPrefilters(
+        charBitmasks: charBitmasks,
+        lengths: lengths,
+        in: 0..<min(charBitmasks.count, lengths.count),
+        queryMask: queryMask,
+        maxMissingCharacters: maxMissingCharacters,
+        minCandidateLength: minCandidateLength,
+        appendingTo: &survivors
+    )
+}
+
+/// Applies the length and bitmask prefilters to the candidates at `range`,
+/// appending the indices of the survivors in ascending order.
+///
+/// The same sweep as
+/// ``sweepPrefilters(charBitmasks:lengths:queryMask:maxMissingCharacters:minCandidateLength:into:)``
+/// restricted to one slice of the columns, so a tiled search can sweep each tile
+/// while it is in cache. Existing contents of `survivors` are kept.
+@inlinable
+internal func sweepPrefilters(
+    charBitmasks: [UInt64],
+    lengths: [UInt32],
+    in range: Range<Int>,
+    queryMask: UInt64,
+    maxMissingCharacters: Int,
+    minCandidateLength: Int,
+    appendingTo survivors: inout [UInt32]
+) {
+    precondition(range.upperBound <= min(charBitmasks.count, lengths.count), "range out of bounds")
+    guard !range.isEmpty else { return }
+
+    let tolerance = UInt64(max(0, maxMissingCharacters))
+    let minLength = UInt32(clamping: max(0, minCandidateLength))
+    let vectorEnd = range.lowerBound &+ (range.count & ~7)
+
+    let queryVector = SIMD8<UInt64>(repeating: queryMask)
+    let toleranceVector = SIMD8<UInt64>(repeating: tolerance)
+    let minLengthVector = SIMD8<UInt32>(repeating: minLength)
+
+    charBitmasks.withUnsafeBufferPointer { maskBuffer in
+        lengths.withUnsafeBufferPointer { lengthBuffer in
+            let maskBase = UnsafeRawPointer(maskBuffer.baseAddress!)
+            let lengthBase = UnsafeRawPointer(lengthBuffer.baseAddress!)
+
+            var base = range.lowerBound
+            while base < vectorEnd {
+                let masks = maskBase.loadUnaligned(
+                    fromByteOffset: base &* MemoryLayout<UInt64>.stride,
+                    as: SIMD8<UInt64>.self
+                )
+                let candidateLengths = lengthBase.loadUnaligned(
+                    fromByteOffset: base &* MemoryLayout<UInt32>.stride,
+                    as: SIMD8<UInt32>.self
+                )
+                let missing = (queryVector & ~masks).nonzeroBitCount
+                let passes = (missing .<= toleranceVector) .& (candidateLengths .>= minLengthVector)
+                if any(passes) {
+                    for lane in 0..<8 where passes[lane] {
+                        survivors.append(UInt32(truncatingIfNeeded: base &+ lane))
+                    }
+                }
+                base &+= 8
+            }
+
+            // Scalar tail (fewer than 8 candidates)
+            while base < range.upperBound {
+                let missing = queryMask & ~maskBuffer[base]
+                if UInt64(missing.nonzeroBitCount) <= tolerance && lengthBuffer[base] >= minLength {
+                    survivors.append(UInt32(truncatingIfNeeded: base))
+                }
+                base &+= 1
+            }
+        }
+    }
+}
+
+/// Applies the character bitmask prefilter to a length-ordered copy of the bitmask
+/// column from position `start` on, appending the indices of surviving candidates.
+///
+/// `order[p]` is the corpus index of the bitmask at position `p`, and positions are
+/// sorted by candidate length, so every candidate from `start` on already passes the
+/// length check and the candidates before `start` are never read. A candidate
+/// survives when `popcount(queryMask & ~mask) <= maxMissingCharacters`, the same
+/// predicate as ``passesCharBitmask(queryMask:candidateMask:maxEditDistance:)``.
+///
+/// - Parameters:
+///   - charBitmasks: Candidate bitmasks in length order.
+///   - order: Corpus index of each position in `charBitmasks`.
+///   - start: First position to sweep.
+///   - queryMask: The query's character bitmask.
+///   - maxMissingCharacters: Bitmask tolerance.
+///   - survivors: Receives the surviving corpus indices in ascending order. Existing
+///     contents are discarded; capacity is kept.
+///
+/// ## Performance Note
+///
+/// The mask loop is the same eight-wide compare as
+/// ``sweepPrefilters(charBitmasks:lengths:queryMask:maxMissingCharacters:minCandidateLength:into:)``
+/// without the length column. Survivors are found in length order, so they are
+/// marked in a bitset over corpus indices and read back in ascending order, which
+/// costs one pass over `order.count / 64` words instead of a sort.
+@inlinable
+internal func sweepLengthOrderedPrefilters(
+    charBitmasks: [UInt64],
+    order: [UInt32],
+    from start: Int,
+    queryMask: UInt64,
+    maxMissingCharacters: Int,
+    into survivors: inout [UInt32]
+) {
+    survivors.removeAll(keepingCapacity: true)
+    let count = min(charBitmasks.count, order.count)
+    guard start < count else { return }
+
+    let tolerance = UInt64(max(0, maxMissingCharacters))
+    let queryVector = SIMD8<UInt64>(repeating: queryMask)
+    let toleranceVector = SIMD8<UInt64>(repeating: tolerance)
+    var passing = [UInt64](repeating: 0, count: (order.count + 63) / 64)
+
+    charBitmasks.withUnsafeBufferPointer { maskBuffer in
+        order.withUnsafeBufferPointer { orderBuffer in
+            let maskBase = UnsafeRawPointer(maskBuffer.baseAddress!)
+
+            var position = start
+            while position &+ 8 <= count {
+                let masks = maskBase.loadUnaligned(
+                    fromByteOffset: position &* MemoryLayout<UInt64>.stride,
+                    as: SIMD8<UInt64>.self
+                )
+                let passes = (queryVector & ~masks).nonzeroBitCount .<= toleranceVector
+                if any(passes) {
+                    for lane in 0..<8 where passes[lane] {
+                        let index = Int(orderBuffer[position &+ lane])
+                        passing[index &>> 6] |= UInt64(1) &<< UInt64(index & 63)
+                    }
+                }
+                position &+= 8
+            }
+
+            // Scalar tail (fewer than 8 candidates)
+            while position < count {
+                let missing = queryMask & ~maskBuffer[position]
+                if UInt64(missing.nonzeroBitCount) <= tolerance {
+                    let index = Int(orderBuffer[position])
+                    passing[index &>> 6] |= UInt64(1) &<< UInt64(index & 63)
+                }
+                position &+= 1
+            }
+        }
+    }
+
+    for word in passing.indices {
+        var bits = passing[word]
+        while bits != 0 {
+            survivors.append(UInt32(truncatingIfNeeded: word &<< 6 | bits.trailingZeroBitCount))
+            bits &= bits &- 1
+        }
+    }
+}
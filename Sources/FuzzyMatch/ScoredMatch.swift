@@ -160,6 +160,44 @@ public struct MatchResult: Sendable, Hashable, Comparable, Codable, CustomString
     }
 }
 
+/// A matched record of a ``MultiFieldCorpus``, with the field that scored best.
+///
+/// Returned by the ``MultiFieldCorpus`` overloads of
+/// ``FuzzyMatcher/topMatches(_:against:weights:limit:)`` and
+/// ``FuzzyMatcher/matches(_:against:weights:)``.
+public struct MultiFieldMatchResult: Sendable, Hashable, CustomStringConvertible {
+    /// The position of the record in the corpus.
+    public let record: Int
+
+    /// The field whose weighted score is the record's score.
+    public let field: Int
+
+    /// The unweighted match of ``field``.
+    public let match: ScoredMatch
+
+    /// The record's score: ``match``'s score times the weight of ``field``.
+    public let score: Double
+
+    /// Creates a new multi-field match result.
+    ///
+    /// - Parameters:
+    ///   - record: The position of the record in the corpus.
+    ///   - field: The field that scored best.
+    ///   - match: The unweighted match of `field`.
+    ///   - score: The weighted score of the record.
+    public init(record: Int, field: Int, match: ScoredMatch, score: Double) {
+        self.record = record
+        self.field = field
+        self.match = match
+        self.score = score
+    }
+
+    /// A textual representation of the multi-field match result.
+    public var description: String {
+        "MultiFieldMatchResult(record: \(record), field: \(field), match: \(match), score: \(score))"
+    }
+}
+
 /// A matched item paired with its score, for use with the key-path convenience API.
 ///
 /// `ItemMatchResult` is the generic counterpart of ``MatchResult``. Where `MatchResult`
@@ -215,16 +215,23 @@ internal func optimalAlignment(
 
     let matSize = candidateLen * queryLen
 
-    // Reuse traceback array for the match score matrix too (we need 3 matrices total)
-    // For simplicity, use the state arrays sized for single rows during forward pass,
-    // but store match scores in a full matrix for traceback.
+    // The match and gap matrices live in `state` and are reused across calls. Move
+    // them out for the duration of the pass so their buffer pointers don't overlap
+    // the accesses to `state.traceback` below; swapping arrays doesn't allocate.
+    var matchScores: [Double] = []
+    var gapScores: [Double] = []
+    swap(&matchScores, &state.matchScores)
+    swap(&gapScores, &state.gapScores)
+    defer {
+        swap(&matchScores, &state.matchScores)
+        swap(&gapScores, &state.gapScores)
+    }
 
-    // Stack-allocate match/gap matrices via withUnsafeTemporaryAllocation.
-    // For small matSize the runtime uses the stack; for larger sizes it falls back to heap.
-    return withUnsafeTemporaryAllocation(of: Double.self, capacity: matSize) { matchBuf in
-        withUnsafeTemporaryAllocation(of: Double.self, capacity: matSize) { gapBuf in
-            matchBuf.initialize(repeating: -.infinity)
-            gapBuf.initialize(repeating: -.infinity)
+    return matchScores.withUnsafeMutableBufferPointer { matchBuf in
+        gapScores.withUnsafeMutableBufferPointer { gapBuf in
+            // The matrices may be larger than this alignment; reset the cells it uses
+            matchBuf.baseAddress!.update(repeating: -.infinity, count: matSize)
+            gapBuf.baseAddress!.update(repeating: -.infinity, count: matSize)
 
             // Traceback: 0 = no match, 1 = from consecutive match, 2 = from gap
             for idx in 0..<matSize {
@@ -420,6 +427,40 @@ internal func calculateBonuses(
 ) -> Double {
     guard positionCount > 0 else { return 0.0 }
 
+    // Resolve the gap penalty once, so each specialization of the loop below
+    // has its penalty formula inlined instead of switching per match position
+    switch config.gapPenalty {
+    case .none:
+        return accumulateBonuses(
+            matchPositions: matchPositions, positionCount: positionCount, candidateBytes: candidateBytes,
+            boundaryMask: boundaryMask, config: config, gapCost: NoGapCost()
+        )
+    case .linear(let perCharacter):
+        return accumulateBonuses(
+            matchPositions: matchPositions, positionCount: positionCount, candidateBytes: candidateBytes,
+            boundaryMask: boundaryMask, config: config, gapCost: LinearGapCost(perCharacter: perCharacter)
+        )
+    case .affine(let open, let extend):
+        return accumulateBonuses(
+            matchPositions: matchPositions, positionCount: positionCount, candidateBytes: candidateBytes,
+            boundaryMask: boundaryMask, config: config, gapCost: AffineGapCost(open: open, extend: extend)
+        )
+    }
+}
+
+/// The bonus loop of ``calculateBonuses(matchPositions:positionCount:candidateBytes:boundaryMask:config:)``,
+/// specialized for one gap penalty model.
+@inlinable
+internal func accumulateBonuses<Gap: GapCost>(
+    matchPositions: [Int],
+    positionCount: Int,
+    candidateBytes: Span<UInt8>,
+    boundaryMask: UInt64,
+    config: EditDistanceConfig,
+    gapCost: Gap
+) -> Double {
+    let wordBoundaryBonus = config.wordBoundaryBonus
+    let consecutiveBonus = config.consecutiveBonus
     var bonus: Double = 0.0
     var previousPosition: Int = -2  // -2 so first match isn't "consecutive"
 
@@ -435,24 +476,15 @@ internal func calculateBonuses(
         }
 
         if isBoundary {
-            bonus += config.wordBoundaryBonus
+            bonus += wordBoundaryBonus
         }
 
         // Consecutive match bonus
         if candidatePosition == previousPosition + 1 {
-            bonus += config.consecutiveBonus
-        } else if i > 0 && candidatePosition > previousPosition + 1 {
+            bonus += consecutiveBonus
+        } else if Gap.chargesGaps && i > 0 && candidatePosition > previousPosition + 1 {
             // Gap penalty (for non-consecutive matches after the first)
-            let gap = candidatePosition - previousPosition - 1
-            switch config.gapPenalty {
-            case .none:
-                break
-            case .linear(let perCharacter):
-                bonus -= Double(gap) * perCharacter
-            case .affine(let open, let extend):
-                // Affine: opening penalty + extension penalty per additional character
-                bonus -= open + Double(gap - 1) * extend
-            }
+            bonus -= gapCost.penalty(forGap: candidatePosition - previousPosition - 1)
         }
 
         previousPosition = candidatePosition
@@ -471,6 +503,65 @@ internal func calculateBonuses(
     return bonus
 }
 
+/// A gap penalty model, one conforming type per ``GapPenalty`` case.
+///
+/// Bonus loops generic over `GapCost` are specialized per model, which folds the
+/// penalty formula into the loop.
+@usableFromInline
+internal protocol GapCost {
+    /// Whether gaps are charged at all; `false` removes the gap branch entirely.
+    static var chargesGaps: Bool { get }
+
+    /// The penalty for a gap of `gap` unmatched candidate bytes, `gap >= 1`.
+    func penalty(forGap gap: Int) -> Double
+}
+
+/// ``GapPenalty/none``.
+@usableFromInline
+internal struct NoGapCost: GapCost {
+    @inlinable static var chargesGaps: Bool { false }
+
+    @inlinable init() {}
+
+    @inlinable
+    func penalty(forGap gap: Int) -> Double { 0.0 }
+}
+
+/// ``GapPenalty/linear(perCharacter:)``.
+@usableFromInline
+internal struct LinearGapCost: GapCost {
+    @usableFromInline let perCharacter: Double
+
+    @inlinable static var chargesGaps: Bool { true }
+
+    @inlinable
+    init(perCharacter: Double) {
+        self.perCharacter = perCharacter
+    }
+
+    @inlinable
+    func penalty(forGap gap: Int) -> Double { Double(gap) * perCharacter }
+}
+
+/// ``GapPenalty/affine(open:extend:)``: opening penalty + extension penalty per
+/// additional character.
+@usableFromInline
+internal struct AffineGapCost: GapCost {
+    @usableFromInline let open: Double
+    @usableFromInline let extend: Double
+
+    @inlinable static var chargesGaps: Bool { true }
+
+    @inlinable
+    init(open: Double, extend: Double) {
+        self.open = open
+        self.extend = extend
+    }
+
+    @inlinable
+    func penalty(forGap gap: Int) -> Double { open + Double(gap - 1) * extend }
+}
+
 /// Scans the candidate for a contiguous byte-exact occurrence of the query.
 ///
 /// When `findMatchPositions` returns scattered positions for a short query that
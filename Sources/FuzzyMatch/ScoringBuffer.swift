@@ -95,37 +95,49 @@ internal struct EditDistanceState: Sendable {
 
 /// State for the DP-optimal alignment computation.
 ///
-/// Holds a reusable traceback matrix for the alignment DP. The actual DP rows
-/// use `withUnsafeTemporaryAllocation` for stack allocation, so only the
-/// traceback matrix needs persistent storage.
+/// Holds the reusable traceback, match score and gap score matrices for the
+/// alignment DP, each `candidateLen * queryLen` cells. The score matrices start
+/// empty and are allocated the first time an alignment needs them, then reused.
 /// Separated into its own struct to allow mutation independently from candidate storage.
 @usableFromInline
 internal struct AlignmentState: Sendable {
     /// Flat traceback matrix (candidateLen * queryLen bytes).
     @usableFromInline var traceback: [UInt8]
 
+    /// Flat match score matrix: best score with the query character matched at the
+    /// candidate position.
+    @usableFromInline var matchScores: [Double] = []
+
+    /// Flat gap score matrix: best score with the query character matched earlier
+    /// and a gap up to the candidate position.
+    @usableFromInline var gapScores: [Double] = []
+
     /// Width of the traceback matrix (= queryLen).
     @usableFromInline var tracebackWidth: Int
 
-    /// Maximum candidate length for which traceback is allocated.
-    @usableFromInline var maxTracebackCandidateLen: Int
-
-    /// Creates alignment state with the specified initial capacity.
+    /// Creates alignment state with the specified initial traceback capacity.
     @usableFromInline
     init(maxQueryLength: Int = 64, maxCandidateLength: Int = 128) {
         self.traceback = [UInt8](repeating: 0, count: maxCandidateLength * maxQueryLength)
         self.tracebackWidth = maxQueryLength
-        self.maxTracebackCandidateLen = maxCandidateLength
     }
 
     /// Ensures the buffers have sufficient capacity.
+    ///
+    /// The alignment indexes the matrices with the current query length and resets
+    /// the cells it uses, so large enough matrices are reused across query lengths.
     @inlinable
     mutating func ensureCapacity(queryLength: Int, candidateLength: Int) {
-        if candidateLength <= 512 && (traceback.count < candidateLength * queryLength || tracebackWidth != queryLength) {
-            traceback = [UInt8](repeating: 0, count: candidateLength * queryLength)
-            tracebackWidth = queryLength
-            maxTracebackCandidateLen = candidateLength
+        guard candidateLength <= 512 else { return }
+        let cellCount = candidateLength * queryLength
+        if traceback.count < cellCount {
+            traceback = [UInt8](repeating: 0, count: cellCount)
+        }
+        if matchScores.count < cellCount {
+            matchScores = [Double](repeating: -.infinity, count: cellCount)
+            gapScores = [Double](repeating: -.infinity, count: cellCount)
         }
+        tracebackWidth = queryLength
     }
 }
 
@@ -141,6 +153,12 @@ internal struct AlignmentState: Sendable {
 /// so no row-swap logic is needed.
 /// Separated from ``AlignmentState`` because it uses `[Int32]` instead of `[Double]`
 /// and avoids wasted memory when only one algorithm mode is in use.
+///
+/// The vectorized kernel uses ``simdBuffer`` instead: two sets of the three rows
+/// (previous and current candidate position), each padded to a multiple of 8 lanes
+/// plus a leading zero column, followed by the query bytes widened to `Int32`.
+/// The batched kernel keeps its rows in ``batchRows``, one vector of eight
+/// candidates per query column.
 @usableFromInline
 internal struct SmithWatermanState: Sendable {
     /// Flat buffer holding 3 rows: [match | gap | consecutiveBonus].
@@ -149,11 +167,20 @@ internal struct SmithWatermanState: Sendable {
     /// Width of each row in the flat buffer.
     @usableFromInline var queryCapacity: Int
 
+    /// Flat buffer for the vectorized kernel (allocated on first use).
+    @usableFromInline var simdBuffer: [Int32]
+
+    /// Rows for the batched kernel: [match | gap | consecutiveBonus], one
+    /// `SIMD8<Int32>` per query column (allocated on first use).
+    @usableFromInline var batchRows: [SIMD8<Int32>]
+
     /// Creates Smith-Waterman state with the specified initial capacity.
     @usableFromInline
     init(maxQueryLength: Int = 64) {
         self.queryCapacity = maxQueryLength
         self.buffer = [Int32](repeating: 0, count: maxQueryLength * 3)
+        self.simdBuffer = []
+        self.batchRows = []
     }
 
     /// Ensures the buffers have sufficient capacity.
@@ -164,6 +191,60 @@ internal struct SmithWatermanState: Sendable {
             buffer = [Int32](repeating: 0, count: queryLength * 3)
         }
     }
+
+    /// Ensures ``simdBuffer`` holds at least `count` elements.
+    @inlinable
+    mutating func ensureSIMDCapacity(_ count: Int) {
+        if simdBuffer.count < count {
+            simdBuffer = [Int32](repeating: 0, count: count)
+        }
+    }
+}
+
+/// State for the batched Smith-Waterman kernel, which scores eight candidates at once.
+///
+/// Each lane has its own ``CandidateStorage`` for the lowercase-and-bonus pass. The
+/// lane bytes and bonuses are then transposed into ``characters`` and ``bonuses``
+/// (element `i` holds position `i` of every lane) for
+/// ``smithWatermanScoreBatch(query:characters:bonuses:laneLengths:rows:config:)``.
+/// Allocated on first use, so buffers that never batch pay nothing.
+@usableFromInline
+internal struct SmithWatermanBatchState: Sendable {
+    /// Number of candidates scored per kernel call.
+    @usableFromInline static let laneCount = 8
+
+    /// Per-lane lowercased bytes and bonuses.
+    @usableFromInline var lanes: [CandidateStorage]
+
+    /// Transposed lowercased bytes, `-1` past the end of a lane.
+    @usableFromInline var characters: [SIMD8<Int32>]
+
+    /// Transposed per-position bonuses.
+    @usableFromInline var bonuses: [SIMD8<Int32>]
+
+    /// Creates empty batch state; buffers are sized by ``ensureCapacity(_:)``.
+    @usableFromInline
+    init() {
+        self.lanes = []
+        self.characters = []
+        self.bonuses = []
+    }
+
+    /// Ensures every lane and the transposed rows hold at least `candidateLength` positions.
+    @inlinable
+    mutating func ensureCapacity(_ candidateLength: Int) {
+        if lanes.isEmpty {
+            lanes = (0..<Self.laneCount).map { _ in CandidateStorage(maxLength: max(128, candidateLength)) }
+        } else {
+            for lane in 0..<Self.laneCount {
+                lanes[lane].ensureCapacity(candidateLength)
+            }
+        }
+        if characters.count < candidateLength {
+            characters = [SIMD8<Int32>](repeating: SIMD8(repeating: -1), count: candidateLength)
+            bonuses = [SIMD8<Int32>](repeating: SIMD8(repeating: 0), count: candidateLength)
+        }
+    }
 }
 
 /// A reusable buffer for scoring operations to avoid allocations in the hot path.
@@ -226,6 +307,11 @@ internal struct SmithWatermanState: Sendable {
 /// 4x the high-water mark over that interval, the buffer shrinks to 2x the
 /// high-water mark. This prevents unbounded memory growth in long-running
 /// processes that occasionally see large inputs.
+///
+/// When the longest query and candidate are known up front, a fixed-capacity
+/// buffer from ``init(maxQueryLength:maxCandidateLength:)`` allocates everything
+/// once and never shrinks, so scoring within those bounds makes no heap
+/// allocations at all.
 public struct ScoringBuffer: Sendable {
     /// Storage for the lowercased candidate bytes.
     @usableFromInline var candidateStorage: CandidateStorage
@@ -245,6 +331,15 @@ public struct ScoringBuffer: Sendable {
     /// State for Smith-Waterman local alignment DP computation.
     @usableFromInline var smithWatermanState: SmithWatermanState
 
+    /// State for batched Smith-Waterman scoring (see ``FuzzyMatcher/scoreBatch(_:against:buffer:)``).
+    @usableFromInline var smithWatermanBatchState = SmithWatermanBatchState()
+
+    /// Per-stage counters for every candidate scored through this buffer.
+    ///
+    /// Only collected when the package is built with the `ScoringStatistics`
+    /// trait; otherwise every counter stays zero (see ``ScoringStatistics``).
+    public var statistics = ScoringStatistics()
+
     // MARK: - Shrink Policy
 
     @usableFromInline var highWaterCandidateLength: Int = 0
@@ -279,6 +374,46 @@ public struct ScoringBuffer: Sendable {
         self.smithWatermanState = SmithWatermanState(maxQueryLength: initialQueryCapacity)
     }
 
+    /// Creates a fixed-capacity scoring buffer for inputs up to the given lengths.
+    ///
+    /// Every scoring state — edit distance rows, match positions, the alignment
+    /// traceback and score matrices, word initials, and the scalar, vectorized
+    /// and batched Smith-Waterman rows — is allocated here at its full size for
+    /// `maxQueryLength` and `maxCandidateLength`, and the shrink policy is turned
+    /// off. Scoring a candidate of at most `maxCandidateLength` UTF-8 bytes
+    /// against a query of at most `maxQueryLength` bytes then makes no heap
+    /// allocations, which keeps allocator traffic out of latency-sensitive loops.
+    /// Longer inputs are still scored correctly; the buffer grows for them as
+    /// usual and keeps the larger capacity.
+    ///
+    /// - Parameters:
+    ///   - maxQueryLength: Longest prepared query, in lowercased UTF-8 bytes.
+    ///   - maxCandidateLength: Longest candidate, in UTF-8 bytes.
+    ///
+    /// ## Example
+    ///
+    /// ```swift
+    /// var buffer = ScoringBuffer(maxQueryLength: 64, maxCandidateLength: 256)
+    /// for candidate in symbols {
+    ///     _ = matcher.score(candidate, against: query, buffer: &buffer)
+    /// }
+    /// ```
+    public init(maxQueryLength: Int, maxCandidateLength: Int) {
+        let queryLength = max(1, maxQueryLength)
+        let candidateLength = max(1, maxCandidateLength)
+        self.init(initialQueryCapacity: queryLength, initialCandidateCapacity: candidateLength)
+
+        // Sized like the largest request each scoring path makes
+        alignmentState = AlignmentState(maxQueryLength: queryLength, maxCandidateLength: min(candidateLength, 512))
+        alignmentState.ensureCapacity(queryLength: queryLength, candidateLength: min(candidateLength, 512))
+        wordInitials = [UInt8](repeating: 0, count: max(32, candidateLength))
+        let paddedQueryLength = (queryLength + 7) & ~7
+        smithWatermanState.ensureSIMDCapacity((paddedQueryLength + 1) * 6 + paddedQueryLength)
+        smithWatermanState.batchRows = [SIMD8<Int32>](repeating: SIMD8(repeating: 0), count: queryLength * 3)
+        smithWatermanBatchState.ensureCapacity(candidateLength)
+        shrinkCheckInterval = .max
+    }
+
     /// Ensures the buffer has sufficient capacity for the given sizes.
     ///
     /// Called internally by ``FuzzyMatcher/score(_:against:buffer:)``.
@@ -348,6 +483,10 @@ public struct ScoringBuffer: Sendable {
             smithWatermanState = SmithWatermanState(maxQueryLength: targetQuery)
         }
 
+        if smithWatermanBatchState.characters.count > highWaterCandidateLength * 4 {
+            smithWatermanBatchState = SmithWatermanBatchState()
+        }
+
         // Reset tracking for next interval
         highWaterCandidateLength = 0
         highWaterQueryLength = 0
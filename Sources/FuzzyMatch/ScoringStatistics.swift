@@ -0,0 +1,317 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+/// Per-stage counters for the scoring pipeline, collected in a ``ScoringBuffer``.
+///
+/// Every candidate scored through a buffer walks a fixed sequence of stages: the
+/// length and character-bitmask prefilters, lowercasing, the trigram prefilter, the
+/// exact-match check, the score bound, and then the edit distance phases or the
+/// Smith-Waterman DP, with the DP-optimal alignment nested inside the edit distance
+/// phases. For each stage the collector counts how many candidates entered it and
+/// how many passed on to the next one, which shows where candidates are rejected and
+/// how much work reaches the expensive stages — the numbers to look at when tuning
+/// ``EditDistanceConfig/maxEditDistance`` or the bitmask tolerance that follows
+/// from it.
+///
+/// Collection is compiled out unless the package is built with the
+/// `ScoringStatistics` trait, so the default build pays nothing for it:
+///
+/// ```swift
+/// .package(url: "https://github.com/ordo-one/FuzzyMatch", from: "1.0.0", traits: ["ScoringStatistics"])
+/// ```
+///
+/// Without the trait every counter stays zero and ``isEnabled`` is `false`.
+///
+/// ## Timing
+///
+/// Set ``timingSampleInterval`` to time every n-th candidate as well. A timed
+/// candidate reads a monotonic clock at every stage transition and adds the elapsed
+/// wall-clock nanoseconds to the stage it leaves; alignment time is subtracted from
+/// the edit distance stage that encloses it. Reading the clock costs tens of
+/// nanoseconds, so short stages are overstated and the totals are best compared
+/// relative to each other.
+///
+/// ## Example
+///
+/// ```swift
+/// var buffer = matcher.makeBuffer()
+/// buffer.statistics.timingSampleInterval = 64
+/// for candidate in candidates {
+///     _ = matcher.score(candidate, against: query, buffer: &buffer)
+/// }
+/// for stage in ScoringStatistics.Stage.allCases {
+///     let counts = buffer.statistics[stage]
+///     print("\(stage): \(counts.entered) in, \(counts.passed) passed")
+/// }
+/// ```
+///
+/// Statistics accumulate in the buffer passed to ``FuzzyMatcher/score(_:against:buffer:)``
+/// and the other buffer-taking methods; convenience methods that create their own
+/// buffers, such as `topMatches`, do not expose them. Merge the statistics of
+/// per-task buffers with ``merge(_:)``.
+public struct ScoringStatistics: Sendable, Equatable {
+    /// A stage of the scoring pipeline, in the order candidates reach them.
+    public enum Stage: Int, CaseIterable, Sendable, CustomStringConvertible {
+        /// Candidate length against the query's minimum candidate length.
+        case lengthBounds
+        /// Character bitmask against the query's, within the bitmask tolerance.
+        case bitmask
+        /// Lowercasing into the buffer (and the bonus pass in Smith-Waterman mode).
+        case lowercase
+        /// Trigram overlap with the query (edit distance mode only).
+        case trigram
+        /// Case-insensitive equality; a candidate that does not pass was an exact match.
+        case exactMatch
+        /// Score upper bound against the caller's floor, when there is one.
+        case scoreBound
+        /// Prefix, substring, subsequence and acronym phases; passed means matched.
+        case editDistance
+        /// Smith-Waterman DP and acronym fallback; passed means matched.
+        case smithWaterman
+        /// DP-optimal alignment inside the edit distance phases; passed means
+        /// match positions were found.
+        case alignment
+
+        public var description: String {
+            switch self {
+            case .lengthBounds: "length bounds"
+            case .bitmask: "bitmask"
+            case .lowercase: "lowercase"
+            case .trigram: "trigram"
+            case .exactMatch: "exact match"
+            case .scoreBound: "score bound"
+            case .editDistance: "edit distance"
+            case .smithWaterman: "smith-waterman"
+            case .alignment: "alignment"
+            }
+        }
+    }
+
+    /// Counters for one ``Stage``.
+    public struct StageCounts: Sendable, Equatable {
+        /// Candidates that reached the stage.
+        public var entered: Int = 0
+
+        /// Candidates that went on past the stage.
+        public var passed: Int = 0
+
+        /// Timed candidates that reached the stage.
+        public var timedCount: Int = 0
+
+        /// Wall-clock nanoseconds spent in the stage by timed candidates.
+        public var timedNanoseconds: UInt64 = 0
+
+        public init() {}
+
+        /// Candidates the stage stopped.
+        public var rejected: Int { entered - passed }
+
+        /// Fraction of entering candidates that passed, or `nil` if none entered.
+        public var passRate: Double? {
+            entered > 0 ? Double(passed) / Double(entered) : nil
+        }
+
+        /// Mean nanoseconds per timed candidate, or `nil` if none was timed.
+        public var meanNanoseconds: Double? {
+            timedCount > 0 ? Double(timedNanoseconds) / Double(timedCount) : nil
+        }
+    }
+
+    /// Whether the package was built with the `ScoringStatistics` trait.
+    public static var isEnabled: Bool {
+        #if ScoringStatistics
+        return true
+        #else
+        return false
+        #endif
+    }
+
+    /// Candidates scored.
+    public var candidates: Int = 0
+
+    /// Candidates that produced a match.
+    public var matches: Int = 0
+
+    /// Time every n-th candidate; `0` (the default) only counts.
+    public var timingSampleInterval: Int = 0 {
+        didSet { sampleCountdown = timingSampleInterval }
+    }
+
+    /// One entry per ``Stage``, indexed by its raw value; empty when collection is
+    /// compiled out.
+    @usableFromInline var stageCounts: [StageCounts]
+
+    @usableFromInline var sampleCountdown: Int = 0
+    @usableFromInline var isTiming = false
+    @usableFromInline var timedStage: Int = -1
+    @usableFromInline var timedStageStart = ContinuousClock.Instant.now
+    @usableFromInline var alignmentStart = ContinuousClock.Instant.now
+    @usableFromInline var nestedNanoseconds: UInt64 = 0
+
+    /// Creates an empty collector.
+    public init() {
+        stageCounts = Self.isEnabled ? [StageCounts](repeating: StageCounts(), count: Stage.allCases.count) : []
+    }
+
+    /// The counters of `stage`.
+    public subscript(stage: Stage) -> StageCounts {
+        stageCounts.isEmpty ? StageCounts() : stageCounts[stage.rawValue]
+    }
+
+    /// Zeroes every counter, keeping ``timingSampleInterval``.
+    public mutating func reset() {
+        let interval = timingSampleInterval
+        self = ScoringStatistics()
+        timingSampleInterval = interval
+    }
+
+    /// Compares the counters and ``timingSampleInterval``, not in-flight timing state.
+    public static func == (lhs: ScoringStatistics, rhs: ScoringStatistics) -> Bool {
+        lhs.candidates == rhs.candidates
+            && lhs.matches == rhs.matches
+            && lhs.timingSampleInterval == rhs.timingSampleInterval
+            && lhs.stageCounts == rhs.stageCounts
+    }
+
+    /// Adds the counters of `other`, e.g. from another task's buffer.
+    public mutating func merge(_ other: ScoringStatistics) {
+        candidates += other.candidates
+        matches += other.matches
+        for index in stageCounts.indices where index < other.stageCounts.count {
+            stageCounts[index].entered += other.stageCounts[index].entered
+            stageCounts[index].passed += other.stageCounts[index].passed
+            stageCounts[index].timedCount += other.stageCounts[index].timedCount
+            stageCounts[index].timedNanoseconds += other.stageCounts[index].timedNanoseconds
+        }
+    }
+
+    // MARK: - Recording
+
+    /// Starts a candidate; decides whether it is timed.
+    @inlinable
+    mutating func beginCandidate() {
+        #if ScoringStatistics
+        candidates &+= 1
+        if timingSampleInterval > 0 {
+            sampleCountdown &-= 1
+            if sampleCountdown <= 0 {
+                sampleCountdown = timingSampleInterval
+                isTiming = true
+            }
+        }
+        #endif
+    }
+
+    /// Finishes a candidate, closing the timing of the stage it ended in.
+    @inlinable
+    mutating func endCandidate(matched: Bool) {
+        #if ScoringStatistics
+        if matched {
+            matches &+= 1
+        }
+        if isTiming {
+            closeTimedStage(at: .now)
+            isTiming = false
+        }
+        #endif
+    }
+
+    /// Records that the current candidate reached `stage`.
+    @inlinable
+    mutating func enter(_ stage: Stage) {
+        #if ScoringStatistics
+        stageCounts[stage.rawValue].entered &+= 1
+        if isTiming {
+            let now = ContinuousClock.Instant.now
+            closeTimedStage(at: now)
+            timedStage = stage.rawValue
+            timedStageStart = now
+            stageCounts[stage.rawValue].timedCount &+= 1
+        }
+        #endif
+    }
+
+    /// Records that the current candidate went on past `stage`.
+    @inlinable
+    mutating func pass(_ stage: Stage) {
+        #if ScoringStatistics
+        stageCounts[stage.rawValue].passed &+= 1
+        #endif
+    }
+
+    /// Counts a stage without timing it, for paths that process several candidates at once.
+    @inlinable
+    mutating func count(_ stage: Stage, passed: Bool) {
+        #if ScoringStatistics
+        stageCounts[stage.rawValue].entered &+= 1
+        if passed {
+            stageCounts[stage.rawValue].passed &+= 1
+        }
+        #endif
+    }
+
+    /// Counts a candidate without any stages, for paths that process several candidates at once.
+    @inlinable
+    mutating func countCandidate(matched: Bool) {
+        #if ScoringStatistics
+        candidates &+= 1
+        if matched {
+            matches &+= 1
+        }
+        #endif
+    }
+
+    /// Starts an alignment nested inside the current stage.
+    @inlinable
+    mutating func beginAlignment() {
+        #if ScoringStatistics
+        stageCounts[Stage.alignment.rawValue].entered &+= 1
+        if isTiming {
+            alignmentStart = .now
+            stageCounts[Stage.alignment.rawValue].timedCount &+= 1
+        }
+        #endif
+    }
+
+    /// Ends the alignment started by ``beginAlignment()``.
+    @inlinable
+    mutating func endAlignment(found: Bool) {
+        #if ScoringStatistics
+        if found {
+            stageCounts[Stage.alignment.rawValue].passed &+= 1
+        }
+        if isTiming {
+            let elapsed = Self.nanoseconds(from: alignmentStart, to: .now)
+            stageCounts[Stage.alignment.rawValue].timedNanoseconds &+= elapsed
+            nestedNanoseconds &+= elapsed
+        }
+        #endif
+    }
+
+    /// Adds the time since the timed stage began, less nested alignment time, to that stage.
+    @inlinable
+    mutating func closeTimedStage(at now: ContinuousClock.Instant) {
+        guard timedStage >= 0 else { return }
+        let elapsed = Self.nanoseconds(from: timedStageStart, to: now)
+        stageCounts[timedStage].timedNanoseconds &+= elapsed > nestedNanoseconds ? elapsed - nestedNanoseconds : 0
+        timedStage = -1
+        nestedNanoseconds = 0
+    }
+
+    @inlinable
+    static func nanoseconds(from start: ContinuousClock.Instant, to end: ContinuousClock.Instant) -> UInt64 {
+        let (seconds, attoseconds) = (end - start).components
+        guard seconds >= 0 else { return 0 }
+        return UInt64(seconds) &* 1_000_000_000 &+ UInt64(attoseconds / 1_000_000_000)
+    }
+}
@@ -0,0 +1,181 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+/// An immutable view of a ``LiveCorpus`` at one point in time.
+///
+/// ## Overview
+///
+/// A live corpus keeps its candidates in two segments: a large *base* corpus that
+/// was built once, and a small *delta* corpus holding the candidates appended since.
+/// Removing a base candidate only records its row as deleted; removing a delta
+/// candidate rebuilds the delta without it. A view captures both segments and the
+/// deleted rows, so a search over a view sees exactly the candidates that were live
+/// when it was taken, no matter what is appended, removed or compacted meanwhile.
+///
+/// Every candidate has the stable integer id ``LiveCorpus/append(_:)`` returned for
+/// it. Ids are assigned in increasing order, base ids are all smaller than delta
+/// ids, and searches break score ties by id, so a view returns the same results as
+/// a ``FuzzyCorpus`` built from its live candidates in id order.
+///
+/// ## Thread Safety
+///
+/// `SegmentedCorpus` is immutable and `Sendable`. Taking a view is cheap: it shares
+/// the storage of both segments.
+public struct SegmentedCorpus: Sendable {
+    /// The segment built by the last compaction (or the initial candidates).
+    @usableFromInline let base: FuzzyCorpus
+
+    /// The id of every base row, ascending.
+    @usableFromInline let baseIDs: [Int]
+
+    /// Deleted base rows, ascending.
+    @usableFromInline let deletedBaseRows: [UInt32]
+
+    /// The candidates appended since the base was built.
+    @usableFromInline let delta: FuzzyCorpus
+
+    /// The id of every delta row, ascending and greater than every base id.
+    @usableFromInline let deltaIDs: [Int]
+
+    /// Identifies this view; every write to a ``LiveCorpus`` publishes a view with a
+    /// new generation, so a ``FuzzyResultCache`` never returns results for an older one.
+    public let generation: UInt64
+
+    init(base: FuzzyCorpus, baseIDs: [Int], deletedBaseRows: [UInt32], delta: FuzzyCorpus, deltaIDs: [Int]) {
+        self.base = base
+        self.baseIDs = baseIDs
+        self.deletedBaseRows = deletedBaseRows
+        self.delta = delta
+        self.deltaIDs = deltaIDs
+        self.generation = FuzzyCorpus.nextGeneration()
+    }
+
+    /// The number of live candidates.
+    public var count: Int { base.count - deletedBaseRows.count + delta.count }
+
+    /// Whether the view has no live candidates.
+    public var isEmpty: Bool { count == 0 }
+
+    /// The number of candidates appended since the last compaction.
+    public var deltaCount: Int { delta.count }
+
+    /// The number of removed candidates still held by the base segment.
+    public var deletedCount: Int { deletedBaseRows.count }
+
+    /// The ids of the live candidates, ascending.
+    public var ids: [Int] {
+        var ids: [Int] = []
+        ids.reserveCapacity(count)
+        forEachLiveBaseRow { ids.append(baseIDs[$0]) }
+        ids.append(contentsOf: deltaIDs)
+        return ids
+    }
+
+    /// The live candidates in id order.
+    public var candidates: [String] {
+        var candidates: [String] = []
+        candidates.reserveCapacity(count)
+        forEachLiveBaseRow { candidates.append(base[$0]) }
+        candidates.append(contentsOf: delta)
+        return candidates
+    }
+
+    /// Whether the candidate with `id` is live in this view.
+    public func contains(id: Int) -> Bool {
+        location(of: id) != nil
+    }
+
+    /// The candidate with `id`, or `nil` if it was removed or never appended.
+    public subscript(id id: Int) -> String? {
+        switch location(of: id) {
+        case .base(let row): base[row]
+        case .delta(let row): delta[row]
+        case nil: nil
+        }
+    }
+
+    // MARK: - Rows
+
+    enum Location: Equatable {
+        case base(Int)
+        case delta(Int)
+    }
+
+    /// The segment and row of the live candidate with `id`.
+    func location(of id: Int) -> Location? {
+        if let row = Self.row(of: id, in: deltaIDs) {
+            return .delta(row)
+        }
+        if let row = Self.row(of: id, in: baseIDs), !isDeletedBaseRow(row) {
+            return .base(row)
+        }
+        return nil
+    }
+
+    func isDeletedBaseRow(_ row: Int) -> Bool {
+        Self.insertionPoint(of: UInt32(row), in: deletedBaseRows).found
+    }
+
+    /// Calls `body` with every live base row, ascending.
+    func forEachLiveBaseRow(_ body: (Int) -> Void) {
+        var deleted = deletedBaseRows.makeIterator()
+        var nextDeleted = deleted.next()
+        for row in baseIDs.indices {
+            if let skip = nextDeleted, Int(skip) == row {
+                nextDeleted = deleted.next()
+                continue
+            }
+            body(row)
+        }
+    }
+
+    /// Drops deleted rows from ascending base `survivors` in one merge pass.
+    @inlinable
+    func removeDeletedBaseRows(from survivors: inout [UInt32]) {
+        guard !deletedBaseRows.isEmpty else { return }
+        var deleted = 0
+        var kept = 0
+        for position in survivors.indices {
+            let survivor = survivors[position]
+            while deleted < deletedBaseRows.count && deletedBaseRows[deleted] < survivor {
+                deleted += 1
+            }
+            if deleted < deletedBaseRows.count && deletedBaseRows[deleted] == survivor {
+                continue
+            }
+            survivors[kept] = survivor
+            kept += 1
+        }
+        survivors.removeLast(survivors.count - kept)
+    }
+
+    static func row(of id: Int, in ids: [Int]) -> Int? {
+        let (index, found) = insertionPoint(of: id, in: ids)
+        return found ? index : nil
+    }
+
+    /// Binary search in an ascending array.
+    static func insertionPoint<Value: Comparable>(of value: Value, in values: [Value]) -> (index: Int, found: Bool) {
+        var low = 0
+        var high = values.count
+        while low < high {
+            let mid = (low + high) / 2
+            if values[mid] < value {
+                low = mid + 1
+            } else {
+                high = mid
+            }
+        }
+        return (low, low < values.count && values[low] == value)
+    }
+}
@@ -22,6 +22,8 @@
 /// carried as scalar variables, eliminating the need for row swaps or extra buffer rows.
 /// All arithmetic is Int32-only in the inner loop; normalization to 0.0–1.0 happens afterward.
 /// A zero-floor convention is used: 0 means "no valid state" and all valid scores are > 0.
+/// Queries of ``smithWatermanSIMDMinQueryLength`` bytes or more use a vectorized kernel
+/// that computes eight query columns per step with the same arithmetic.
 ///
 /// ## Consecutive Bonus Propagation
 ///
@@ -36,8 +38,18 @@
 ///   'r' consecutive:  effective = max(carried=8, posBonus=0) = 8
 /// ```
 
+/// Shortest query routed to ``smithWatermanScoreSIMD(query:candidate:bonus:state:config:)``.
+///
+/// Below this, most of each 8-lane chunk is padding and the scalar loop is cheaper.
+@usableFromInline
+let smithWatermanSIMDMinQueryLength = 4
+
 /// Computes the Smith-Waterman local alignment score for a query against a candidate.
 ///
+/// Dispatches to the vectorized kernel for queries of
+/// ``smithWatermanSIMDMinQueryLength`` bytes or more, and to the scalar kernel
+/// otherwise. Both return identical scores.
+///
 /// - Parameters:
 ///   - query: Lowercased query bytes.
 ///   - candidate: Lowercased candidate bytes.
@@ -52,6 +64,29 @@ func smithWatermanScore(
     bonus: Span<Int32>,
     state: inout SmithWatermanState,
     config: SmithWatermanConfig
+) -> Int32 {
+    if query.count >= smithWatermanSIMDMinQueryLength {
+        return smithWatermanScoreSIMD(query: query, candidate: candidate, bonus: bonus, state: &state, config: config)
+    }
+    return smithWatermanScoreScalar(query: query, candidate: candidate, bonus: bonus, state: &state, config: config)
+}
+
+/// Scalar Smith-Waterman kernel: one DP cell per inner-loop iteration.
+///
+/// - Parameters:
+///   - query: Lowercased query bytes.
+///   - candidate: Lowercased candidate bytes.
+///   - bonus: Precomputed per-position bonus values (tiered boundary, camelCase, or 0).
+///   - state: Reusable DP state buffers.
+///   - config: Smith-Waterman scoring constants.
+/// - Returns: The raw Int32 alignment score, or 0 if no alignment found.
+@inlinable
+func smithWatermanScoreScalar(
+    query: Span<UInt8>,
+    candidate: Span<UInt8>,
+    bonus: Span<Int32>,
+    state: inout SmithWatermanState,
+    config: SmithWatermanConfig
 ) -> Int32 {
     let queryLen = query.count
     let candidateLen = candidate.count
@@ -176,6 +211,268 @@ func smithWatermanScore(
     }
 }
 
+/// Vectorized Smith-Waterman kernel: eight query columns per step.
+///
+/// Within one candidate position, every cell depends only on the previous position
+/// (`gap` on `[i-1, j]`, `match` on the diagonal `[i-1, j-1]`), never on a cell to its
+/// left. The row can therefore be computed eight query columns at a time with
+/// `SIMD8<Int32>` lanes, using the same Int32 arithmetic as the scalar kernel, so the
+/// result is identical.
+///
+/// Two row sets (previous and current position) are swapped after each candidate byte.
+/// Each row has a leading zero column so the diagonal for query column `j` is the
+/// unaligned load at `j`, and the previous value is the load at `j + 1`. Padding lanes
+/// carry a query value no byte can equal, so they stay zero. The first query column
+/// (which starts a run without a diagonal predecessor) is patched after the vector pass.
+///
+/// - Parameters:
+///   - query: Lowercased query bytes.
+///   - candidate: Lowercased candidate bytes.
+///   - bonus: Precomputed per-position bonus values (tiered boundary, camelCase, or 0).
+///   - state: Reusable DP state buffers.
+///   - config: Smith-Waterman scoring constants.
+/// - Returns: The raw Int32 alignment score, or 0 if no alignment found.
+@inlinable
+func smithWatermanScoreSIMD(
+    query: Span<UInt8>,
+    candidate: Span<UInt8>,
+    bonus: Span<Int32>,
+    state: inout SmithWatermanState,
+    config: SmithWatermanConfig
+) -> Int32 {
+    typealias Lanes = SIMD8<Int32>
+
+    let queryLen = query.count
+    let candidateLen = candidate.count
+    guard queryLen > 0, candidateLen > 0 else { return 0 }
+
+    let paddedLen = (queryLen + 7) & ~7
+    let rowWidth = paddedLen + 1
+    let queryLanesOff = rowWidth * 6
+    state.ensureSIMDCapacity(queryLanesOff + paddedLen)
+
+    let bonusBoundary = Int32(config.bonusBoundary)
+    let scoreMatch = Int32(config.scoreMatch)
+    let firstCharMultiplier = Int32(config.bonusFirstCharMultiplier)
+    let zero = Lanes(repeating: 0)
+    let bonusConsecutive = Lanes(repeating: Int32(config.bonusConsecutive))
+    let scoreMatchLanes = Lanes(repeating: scoreMatch)
+    let penaltyGapStart = Lanes(repeating: Int32(config.penaltyGapStart))
+    let penaltyGapExtend = Lanes(repeating: Int32(config.penaltyGapExtend))
+    let lastQueryIdx = queryLen - 1
+    let firstQueryChar = query[0]
+
+    return state.simdBuffer.withUnsafeMutableBufferPointer { buf in
+        // Zero both row sets, then widen the query into padded Int32 lanes
+        for k in 0..<queryLanesOff {
+            buf[k] = 0
+        }
+        for j in 0..<paddedLen {
+            buf[queryLanesOff + j] = j < queryLen ? Int32(query[j]) : -1
+        }
+
+        let raw = UnsafeMutableRawPointer(buf.baseAddress!)
+        let laneStride = MemoryLayout<Int32>.stride
+
+        @inline(__always)
+        func load(_ index: Int) -> Lanes {
+            raw.loadUnaligned(fromByteOffset: index &* laneStride, as: Lanes.self)
+        }
+
+        @inline(__always)
+        func store(_ value: Lanes, _ index: Int) {
+            raw.storeBytes(of: value, toByteOffset: index &* laneStride, as: Lanes.self)
+        }
+
+        // Row starts (element offsets) for [match | gap | bonus] × {previous, current}
+        var prevMatch = 0, prevGap = rowWidth, prevBonus = rowWidth * 2
+        var curMatch = rowWidth * 3, curGap = rowWidth * 4, curBonus = rowWidth * 5
+        var bestScore: Int32 = 0
+
+        for i in 0..<candidateLen {
+            let candidateChar = candidate[i]
+            let posBonus = bonus[i]
+            let posBonusLanes = Lanes(repeating: posBonus)
+            let candidateLanes = Lanes(repeating: Int32(candidateChar))
+            let posIsBoundary = posBonus >= bonusBoundary
+
+            var j = 0
+            while j < paddedLen {
+                let oldMatch = load(prevMatch &+ j &+ 1)
+                let oldGap = load(prevGap &+ j &+ 1)
+                let diagMatch = load(prevMatch &+ j)
+                let diagGap = load(prevGap &+ j)
+                let diagBonus = load(prevBonus &+ j)
+
+                // Gap transition (zero floor): max(M[i-1,j] - open, G[i-1,j] - extend, 0)
+                let newGap = pointwiseMax(pointwiseMax(oldMatch &- penaltyGapStart, oldGap &- penaltyGapExtend), zero)
+                store(newGap, curGap &+ j &+ 1)
+
+                // Consecutive match path with nucleo-style bonus carry
+                var carriedBonus = pointwiseMax(diagBonus, bonusConsecutive)
+                if posIsBoundary {
+                    carriedBonus = pointwiseMax(carriedBonus, posBonusLanes)
+                }
+                let effectiveBonus = pointwiseMax(carriedBonus, posBonusLanes)
+                let fromConsecutive = diagMatch &+ scoreMatchLanes &+ effectiveBonus
+                let takeConsecutive = (diagMatch .> zero) .& (fromConsecutive .> zero)
+                var newMatch = zero.replacing(with: fromConsecutive, where: takeConsecutive)
+                var newBonus = zero.replacing(with: carriedBonus, where: takeConsecutive)
+
+                // Gap-to-match path
+                let fromGap = diagGap &+ scoreMatchLanes &+ posBonusLanes
+                let takeGap = (diagGap .> zero) .& (fromGap .> newMatch)
+                newMatch.replace(with: fromGap, where: takeGap)
+                newBonus.replace(with: posBonusLanes, where: takeGap)
+
+                // Only matching columns keep a match state
+                let matches = load(queryLanesOff &+ j) .== candidateLanes
+                store(zero.replacing(with: newMatch, where: matches), curMatch &+ j &+ 1)
+                store(zero.replacing(with: newBonus, where: matches), curBonus &+ j &+ 1)
+
+                j &+= 8
+            }
+
+            // First query column starts a run regardless of the diagonal
+            if candidateChar == firstQueryChar {
+                buf[curMatch + 1] = scoreMatch + posBonus * firstCharMultiplier
+                buf[curBonus + 1] = posBonus
+            }
+
+            // Track best score from the last query column
+            let lastMatch = buf[curMatch + 1 + lastQueryIdx]
+            let lastGap = buf[curGap + 1 + lastQueryIdx]
+            if lastMatch > bestScore { bestScore = lastMatch }
+            if lastGap > bestScore { bestScore = lastGap }
+
+            swap(&prevMatch, &curMatch)
+            swap(&prevGap, &curGap)
+            swap(&prevBonus, &curBonus)
+        }
+
+        return bestScore
+    }
+}
+
+/// Batched Smith-Waterman kernel: one candidate per lane, eight candidates per step.
+///
+/// The inter-candidate counterpart of ``smithWatermanScoreScalar(query:candidate:bonus:state:config:)``:
+/// the loops over candidate positions and query columns are the scalar ones, but every
+/// DP cell is a `SIMD8<Int32>` holding that cell for eight different candidates. The
+/// candidates are pre-transposed, so `characters[i]` and `bonuses[i]` hold byte `i`
+/// and its bonus for each lane. Lanes shorter than the block are padded with a
+/// character no query byte can equal, and their best score is only tracked while
+/// `i < laneLengths[lane]`, so each lane's score is identical to the scalar kernel's.
+///
+/// The block runs for the longest lane, so candidates of similar length should be
+/// batched together.
+///
+/// - Parameters:
+///   - query: Lowercased query bytes.
+///   - characters: Transposed lowercased candidate bytes (`-1` past a lane's end).
+///   - bonuses: Transposed per-position bonus values.
+///   - laneLengths: Lowercased length of each lane's candidate (`0` for unused lanes).
+///   - rows: Reusable DP rows; resized to `3 * query.count` lanes if needed.
+///   - config: Smith-Waterman scoring constants.
+/// - Returns: The raw Int32 alignment score of each lane, or 0 where no alignment was found.
+@inlinable
+func smithWatermanScoreBatch(
+    query: Span<UInt8>,
+    characters: Span<SIMD8<Int32>>,
+    bonuses: Span<SIMD8<Int32>>,
+    laneLengths: SIMD8<Int32>,
+    rows: inout [SIMD8<Int32>],
+    config: SmithWatermanConfig
+) -> SIMD8<Int32> {
+    typealias Lanes = SIMD8<Int32>
+
+    let queryLen = query.count
+    let blockLen = characters.count
+    let zero = Lanes(repeating: 0)
+    guard queryLen > 0, blockLen > 0 else { return zero }
+
+    if rows.count < queryLen * 3 {
+        rows = [Lanes](repeating: zero, count: queryLen * 3)
+    }
+
+    let bonusBoundary = Lanes(repeating: Int32(config.bonusBoundary))
+    let bonusConsecutive = Lanes(repeating: Int32(config.bonusConsecutive))
+    let scoreMatch = Lanes(repeating: Int32(config.scoreMatch))
+    let penaltyGapStart = Lanes(repeating: Int32(config.penaltyGapStart))
+    let penaltyGapExtend = Lanes(repeating: Int32(config.penaltyGapExtend))
+    let firstCharMultiplier = Lanes(repeating: Int32(config.bonusFirstCharMultiplier))
+    let lastQueryIdx = queryLen - 1
+
+    // 3-row layout: [match row | gap row | bonus row], each queryLen wide
+    let matchOff = 0
+    let gapOff = queryLen
+    let bonusOff = queryLen * 2
+
+    return rows.withUnsafeMutableBufferPointer { buf in
+        for k in 0..<(queryLen * 3) {
+            buf[k] = zero
+        }
+
+        var bestScore = zero
+
+        for i in 0..<blockLen {
+            let candidateChars = characters[i]
+            let posBonus = bonuses[i]
+            let posIsBoundary = posBonus .>= bonusBoundary
+
+            var diagMatch = zero
+            var diagGap = zero
+            var diagBonus = zero
+
+            for j in 0..<queryLen {
+                let oldMatch = buf[matchOff + j]
+                let oldGap = buf[gapOff + j]
+                let oldBonus = buf[bonusOff + j]
+
+                // Gap transition (zero floor): max(M[i-1,j] - open, G[i-1,j] - extend, 0)
+                buf[gapOff + j] = pointwiseMax(pointwiseMax(oldMatch &- penaltyGapStart, oldGap &- penaltyGapExtend), zero)
+
+                var newMatch: Lanes
+                var newBonus: Lanes
+                if j == 0 {
+                    newMatch = scoreMatch &+ posBonus &* firstCharMultiplier
+                    newBonus = posBonus
+                } else {
+                    // Consecutive match path with nucleo-style bonus carry
+                    var carriedBonus = pointwiseMax(diagBonus, bonusConsecutive)
+                    carriedBonus.replace(with: pointwiseMax(carriedBonus, posBonus), where: posIsBoundary)
+                    let fromConsecutive = diagMatch &+ scoreMatch &+ pointwiseMax(carriedBonus, posBonus)
+                    let takeConsecutive = (diagMatch .> zero) .& (fromConsecutive .> zero)
+                    newMatch = zero.replacing(with: fromConsecutive, where: takeConsecutive)
+                    newBonus = zero.replacing(with: carriedBonus, where: takeConsecutive)
+
+                    // Gap-to-match path
+                    let fromGap = diagGap &+ scoreMatch &+ posBonus
+                    let takeGap = (diagGap .> zero) .& (fromGap .> newMatch)
+                    newMatch.replace(with: fromGap, where: takeGap)
+                    newBonus.replace(with: posBonus, where: takeGap)
+                }
+
+                // Only lanes whose byte matches this query column keep a match state
+                let matches = candidateChars .== Lanes(repeating: Int32(query[j]))
+                buf[matchOff + j] = zero.replacing(with: newMatch, where: matches)
+                buf[bonusOff + j] = zero.replacing(with: newBonus, where: matches)
+
+                diagMatch = oldMatch
+                diagGap = oldGap
+                diagBonus = oldBonus
+            }
+
+            // Track best score from the last query column, for lanes still in range
+            let inRange = Lanes(repeating: Int32(truncatingIfNeeded: i)) .< laneLengths
+            let lastBest = pointwiseMax(buf[matchOff + lastQueryIdx], buf[gapOff + lastQueryIdx])
+            bestScore.replace(with: pointwiseMax(bestScore, lastBest), where: inRange)
+        }
+
+        return bestScore
+    }
+}
+
 /// Computes the tiered boundary bonus for a multi-byte character position.
 ///
 /// Used by the slow path (Latin Extended, Greek, Cyrillic) where the current
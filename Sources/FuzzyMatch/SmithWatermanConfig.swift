@@ -49,7 +49,7 @@
 ///     bonusFirstCharMultiplier: 3
 /// )
 /// ```
-public struct SmithWatermanConfig: Sendable, Equatable, Codable {
+public struct SmithWatermanConfig: Sendable, Hashable, Codable {
     /// Points awarded for each character in the query that matches a character in the candidate.
     public var scoreMatch: Int
 
@@ -0,0 +1,226 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+/// A bounded collector that keeps the `limit` highest-scoring elements it is offered.
+///
+/// ## Overview
+///
+/// `TopKCollector` is a fixed-capacity binary min-heap keyed on score: the worst
+/// retained element sits at the root, so deciding whether a new element gets in is one
+/// comparison, and replacing the worst element costs O(log K). This is what the
+/// `topMatches` convenience methods use internally, and it is available for custom
+/// scoring loops built on ``FuzzyMatcher/score(_:against:buffer:)``.
+///
+/// ### Tie-Breaking
+///
+/// Every element carries an *ordinal*, by default its insertion order. When two
+/// elements have the same score, the one with the lower ordinal ranks higher. The
+/// retained set and its order are therefore fully determined by the `(score, ordinal)`
+/// pairs offered, independent of the order in which they were inserted or how partial
+/// collectors were merged. Passing the candidate's position in the input as the
+/// ordinal makes concurrent and sequential searches return identical results.
+///
+/// ## Example
+///
+/// ```swift
+/// let matcher = FuzzyMatcher()
+/// let query = matcher.prepare("config")
+/// var buffer = matcher.makeBuffer()
+/// var top = TopKCollector<String>(limit: 100)
+///
+/// for candidate in candidates {
+///     if let match = matcher.score(candidate, against: query, buffer: &buffer) {
+///         top.insert(candidate, score: match.score)
+///     }
+/// }
+/// let best = top.sortedElements()  // highest score first
+/// ```
+public struct TopKCollector<Element> {
+    /// A retained element with its ranking key.
+    @usableFromInline
+    internal struct Entry {
+        @usableFromInline var score: Double
+        @usableFromInline var ordinal: Int
+        @usableFromInline var element: Element
+
+        @inlinable
+        init(score: Double, ordinal: Int, element: Element) {
+            self.score = score
+            self.ordinal = ordinal
+            self.element = element
+        }
+    }
+
+    /// The maximum number of elements retained.
+    public let limit: Int
+
+    /// Min-heap of retained entries; the worst-ranked entry is at index 0.
+    @usableFromInline var heap: [Entry]
+
+    /// Ordinal assigned to the next element inserted without an explicit ordinal.
+    @usableFromInline var nextOrdinal: Int = 0
+
+    /// Creates an empty collector.
+    ///
+    /// - Parameter limit: The maximum number of elements to retain. Values below `0`
+    ///   are treated as `0`.
+    @inlinable
+    public init(limit: Int) {
+        self.limit = max(0, limit)
+        self.heap = []
+        self.heap.reserveCapacity(min(self.limit, 1_024))
+    }
+
+    /// The number of elements currently retained.
+    @inlinable
+    public var count: Int { heap.count }
+
+    /// Whether no element has been retained.
+    @inlinable
+    public var isEmpty: Bool { heap.isEmpty }
+
+    /// Whether the collector holds `limit` elements, so new elements must beat
+    /// ``minimumScore`` to get in.
+    @inlinable
+    public var isFull: Bool { heap.count >= limit }
+
+    /// The lowest retained score once the collector is full, or `nil` before that.
+    ///
+    /// While the collector is full, an element scoring below this value can never be
+    /// retained, which makes it a useful threshold for skipping work early.
+    @inlinable
+    public var minimumScore: Double? {
+        isFull && !heap.isEmpty ? heap[0].score : nil
+    }
+
+    /// Returns whether an element with the given score and ordinal would be retained.
+    ///
+    /// Use this to avoid building an element (for example decoding a string) that
+    /// would be discarded immediately.
+    @inlinable
+    public func wouldAccept(score: Double, ordinal: Int) -> Bool {
+        if !isFull { return limit > 0 }
+        let worst = heap[0]
+        return Self.ranksBelow(worst.score, worst.ordinal, score, ordinal)
+    }
+
+    /// Offers an element, using the insertion order as its tie-breaking ordinal.
+    ///
+    /// - Returns: `true` if the element was retained.
+    @inlinable @discardableResult
+    public mutating func insert(_ element: Element, score: Double) -> Bool {
+        let ordinal = nextOrdinal
+        nextOrdinal &+= 1
+        return insert(element, score: score, ordinal: ordinal)
+    }
+
+    /// Offers an element with an explicit tie-breaking ordinal.
+    ///
+    /// Among equal scores, lower ordinals rank higher. Ordinals should be unique
+    /// within one search (for example the candidate index).
+    ///
+    /// - Returns: `true` if the element was retained.
+    @inlinable @discardableResult
+    public mutating func insert(_ element: Element, score: Double, ordinal: Int) -> Bool {
+        if heap.count < limit {
+            heap.append(Entry(score: score, ordinal: ordinal, element: element))
+            siftUp(from: heap.count - 1)
+            return true
+        }
+        guard limit > 0 else { return false }
+        let worst = heap[0]
+        guard Self.ranksBelow(worst.score, worst.ordinal, score, ordinal) else { return false }
+        heap[0] = Entry(score: score, ordinal: ordinal, element: element)
+        siftDown(from: 0)
+        return true
+    }
+
+    /// Offers every element retained by another collector, keeping their ordinals.
+    ///
+    /// Merging per-worker collectors built with globally unique ordinals yields the same
+    /// retained set as a single collector fed sequentially.
+    @inlinable
+    public mutating func merge(_ other: TopKCollector<Element>) {
+        for entry in other.heap {
+            insert(entry.element, score: entry.score, ordinal: entry.ordinal)
+        }
+        nextOrdinal = max(nextOrdinal, other.nextOrdinal)
+    }
+
+    /// Returns the retained elements, highest score first (lower ordinal first on ties).
+    @inlinable
+    public func sortedElements() -> [Element] {
+        sortedEntries().map { $0.element }
+    }
+
+    /// Returns the retained elements with their scores and ordinals, highest score first.
+    @inlinable
+    public func sortedScoredElements() -> [(element: Element, score: Double, ordinal: Int)] {
+        sortedEntries().map { (element: $0.element, score: $0.score, ordinal: $0.ordinal) }
+    }
+
+    // MARK: - Heap Internals
+
+    /// Whether `(lhsScore, lhsOrdinal)` ranks strictly below `(rhsScore, rhsOrdinal)`.
+    @inlinable
+    internal static func ranksBelow(
+        _ lhsScore: Double,
+        _ lhsOrdinal: Int,
+        _ rhsScore: Double,
+        _ rhsOrdinal: Int
+    ) -> Bool {
+        lhsScore < rhsScore || (lhsScore == rhsScore && lhsOrdinal > rhsOrdinal)
+    }
+
+    @inlinable
+    internal func sortedEntries() -> [Entry] {
+        heap.sorted { Self.ranksBelow($1.score, $1.ordinal, $0.score, $0.ordinal) }
+    }
+
+    @inlinable
+    internal mutating func siftUp(from index: Int) {
+        var child = index
+        while child > 0 {
+            let parent = (child - 1) / 2
+            guard Self.ranksBelow(heap[child].score, heap[child].ordinal, heap[parent].score, heap[parent].ordinal) else {
+                return
+            }
+            heap.swapAt(child, parent)
+            child = parent
+        }
+    }
+
+    @inlinable
+    internal mutating func siftDown(from index: Int) {
+        let count = heap.count
+        var parent = index
+        while true {
+            let left = 2 * parent + 1
+            guard left < count else { return }
+            var lowest = left
+            let right = left + 1
+            if right < count
+                && Self.ranksBelow(heap[right].score, heap[right].ordinal, heap[left].score, heap[left].ordinal) {
+                lowest = right
+            }
+            guard Self.ranksBelow(heap[lowest].score, heap[lowest].ordinal, heap[parent].score, heap[parent].ordinal) else {
+                return
+            }
+            heap.swapAt(parent, lowest)
+            parent = lowest
+        }
+    }
+}
+
+extension TopKCollector.Entry: Sendable where Element: Sendable {}
+extension TopKCollector: Sendable where Element: Sendable {}
@@ -0,0 +1,194 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+/// Inverted index from trigram hashes to the corpus candidates containing them.
+///
+/// Built over the lowercased corpus arena with the same trigram extraction as
+/// ``countSharedTrigrams(candidateBytes:queryTrigrams:)`` (space-containing trigrams
+/// are skipped). Each posting stores the candidate index together with the number of
+/// times the trigram occurs in that candidate, so summing postings over the query
+/// trigrams reproduces `countSharedTrigrams` exactly.
+///
+/// ## Layout
+///
+/// Postings are stored in compressed-sparse-row form: ``slots`` maps a trigram hash to
+/// its slot, and slot `s` owns `postingIDs[postingOffsets[s]..<postingOffsets[s + 1]]`
+/// (ascending candidate index) with matching ``postingCounts``.
+///
+/// Candidates long enough that a per-candidate count could overflow `UInt16` are not
+/// indexed; they are listed in ``unindexed`` and always offered to the scorer.
+@usableFromInline
+internal struct TrigramIndex: Sendable {
+    /// Slot of each trigram hash present in the corpus.
+    @usableFromInline let slots: [UInt32: Int]
+
+    /// Start offset of each slot in ``postingIDs``, plus a trailing end offset.
+    @usableFromInline let postingOffsets: [Int]
+
+    /// Candidate indices, grouped by slot, ascending within a slot.
+    @usableFromInline let postingIDs: [UInt32]
+
+    /// Occurrences of the slot's trigram in the corresponding candidate.
+    @usableFromInline let postingCounts: [UInt16]
+
+    /// Candidates excluded from the postings, ascending.
+    @usableFromInline let unindexed: [UInt32]
+
+    /// Number of candidates the index was built over.
+    @usableFromInline let candidateCount: Int
+
+    /// Longest candidate whose trigram positions all fit a `UInt16` counter.
+    @usableFromInline static let maxIndexedLength = Int(UInt16.max) + 2
+
+    /// Builds the index from a lowercased arena.
+    ///
+    /// - Parameters:
+    ///   - lowercased: Concatenated lowercased candidate bytes.
+    ///   - offsets: Start offset of each candidate in `lowercased`, plus a trailing end offset.
+    init(lowercased: [UInt8], offsets: [Int]) {
+        let candidateCount = offsets.count - 1
+        var slots: [UInt32: Int] = [:]
+        var slotSizes: [Int] = []
+        var unindexed: [UInt32] = []
+        var scratch: [UInt32] = []
+
+        // Pass 1: assign slots and size the posting lists
+        for candidate in 0..<candidateCount {
+            let start = offsets[candidate], end = offsets[candidate + 1]
+            if end - start > Self.maxIndexedLength {
+                unindexed.append(UInt32(truncatingIfNeeded: candidate))
+                continue
+            }
+            Self.collectSortedTrigrams(lowercased, start: start, end: end, into: &scratch)
+            var i = 0
+            while i < scratch.count {
+                let hash = scratch[i]
+                while i < scratch.count && scratch[i] == hash { i += 1 }
+                if let slot = slots[hash] {
+                    slotSizes[slot] += 1
+                } else {
+                    slots[hash] = slotSizes.count
+                    slotSizes.append(1)
+                }
+            }
+        }
+
+        var postingOffsets = [Int](repeating: 0, count: slotSizes.count + 1)
+        for slot in 0..<slotSizes.count {
+            postingOffsets[slot + 1] = postingOffsets[slot] + slotSizes[slot]
+        }
+        let postingTotal = postingOffsets[slotSizes.count]
+        var postingIDs = [UInt32](repeating: 0, count: postingTotal)
+        var postingCounts = [UInt16](repeating: 0, count: postingTotal)
+
+        // Pass 2: fill postings in ascending candidate order
+        var cursors = Array(postingOffsets.dropLast())
+        for candidate in 0..<candidateCount {
+            let start = offsets[candidate], end = offsets[candidate + 1]
+            if end - start > Self.maxIndexedLength { continue }
+            Self.collectSortedTrigrams(lowercased, start: start, end: end, into: &scratch)
+            var i = 0
+            while i < scratch.count {
+                let hash = scratch[i]
+                let runStart = i
+                while i < scratch.count && scratch[i] == hash { i += 1 }
+                let slot = slots[hash]!
+                let position = cursors[slot]
+                postingIDs[position] = UInt32(truncatingIfNeeded: candidate)
+                postingCounts[position] = UInt16(truncatingIfNeeded: i - runStart)
+                cursors[slot] = position + 1
+            }
+        }
+
+        self.slots = slots
+        self.postingOffsets = postingOffsets
+        self.postingIDs = postingIDs
+        self.postingCounts = postingCounts
+        self.unindexed = unindexed
+        self.candidateCount = candidateCount
+    }
+
+    /// Creates an index from already-built tables (used by the snapshot loader).
+    init(
+        slots: [UInt32: Int],
+        postingOffsets: [Int],
+        postingIDs: [UInt32],
+        postingCounts: [UInt16],
+        unindexed: [UInt32],
+        candidateCount: Int
+    ) {
+        self.slots = slots
+        self.postingOffsets = postingOffsets
+        self.postingIDs = postingIDs
+        self.postingCounts = postingCounts
+        self.unindexed = unindexed
+        self.candidateCount = candidateCount
+    }
+
+    /// Collects the sorted trigram hashes (with repeats) of `bytes[start..<end]`.
+    private static func collectSortedTrigrams(
+        _ bytes: [UInt8],
+        start: Int,
+        end: Int,
+        into trigrams: inout [UInt32]
+    ) {
+        trigrams.removeAll(keepingCapacity: true)
+        guard end - start >= 3 else { return }
+        for i in start..<(end - 2) {
+            let a = bytes[i], b = bytes[i + 1], c = bytes[i + 2]
+            // Skip space-containing trigrams (see computeTrigrams for rationale)
+            if a == 0x20 || b == 0x20 || c == 0x20 { continue }
+            trigrams.append(trigramHash(a, b, c))
+        }
+        trigrams.sort()
+    }
+
+    /// Collects, in ascending order, every candidate sharing at least `minShared`
+    /// trigrams with `queryTrigrams`, plus all unindexed candidates.
+    ///
+    /// Shared counts are accumulated in a dense counter over the corpus, touching only
+    /// candidates that appear in at least one posting list.
+    ///
+    /// - Parameters:
+    ///   - queryTrigrams: The query trigram set from ``computeTrigrams(_:)``.
+    ///   - minShared: Minimum shared-trigram count; must be at least `1`.
+    ///   - survivors: Receives the candidate indices; cleared first.
+    @inlinable
+    func collectCandidates(
+        sharingAtLeast minShared: Int,
+        of queryTrigrams: Set<UInt32>,
+        into survivors: inout [UInt32]
+    ) {
+        survivors.removeAll(keepingCapacity: true)
+        var counters = [UInt16](repeating: 0, count: candidateCount)
+        var touched: [UInt32] = []
+
+        for hash in queryTrigrams {
+            guard let slot = slots[hash] else { continue }
+            for position in postingOffsets[slot]..<postingOffsets[slot + 1] {
+                let candidate = Int(postingIDs[position])
+                if counters[candidate] == 0 {
+                    touched.append(postingIDs[position])
+                }
+                counters[candidate] &+= postingCounts[position]
+            }
+        }
+
+        let threshold = UInt16(clamping: max(1, minShared))
+        for candidate in touched where counters[Int(candidate)] >= threshold {
+            survivors.append(candidate)
+        }
+        survivors.append(contentsOf: unindexed)
+        survivors.sort()
+    }
+}
@@ -90,6 +90,93 @@ internal func computeTrigrams(_ bytes: [UInt8]) -> Set<UInt32> {
     return trigrams
 }
 
+/// A fixed-size open-addressed hash table of query trigrams.
+///
+/// `Set<UInt32>.contains` goes through generic hashing on every probe, which is the
+/// innermost operation of the trigram prefilter. The query's trigram set is small and
+/// immutable once prepared, so it is copied into a flat power-of-two table with at
+/// most 50% load, hashed with a Fibonacci multiply and probed linearly.
+///
+/// Trigram hashes only use the low 24 bits (see ``trigramHash(_:_:_:)``), so
+/// `UInt32.max` is free to mark empty slots.
+///
+/// ## Complexity
+///
+/// - Build: O(n) for n trigrams
+/// - Lookup: O(1) expected, one multiply and usually a single load
+@usableFromInline
+internal struct TrigramTable: Sendable {
+    /// Marker for an unoccupied slot.
+    @usableFromInline static let emptySlot: UInt32 = .max
+
+    /// Slot array; length is a power of two.
+    @usableFromInline let slots: [UInt32]
+
+    /// `slots.count - 1`, for wrapping the probe index.
+    @usableFromInline let indexMask: Int
+
+    /// Right shift that maps a 32-bit product to a slot index.
+    @usableFromInline let shift: UInt32
+
+    /// Number of trigrams stored.
+    @usableFromInline let count: Int
+
+    /// Builds a table holding `trigrams`.
+    @usableFromInline
+    init(_ trigrams: Set<UInt32>) {
+        var capacityLog2: UInt32 = 3
+        while (1 << capacityLog2) < 2 * trigrams.count {
+            capacityLog2 += 1
+        }
+        let capacity = 1 << capacityLog2
+        var slots = [UInt32](repeating: Self.emptySlot, count: capacity)
+        let indexMask = capacity - 1
+        let shift = 32 - capacityLog2
+
+        for hash in trigrams {
+            var index = Self.homeSlot(hash, shift: shift)
+            while slots[index] != Self.emptySlot {
+                index = (index &+ 1) & indexMask
+            }
+            slots[index] = hash
+        }
+
+        self.slots = slots
+        self.indexMask = indexMask
+        self.shift = shift
+        self.count = trigrams.count
+    }
+
+    /// Whether the table holds no trigrams.
+    @inlinable
+    var isEmpty: Bool { count == 0 }
+
+    /// The first slot probed for `hash`.
+    @inlinable
+    static func homeSlot(_ hash: UInt32, shift: UInt32) -> Int {
+        Int(truncatingIfNeeded: (hash &* 0x9E37_79B1) &>> shift)
+    }
+
+    /// Returns whether `hash` is in the table, probing `slots` (a span of ``slots``
+    /// hoisted out of the caller's loop).
+    @inlinable
+    func contains(_ hash: UInt32, slots: Span<UInt32>) -> Bool {
+        var index = Self.homeSlot(hash, shift: shift)
+        while true {
+            let key = slots[index]
+            if key == hash { return true }
+            if key == Self.emptySlot { return false }
+            index = (index &+ 1) & indexMask
+        }
+    }
+
+    /// Returns whether `hash` is in the table.
+    @inlinable
+    func contains(_ hash: UInt32) -> Bool {
+        contains(hash, slots: slots.span)
+    }
+}
+
 /// Counts the number of trigrams in the candidate that match the query trigrams.
 ///
 /// Computes candidate trigrams on the fly without allocating a set, checking
@@ -129,6 +216,35 @@ internal func countSharedTrigrams(
     return sharedCount
 }
 
+/// Counts the number of trigrams in the candidate that match the query trigram table.
+///
+/// Same result as ``countSharedTrigrams(candidateBytes:queryTrigrams:)`` with the
+/// `Set` the table was built from, without generic hashing in the loop.
+///
+/// - Parameters:
+///   - candidateBytes: The candidate bytes (lowercased UTF-8).
+///   - queryTrigrams: The query trigram table from ``FuzzyQuery``.
+/// - Returns: The count of shared trigrams.
+@inlinable
+internal func countSharedTrigrams(
+    candidateBytes: Span<UInt8>,
+    queryTrigrams: TrigramTable
+) -> Int {
+    guard candidateBytes.count >= 3 else { return 0 }
+
+    let slots = queryTrigrams.slots.span
+    var sharedCount = 0
+    for i in 0..<(candidateBytes.count - 2) {
+        let a = candidateBytes[i], b = candidateBytes[i + 1], c = candidateBytes[i + 2]
+        // Skip space-containing trigrams (see computeTrigrams for rationale)
+        if a == 0x20 || b == 0x20 || c == 0x20 { continue }
+        if queryTrigrams.contains(trigramHash(a, b, c), slots: slots) {
+            sharedCount &+= 1
+        }
+    }
+    return sharedCount
+}
+
 /// Checks if a candidate passes the trigram prefilter.
 ///
 /// For two strings to be within edit distance `d`, they must share at least
@@ -175,3 +291,21 @@ internal func passesTrigramFilter(
     // false rejections on Damerau-Levenshtein transposition typos.
     return sharedCount >= queryTrigrams.count - 3 * maxEditDistance
 }
+
+/// Checks if a candidate passes the trigram prefilter, probing a ``TrigramTable``.
+///
+/// Same logic as ``passesTrigramFilter(candidateBytes:queryTrigrams:maxEditDistance:)``.
+@inlinable
+internal func passesTrigramFilter(
+    candidateBytes: Span<UInt8>,
+    queryTrigrams: TrigramTable,
+    maxEditDistance: Int
+) -> Bool {
+    guard !queryTrigrams.isEmpty else { return true }
+
+    let sharedCount = countSharedTrigrams(
+        candidateBytes: candidateBytes,
+        queryTrigrams: queryTrigrams
+    )
+    return sharedCount >= queryTrigrams.count - 3 * maxEditDistance
+}
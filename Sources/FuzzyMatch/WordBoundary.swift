@@ -292,3 +292,44 @@ internal func computeBoundaryMaskCompressed(
     }
     return mask
 }
+
+/// Collects the word-initial bytes of a lowercased candidate, in candidate order.
+///
+/// Boundaries in the first 64 bytes come from `boundaryMask` (as computed by
+/// ``computeBoundaryMaskCompressed(originalBytes:isASCII:)``); later ones are detected
+/// on the lowercased bytes with ``isWordBoundary(at:in:)``, so camelCase boundaries
+/// past byte 64 are not seen. The initials are written to the front of `initials`,
+/// which grows if needed.
+///
+/// - Parameters:
+///   - candidateSpan: The lowercased candidate bytes.
+///   - boundaryMask: Word-boundary mask of the candidate at lowercased byte positions.
+///   - initials: Receives the initials at `initials[0..<count]`.
+/// - Returns: The number of initials, which equals the candidate's word count.
+@inlinable
+internal func collectWordInitials(
+    _ candidateSpan: Span<UInt8>,
+    boundaryMask: UInt64,
+    into initials: inout [UInt8]
+) -> Int {
+    let candidateLength = candidateSpan.count
+    var initialCount = 0
+    let limit = min(candidateLength, 64)
+    for i in 0..<limit where (boundaryMask & (1 << i)) != 0 {
+        if initialCount >= initials.count {
+            initials.append(contentsOf: repeatElement(UInt8(0), count: max(1, initials.count)))
+        }
+        initials[initialCount] = candidateSpan[i]
+        initialCount += 1
+    }
+    if candidateLength > 64 {
+        for i in 64..<candidateLength where isWordBoundary(at: i, in: candidateSpan) {
+            if initialCount >= initials.count {
+                initials.append(contentsOf: repeatElement(UInt8(0), count: max(1, initials.count)))
+            }
+            initials[initialCount] = candidateSpan[i]
+            initialCount += 1
+        }
+    }
+    return initialCount
+}
@@ -0,0 +1,111 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+@testable import FuzzyMatch
+import Testing
+
+// MARK: - Fixtures
+
+private let batchCandidates: [String] = [
+    "getUserById", "get_user_name", "UserManager", "XMLHttpRequest", "setUser", "fetchData",
+    "International Business Machines", "Goldman Sachs Group", "Bank of America", "",
+    "Café Müller", "Crème Brûlée", "Ελληνικά", "Москва", "user", "USER", "u", "a b c d",
+    "src/FuzzyMatch/FuzzyMatcher.swift", "the_quick_brown_fox_jumps_over_the_lazy_dog",
+    "getUserByIdentifier", "user_manager", "Goldman", "bank", "foo-bar.baz",
+]
+
+private let batchQueries: [String] = [
+    "user", "gubi", "usermanager", "xmlhttp", "goldman sachs", "bank america", "cafe",
+    "muller", "москва", "fzm", "", "u", "quick fox", "zzzz", "getuserbyidentifier",
+]
+
+// MARK: - Equivalence
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman])
+func scoreBatchMatchesPerCandidateScore(config: MatchConfig) {
+    let matcher = FuzzyMatcher(config: config)
+    var batchBuffer = matcher.makeBuffer()
+    var buffer = matcher.makeBuffer()
+
+    for text in batchQueries {
+        let query = matcher.prepare(text)
+        // Block counts that are and aren't multiples of the lane count
+        for count in [0, 1, 7, 8, 9, 16, batchCandidates.count] {
+            let block = Array(batchCandidates.prefix(count))
+            let batched = matcher.scoreBatch(block.span, against: query, buffer: &batchBuffer)
+            let expected = block.map { matcher.score($0, against: query, buffer: &buffer) }
+            #expect(batched == expected, "query '\(text)' count \(count)")
+        }
+    }
+}
+
+@Test func scoreBatchHandlesUnevenLengths() {
+    let matcher = FuzzyMatcher(config: .smithWaterman)
+    var batchBuffer = matcher.makeBuffer()
+    var buffer = matcher.makeBuffer()
+    let block = ["ab", String(repeating: "x", count: 200) + "abc", "abc", "xabcx", "a", "bca", "abcabc", "cba", "abc"]
+    let query = matcher.prepare("abc")
+
+    let batched = matcher.scoreBatch(block.span, against: query, buffer: &batchBuffer)
+    #expect(batched == block.map { matcher.score($0, against: query, buffer: &buffer) })
+}
+
+// MARK: - Kernel
+
+@Test func swBatchKernelMatchesScalarKernel() {
+    let bonusValues: [Int32] = [0, 4, 5, 8, 9, 10]
+    var seed: UInt64 = 0xBA7C4
+    func next() -> Int {
+        seed = seed &* 6_364_136_223_846_793_005 &+ 1_442_695_040_888_963_407
+        return Int(seed >> 33)
+    }
+
+    var state = SmithWatermanState()
+    for iteration in 0..<2_000 {
+        let alphabet = 1 + iteration % 4
+        let query = (0..<(1 + next() % 12)).map { _ in UInt8(0x61 + next() % alphabet) }
+        let candidates = (0..<8).map { _ in (0..<(next() % 40)).map { _ in UInt8(0x61 + next() % alphabet) } }
+        let bonuses = candidates.map { candidate in candidate.map { _ in bonusValues[next() % bonusValues.count] } }
+
+        let blockLength = candidates.map(\.count).max() ?? 0
+        var characters = [SIMD8<Int32>](repeating: SIMD8(repeating: -1), count: blockLength)
+        var transposedBonuses = [SIMD8<Int32>](repeating: SIMD8(repeating: 0), count: blockLength)
+        var laneLengths = SIMD8<Int32>(repeating: 0)
+        for lane in 0..<8 {
+            laneLengths[lane] = Int32(candidates[lane].count)
+            for i in candidates[lane].indices {
+                characters[i][lane] = Int32(candidates[lane][i])
+                transposedBonuses[i][lane] = bonuses[lane][i]
+            }
+        }
+
+        let batched = smithWatermanScoreBatch(
+            query: query.span,
+            characters: characters.span,
+            bonuses: transposedBonuses.span,
+            laneLengths: laneLengths,
+            rows: &state.batchRows,
+            config: .default
+        )
+        for lane in 0..<8 {
+            let scalar = smithWatermanScoreScalar(
+                query: query.span,
+                candidate: candidates[lane].span,
+                bonus: bonuses[lane].span,
+                state: &state,
+                config: .default
+            )
+            #expect(batched[lane] == scalar, "query \(query) candidate \(candidates[lane])")
+        }
+    }
+}
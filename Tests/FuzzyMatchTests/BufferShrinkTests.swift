@@ -123,3 +123,73 @@ import Testing
     #expect(buffer.highWaterCandidateLength == 0)
     #expect(buffer.highWaterQueryLength == 0)
 }
+
+// MARK: - Fixed-Capacity Buffers
+
+private let fixedCapacityCandidates: [String] = [
+    "getUserById", "get_user_name", "UserManager", "XMLHttpRequest", "International Business Machines",
+    "the_quick_brown_fox_jumps_over_the_lazy_dog", "Café Müller", "Москва", "u", "",
+    String(repeating: "ab_", count: 80),
+]
+
+private let fixedCapacityQueries = ["u", "us", "gubi", "user", "usermanager", "quick brown fox", "cafe", "abababababab"]
+
+/// Base addresses of every scoring array, which change whenever one is reallocated.
+/// A set, because the edit distance rows trade places as they rotate.
+private func storageAddresses(_ buffer: inout ScoringBuffer) -> Set<UnsafeMutableRawPointer?> {
+    [
+        buffer.candidateStorage.bytes.withUnsafeMutableBytes { $0.baseAddress },
+        buffer.candidateStorage.bonus.withUnsafeMutableBytes { $0.baseAddress },
+        buffer.editDistanceState.row.withUnsafeMutableBytes { $0.baseAddress },
+        buffer.editDistanceState.prevRow.withUnsafeMutableBytes { $0.baseAddress },
+        buffer.editDistanceState.prevPrevRow.withUnsafeMutableBytes { $0.baseAddress },
+        buffer.matchPositions.withUnsafeMutableBytes { $0.baseAddress },
+        buffer.alignmentState.traceback.withUnsafeMutableBytes { $0.baseAddress },
+        buffer.alignmentState.matchScores.withUnsafeMutableBytes { $0.baseAddress },
+        buffer.alignmentState.gapScores.withUnsafeMutableBytes { $0.baseAddress },
+        buffer.wordInitials.withUnsafeMutableBytes { $0.baseAddress },
+        buffer.smithWatermanState.buffer.withUnsafeMutableBytes { $0.baseAddress },
+        buffer.smithWatermanState.simdBuffer.withUnsafeMutableBytes { $0.baseAddress },
+        buffer.smithWatermanState.batchRows.withUnsafeMutableBytes { $0.baseAddress },
+        buffer.smithWatermanBatchState.characters.withUnsafeMutableBytes { $0.baseAddress },
+    ]
+}
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman])
+func fixedCapacityBufferScoresWithoutReallocating(config: MatchConfig) {
+    let matcher = FuzzyMatcher(config: config)
+    var buffer = matcher.makeBuffer(maxQueryLength: 32, maxCandidateLength: 256)
+    var reference = matcher.makeBuffer()
+    let before = storageAddresses(&buffer)
+
+    // Far more calls than the default shrink interval, with varying query lengths
+    for _ in 0..<200 {
+        for text in fixedCapacityQueries {
+            let query = matcher.prepare(text)
+            for candidate in fixedCapacityCandidates {
+                let match = matcher.score(candidate, against: query, buffer: &buffer)
+                #expect(match == matcher.score(candidate, against: query, buffer: &reference))
+            }
+            #expect(matcher.scoreBatch(fixedCapacityCandidates.span, against: query, buffer: &buffer).count
+                == fixedCapacityCandidates.count)
+        }
+    }
+    #expect(storageAddresses(&buffer) == before)
+}
+
+@Test func fixedCapacityBufferPreallocatesAlignmentMatrices() {
+    let buffer = ScoringBuffer(maxQueryLength: 16, maxCandidateLength: 1_000)
+    #expect(buffer.alignmentState.matchScores.count == 16 * 512)
+    #expect(buffer.alignmentState.gapScores.count == 16 * 512)
+    #expect(buffer.alignmentState.traceback.count == 16 * 512)
+}
+
+@Test func fixedCapacityBufferStillGrowsForLongerInputs() {
+    let matcher = FuzzyMatcher()
+    var buffer = matcher.makeBuffer(maxQueryLength: 8, maxCandidateLength: 16)
+    var reference = matcher.makeBuffer()
+    let candidate = String(repeating: "a", count: 300)
+    let query = matcher.prepare("aaaaaaaaaaaa")
+    #expect(matcher.score(candidate, against: query, buffer: &buffer) == matcher.score(candidate, against: query, buffer: &reference))
+    #expect(buffer.candidateStorage.bytes.count >= 300)
+}
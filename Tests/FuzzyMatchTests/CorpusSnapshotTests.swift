@@ -0,0 +1,151 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+#if canImport(Darwin)
+import Darwin
+#elseif canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#endif
+@testable import FuzzyMatch
+import Testing
+
+// MARK: - Fixtures
+
+private let snapshotCandidates: [String] = [
+    "getUserById", "get_user_name", "UserManager", "XMLHttpRequest", "setUser", "",
+    "International Business Machines", "Goldman Sachs Group", "Café Müller", "Ελληνικά",
+    "Москва", "u", "the_quick_brown_fox_jumps_over_the_lazy_dog", "US0378331005",
+]
+
+private let snapshotQueries = ["user", "gubi", "usermanager", "goldman sachs", "cafe", "москва", "u", "", "us03783"]
+
+private func expectSameColumns(_ loaded: FuzzyCorpus, _ original: FuzzyCorpus) {
+    #expect(loaded.utf8 == original.utf8)
+    #expect(loaded.utf8Offsets == original.utf8Offsets)
+    #expect(loaded.lowercased == original.lowercased)
+    #expect(loaded.lowercasedOffsets == original.lowercasedOffsets)
+    #expect(loaded.charBitmasks == original.charBitmasks)
+    #expect(loaded.isASCII == original.isASCII)
+    #expect(loaded.lengths == original.lengths)
+    #expect(loaded.boundaryMasks == original.boundaryMasks)
+    #expect(loaded.wordInitials == original.wordInitials)
+    #expect(loaded.wordInitialOffsets == original.wordInitialOffsets)
+    #expect(loaded.lengthOrder == original.lengthOrder)
+    #expect(loaded.lengthOrderedCharBitmasks == original.lengthOrderedCharBitmasks)
+    #expect(loaded.bucketLengths == original.bucketLengths)
+    #expect(loaded.bucketStarts == original.bucketStarts)
+    #expect(loaded.hasTrigramIndex == original.hasTrigramIndex)
+    if let loadedIndex = loaded.trigramIndex, let originalIndex = original.trigramIndex {
+        #expect(loadedIndex.slots == originalIndex.slots)
+        #expect(loadedIndex.postingOffsets == originalIndex.postingOffsets)
+        #expect(loadedIndex.postingIDs == originalIndex.postingIDs)
+        #expect(loadedIndex.postingCounts == originalIndex.postingCounts)
+        #expect(loadedIndex.unindexed == originalIndex.unindexed)
+        #expect(loadedIndex.candidateCount == originalIndex.candidateCount)
+    }
+}
+
+// MARK: - Round Trip
+
+@Test(arguments: [false, true])
+func snapshotRoundTripPreservesColumns(buildTrigramIndex: Bool) throws {
+    let original = FuzzyCorpus(snapshotCandidates, buildTrigramIndex: buildTrigramIndex)
+    let bytes = original.snapshot()
+    #expect(bytes.count % 8 == 0)
+
+    let loaded = try FuzzyCorpus(snapshot: bytes)
+    expectSameColumns(loaded, original)
+    #expect(Array(loaded) == snapshotCandidates)
+}
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman])
+func snapshotSearchesMatchOriginal(config: MatchConfig) throws {
+    let original = FuzzyCorpus(snapshotCandidates, buildTrigramIndex: true)
+    let loaded = try FuzzyCorpus(snapshot: original.snapshot())
+    let matcher = FuzzyMatcher(config: config)
+    for text in snapshotQueries {
+        let query = matcher.prepare(text)
+        #expect(matcher.topMatches(loaded, against: query, limit: 5) == matcher.topMatches(original, against: query, limit: 5))
+        #expect(matcher.matches(loaded, against: query) == matcher.matches(original, against: query))
+    }
+}
+
+@Test func emptyCorpusSnapshotRoundTrips() throws {
+    let loaded = try FuzzyCorpus(snapshot: FuzzyCorpus([String]()).snapshot())
+    #expect(loaded.isEmpty)
+    #expect(FuzzyMatcher().topMatches(loaded, against: "user").isEmpty)
+}
+
+// MARK: - Validation
+
+@Test func snapshotRejectsForeignData() {
+    #expect(throws: FuzzyCorpus.SnapshotError.truncated) { try FuzzyCorpus(snapshot: [UInt8]()) }
+    #expect(throws: FuzzyCorpus.SnapshotError.notASnapshot) {
+        try FuzzyCorpus(snapshot: Array("name\tsymbol\tisin\nApple\tAAPL\tUS0378331005\n".utf8))
+    }
+}
+
+@Test func snapshotRejectsOtherVersionsAndLayouts() {
+    let bytes = FuzzyCorpus(snapshotCandidates).snapshot()
+
+    var newerVersion = bytes
+    newerVersion.withUnsafeMutableBytes { $0.storeBytes(of: UInt32(99), toByteOffset: 8, as: UInt32.self) }
+    #expect(throws: FuzzyCorpus.SnapshotError.unsupportedVersion(99)) { try FuzzyCorpus(snapshot: newerVersion) }
+
+    var swappedByteOrder = bytes
+    swappedByteOrder.withUnsafeMutableBytes {
+        $0.storeBytes(of: UInt32(0x0102_0304).byteSwapped, toByteOffset: 12, as: UInt32.self)
+    }
+    #expect(throws: FuzzyCorpus.SnapshotError.incompatibleLayout) { try FuzzyCorpus(snapshot: swappedByteOrder) }
+}
+
+@Test func truncatedSnapshotsThrow() {
+    let bytes = FuzzyCorpus(snapshotCandidates, buildTrigramIndex: true).snapshot()
+    for length in stride(from: 0, to: bytes.count, by: 7) {
+        #expect(throws: FuzzyCorpus.SnapshotError.self, "length \(length)") {
+            try FuzzyCorpus(snapshot: Array(bytes.prefix(length)))
+        }
+    }
+}
+
+@Test func inconsistentSnapshotThrows() {
+    let original = FuzzyCorpus(snapshotCandidates)
+    var bytes = original.snapshot()
+    // The utf8 column starts right after the 32-byte header: count, then the bytes.
+    // Its offsets table follows; point the second offset past the arena.
+    let offsetsStart = 32 + 8 + ((original.utf8.count + 7) & ~7)
+    bytes.withUnsafeMutableBytes { $0.storeBytes(of: Int.max, toByteOffset: offsetsStart + 8 + 8, as: Int.self) }
+    #expect(throws: FuzzyCorpus.SnapshotError.corrupted) { try FuzzyCorpus(snapshot: bytes) }
+}
+
+// MARK: - Files
+
+#if canImport(Darwin) || canImport(Glibc) || canImport(Musl)
+@Test func snapshotFileRoundTrips() throws {
+    let original = FuzzyCorpus(snapshotCandidates, buildTrigramIndex: true)
+    let path = "/tmp/fuzzymatch-snapshot-\(UInt64.random(in: 0...UInt64.max)).bin"
+    defer { unlink(path) }
+
+    try original.writeSnapshot(to: path)
+    let loaded = try FuzzyCorpus(contentsOfSnapshot: path)
+    expectSameColumns(loaded, original)
+}
+
+@Test func missingSnapshotFileThrows() {
+    #expect(throws: FuzzyCorpus.SnapshotError.fileError(ENOENT)) {
+        try FuzzyCorpus(contentsOfSnapshot: "/nonexistent/fuzzymatch.snapshot")
+    }
+}
+#endif
@@ -633,3 +633,92 @@ import Testing
         _ = matcher.score(candidate, against: query, buffer: &buffer)
     }
 }
+
+// MARK: - Bit-Parallel Kernels
+
+/// Deterministic byte strings over a small alphabet, so matches, substitutions and
+/// transpositions are all frequent.
+private func randomBytes(count: Int, alphabet: Int, state: inout UInt64) -> [UInt8] {
+    var bytes: [UInt8] = []
+    bytes.reserveCapacity(count)
+    for _ in 0..<count {
+        state = state &* 6_364_136_223_846_793_005 &+ 1_442_695_040_888_963_407
+        bytes.append(0x61 + UInt8((state >> 33) % UInt64(alphabet)))
+    }
+    return bytes
+}
+
+@Test func bitParallelKernelsAgreeWithDP() {
+    var seed: UInt64 = 0x5EED
+    for iteration in 0..<20_000 {
+        let longCase = iteration.isMultiple(of: 10)
+        let alphabet = 1 + iteration % 4
+        let queryLength = 1 + Int(seed >> 40) % (longCase ? 64 : 12)
+        let candidateLength = Int(seed >> 20) % (longCase ? 100 : 16)
+        let query = randomBytes(count: queryLength, alphabet: alphabet, state: &seed)
+        let candidate = randomBytes(count: candidateLength, alphabet: alphabet, state: &seed)
+        let maxEditDistance = iteration % 4
+        let masks = buildPatternMatchVectors(query)
+        var state = EditDistanceState(maxQueryLength: queryLength)
+
+        let prefixDP = prefixEditDistance(
+            query: query.span, candidate: candidate.span, state: &state, maxEditDistance: maxEditDistance
+        )
+        let prefixBP = prefixEditDistanceBitParallel(
+            patternMasks: masks.span, queryLength: queryLength, candidate: candidate.span, maxEditDistance: maxEditDistance
+        )
+        #expect(prefixDP == prefixBP, "prefix \(query) vs \(candidate), maxED \(maxEditDistance)")
+
+        let substringDP = substringEditDistance(
+            query: query.span, candidate: candidate.span, state: &state, maxEditDistance: maxEditDistance
+        )
+        let substringBP = substringEditDistanceBitParallel(
+            patternMasks: masks.span, queryLength: queryLength, candidate: candidate.span, maxEditDistance: maxEditDistance
+        )
+        #expect(substringDP == substringBP, "substring \(query) vs \(candidate), maxED \(maxEditDistance)")
+    }
+}
+
+@Test func bitParallelPrefixTransposition() {
+    let query: [UInt8] = Array("tge".utf8)
+    let candidate: [UInt8] = Array("getuserbyid".utf8)
+    let distance = prefixEditDistanceBitParallel(
+        patternMasks: buildPatternMatchVectors(query).span,
+        queryLength: query.count,
+        candidate: candidate.span,
+        maxEditDistance: 2
+    )
+    #expect(distance == 1)
+}
+
+@Test func bitParallelSubstringFullWidthQuery() {
+    // 64-byte query uses every bit of the vectors
+    let query = [UInt8](repeating: 0x61, count: 63) + [0x62]
+    var candidate = [UInt8](repeating: 0x78, count: 10) + query + [0x78]
+    #expect(substringEditDistanceBitParallel(
+        patternMasks: buildPatternMatchVectors(query).span,
+        queryLength: query.count,
+        candidate: candidate.span,
+        maxEditDistance: 2
+    ) == 0)
+
+    candidate[40] = 0x7A
+    #expect(substringEditDistanceBitParallel(
+        patternMasks: buildPatternMatchVectors(query).span,
+        queryLength: query.count,
+        candidate: candidate.span,
+        maxEditDistance: 2
+    ) == 1)
+}
+
+@Test func patternMatchVectorsOnlyForWordSizedQueries() {
+    #expect(buildPatternMatchVectors([]).isEmpty)
+    #expect(buildPatternMatchVectors([UInt8](repeating: 0x61, count: 64)).count == 256)
+    #expect(buildPatternMatchVectors([UInt8](repeating: 0x61, count: 65)).isEmpty)
+
+    let masks = buildPatternMatchVectors(Array("abca".utf8))
+    #expect(masks[0x61] == 0b1001)
+    #expect(masks[0x62] == 0b0010)
+    #expect(masks[0x63] == 0b0100)
+    #expect(masks[0x64] == 0)
+}
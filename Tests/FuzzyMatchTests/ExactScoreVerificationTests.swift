@@ -317,6 +317,32 @@ import Testing
     }
 }
 
+// MARK: - Bit-Parallel Kernel Boundary
+
+@Test func scoresAgreeAcrossBitParallelBoundary() {
+    // A 64-byte query runs the bit-parallel kernels and a 65-byte query the DP kernels.
+    // A transposed prefix and a transposed substring are found by both.
+    let matcher = FuzzyMatcher()
+    var buffer = matcher.makeBuffer()
+    let base64 = String(repeating: "abcdefgh", count: 8)
+    let base65 = base64 + "i"
+    #expect(!matcher.prepare(base64).patternMasks.isEmpty)
+    #expect(matcher.prepare(base65).patternMasks.isEmpty)
+
+    for base in [base64, base65] {
+        let query = matcher.prepare(base)
+        var typo = Array(base.utf8)
+        typo.swapAt(10, 11)
+        let prefixCandidate = String(decoding: typo, as: UTF8.self) + "_suffix"
+        let substringCandidate = "xx_" + String(decoding: typo, as: UTF8.self)
+
+        let prefix = matcher.score(prefixCandidate, against: query, buffer: &buffer)
+        let substring = matcher.score(substringCandidate, against: query, buffer: &buffer)
+        #expect(prefix?.kind == .prefix)
+        #expect(substring != nil)
+    }
+}
+
 // MARK: - Word Boundary Score Verification
 
 @Test func gubiMatchesGetUserByIdWithBonuses() {
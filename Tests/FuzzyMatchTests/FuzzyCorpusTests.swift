@@ -0,0 +1,260 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+@testable import FuzzyMatch
+import Testing
+
+// MARK: - Fixtures
+
+/// Mixed candidates: ASCII identifiers, company names, Latin-1 / Greek / Cyrillic text,
+/// decomposed combining marks, a long (> 64 byte) string and an empty string.
+private let corpusCandidates: [String] = [
+    "getUserById", "setUser", "fetchData", "userService", "UserManager",
+    "get_user_name", "XMLHttpRequest", "Apple Inc.", "Bank of America",
+    "International Consolidated Airlines Group", "Goldman Sachs Group",
+    "Café Müller", "Crème Brûlée", "Ελληνικά", "Москва Биржа",
+    "cafe\u{0301} au lait", "a", "A", "ab",
+    "the_quick_brown_fox_jumps_over_the_lazy_dog_and_keeps_running_far_away_from_home",
+    "",
+]
+
+private let corpusQueries: [String] = [
+    "", "u", "a", "user", "usr", "getuser", "fetch", "icag", "bank america",
+    "cafe", "creme", "ελλ", "москва", "xmlhttp", "lazy dog", "runing", "zzz",
+    "gsg", "boa", "tqbfjo", "tkrfa",
+]
+
+// MARK: - Construction
+
+@Test func corpusPreservesCandidatesAndOrder() {
+    let corpus = FuzzyCorpus(corpusCandidates)
+    #expect(corpus.count == corpusCandidates.count)
+    #expect(Array(corpus) == corpusCandidates)
+    #expect(corpus[corpus.count - 1] == "")
+}
+
+@Test func corpusColumnsMatchPerCallPreprocessing() {
+    let corpus = FuzzyCorpus(corpusCandidates)
+    for (index, candidate) in corpusCandidates.enumerated() {
+        let bytes = Array(candidate.utf8)
+        let (mask, isASCII) = computeCharBitmaskWithASCIICheck(bytes.span)
+        var lowered = [UInt8](repeating: 0, count: bytes.count)
+        let loweredLength = lowercaseUTF8(from: bytes.span, into: &lowered, isASCII: isASCII)
+
+        #expect(corpus.charBitmasks[index] == mask)
+        #expect(corpus.isASCII[index] == isASCII)
+        #expect(Int(corpus.lengths[index]) == bytes.count)
+        #expect(Array(corpus.lowercased[corpus.lowercasedRange(at: index)]) == Array(lowered[0..<loweredLength]))
+        #expect(
+            corpus.boundaryMasks[index]
+                == computeBoundaryMaskCompressed(originalBytes: bytes.span, isASCII: isASCII)
+        )
+    }
+}
+
+@Test func corpusWordInitialsMatchPerCallInitials() {
+    let corpus = FuzzyCorpus(corpusCandidates)
+    #expect(corpus.wordInitialOffsets.count == corpusCandidates.count + 1)
+    var initials = [UInt8](repeating: 0, count: 4)
+    for index in corpusCandidates.indices {
+        let lowered = corpus.lowercased.span.extracting(corpus.lowercasedRange(at: index))
+        let count = collectWordInitials(lowered, boundaryMask: corpus.boundaryMasks[index], into: &initials)
+        #expect(Array(corpus.wordInitials[corpus.wordInitialsRange(at: index)]) == Array(initials[0..<count]))
+    }
+    // camelCase and spaces each start a word
+    let names = FuzzyCorpus(["getUserById", "Goldman Sachs Group"])
+    #expect(Array(names.wordInitials[names.wordInitialsRange(at: 0)]) == Array("gubi".utf8))
+    #expect(Array(names.wordInitials[names.wordInitialsRange(at: 1)]) == Array("gsg".utf8))
+}
+
+@Test func emptyCorpus() {
+    let corpus = FuzzyCorpus([String]())
+    let matcher = FuzzyMatcher()
+    #expect(corpus.isEmpty)
+    #expect(matcher.topMatches(corpus, against: "user").isEmpty)
+    #expect(matcher.matches(corpus, against: "user").isEmpty)
+}
+
+// MARK: - Equivalence with per-call scoring
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman])
+func corpusScoreMatchesStringScore(config: MatchConfig) {
+    let matcher = FuzzyMatcher(config: config)
+    let corpus = FuzzyCorpus(corpusCandidates)
+    var stringBuffer = matcher.makeBuffer()
+    var corpusBuffer = matcher.makeBuffer()
+
+    for text in corpusQueries {
+        let query = matcher.prepare(text)
+        for (index, candidate) in corpusCandidates.enumerated() {
+            let expected = matcher.score(candidate, against: query, buffer: &stringBuffer)
+            let actual = matcher.score(corpus, at: index, against: query, buffer: &corpusBuffer)
+            #expect(actual == expected, "query '\(text)' candidate '\(candidate)'")
+        }
+    }
+}
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman])
+func corpusMatchesEqualSequenceMatches(config: MatchConfig) {
+    let matcher = FuzzyMatcher(config: config)
+    let corpus = FuzzyCorpus(corpusCandidates)
+
+    for text in corpusQueries {
+        let query = matcher.prepare(text)
+        let expected = matcher.matches(corpusCandidates, against: query)
+        let actual = matcher.matches(corpus, against: query)
+        #expect(actual.map(\.match.score) == expected.map(\.match.score), "query '\(text)'")
+        #expect(Set(actual) == Set(expected), "query '\(text)'")
+    }
+}
+
+@Test func corpusTopMatchesEqualSequenceTopMatches() {
+    let matcher = FuzzyMatcher()
+    let corpus = FuzzyCorpus(corpusCandidates)
+
+    for text in corpusQueries {
+        let query = matcher.prepare(text)
+        let expected = matcher.topMatches(corpusCandidates, against: query, limit: 3)
+        let actual = matcher.topMatches(corpus, against: query, limit: 3)
+        #expect(actual.count == expected.count, "query '\(text)'")
+        #expect(actual.map(\.match.score) == expected.map(\.match.score), "query '\(text)'")
+    }
+}
+
+@Test func corpusStringQueryOverloads() {
+    let matcher = FuzzyMatcher()
+    let corpus = FuzzyCorpus(corpusCandidates)
+    let top = matcher.topMatches(corpus, against: "user", limit: 2)
+    #expect(top.count == 2)
+    #expect(top[0].match.score >= top[1].match.score)
+    #expect(matcher.matches(corpus, against: "user").count >= 2)
+}
+
+// MARK: - Byte Arenas
+
+private func arena(of candidates: [String]) -> (utf8: [UInt8], offsets: [Int]) {
+    var utf8: [UInt8] = []
+    var offsets = [0]
+    for candidate in candidates {
+        utf8 += candidate.utf8
+        offsets.append(utf8.count)
+    }
+    return (utf8, offsets)
+}
+
+@Test func arenaCorpusEqualsStringCorpus() {
+    let (utf8, offsets) = arena(of: corpusCandidates)
+    let fromArena = FuzzyCorpus(utf8: utf8, offsets: offsets)
+    let fromStrings = FuzzyCorpus(corpusCandidates)
+
+    #expect(Array(fromArena) == corpusCandidates)
+    #expect(fromArena.utf8 == fromStrings.utf8)
+    #expect(fromArena.lowercased == fromStrings.lowercased)
+    #expect(fromArena.lowercasedOffsets == fromStrings.lowercasedOffsets)
+    #expect(fromArena.charBitmasks == fromStrings.charBitmasks)
+    #expect(fromArena.boundaryMasks == fromStrings.boundaryMasks)
+    #expect(fromArena.lengthOrder == fromStrings.lengthOrder)
+}
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman])
+func utf8ScoreMatchesStringScore(config: MatchConfig) {
+    let matcher = FuzzyMatcher(config: config)
+    var stringBuffer = matcher.makeBuffer()
+    var bytesBuffer = matcher.makeBuffer()
+
+    for text in corpusQueries {
+        let query = matcher.prepare(text)
+        for candidate in corpusCandidates {
+            let bytes = Array(candidate.utf8)
+            let expected = matcher.score(candidate, against: query, buffer: &stringBuffer)
+            #expect(matcher.score(utf8: bytes.span, against: query, buffer: &bytesBuffer) == expected)
+        }
+    }
+}
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman])
+func indexResultsMatchStringResults(config: MatchConfig) {
+    let matcher = FuzzyMatcher(config: config)
+    let (utf8, offsets) = arena(of: corpusCandidates)
+    let corpus = FuzzyCorpus(utf8: utf8, offsets: offsets, buildTrigramIndex: true)
+
+    for text in corpusQueries {
+        let query = matcher.prepare(text)
+        let top = matcher.topMatches(corpus, against: query, limit: 5)
+        let topIndices = matcher.topMatchIndices(corpus, against: query, limit: 5)
+        #expect(topIndices.map { MatchResult(candidate: corpus[$0.item], match: $0.match) } == top, "query '\(text)'")
+
+        let all = matcher.matchIndices(corpus, against: query)
+        #expect(all.map(\.match.score) == matcher.matches(corpus, against: query).map(\.match.score), "query '\(text)'")
+        #expect(zip(all, all.dropFirst()).allSatisfy { $0.match.score > $1.match.score || $0.item < $1.item })
+    }
+}
+
+// MARK: - Multi-Query Search
+
+/// Spans several multi-query tiles (1,024 candidates each) with a partial last tile.
+private let tiledCandidates: [String] = (0..<2_600).map { "\(corpusCandidates[$0 % corpusCandidates.count])\($0 % 97)" }
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman], [false, true])
+func multiQueryTopMatchesEqualPerQueryTopMatches(config: MatchConfig, buildTrigramIndex: Bool) {
+    let matcher = FuzzyMatcher(config: config)
+    let corpus = FuzzyCorpus(tiledCandidates, buildTrigramIndex: buildTrigramIndex)
+    // More queries than one group of 64, so survivor lists are rebuilt per group
+    let queries = (0..<150).map { matcher.prepare(corpusQueries[$0 % corpusQueries.count]) }
+
+    for limit in [1, 10] {
+        let batched = matcher.topMatches(corpus, against: queries, limit: limit)
+        #expect(batched.count == queries.count)
+        for (query, results) in zip(queries, batched) {
+            #expect(results == matcher.topMatches(corpus, against: query, limit: limit), "query '\(query.original)'")
+        }
+    }
+}
+
+@Test func multiQueryGroupMixesTrigramAndColumnSweepsAcrossTiles() {
+    let matcher = FuzzyMatcher()
+    // Matches on both sides of the first tile boundary, and in the partial last tile
+    var candidates = (0..<2_100).map { "filler\($0 % 89)" }
+    for index in [3, 1_020, 1_023, 1_024, 1_030, 2_099] {
+        candidates[index] = "getUserById\(index)"
+    }
+    candidates[1_022] = "userService"
+    candidates[1_025] = "goldman sachs"
+    let corpus = FuzzyCorpus(candidates, buildTrigramIndex: true)
+    let queries = ["g", "us", "user", "getuserbyid", "goldman", "gtusr", "sachs", "zzzz"].map { matcher.prepare($0) }
+
+    var kinds: Set<String> = []
+    for query in queries {
+        switch corpus.prefilterSweep(for: query) {
+        case .allIndices: kinds.insert("all")
+        case .trigramIndex: kinds.insert("trigram")
+        case .columns: kinds.insert("columns")
+        }
+    }
+    #expect(kinds == ["all", "trigram", "columns"])
+
+    for limit in [1, 4, 50] {
+        let batched = matcher.topMatches(corpus, against: queries, limit: limit)
+        for (query, results) in zip(queries, batched) {
+            #expect(results == matcher.topMatches(corpus, against: query, limit: limit), "query '\(query.original)'")
+        }
+    }
+}
+
+@Test func multiQueryTopMatchesEdgeCases() {
+    let matcher = FuzzyMatcher()
+    let corpus = FuzzyCorpus(corpusCandidates)
+    #expect(matcher.topMatches(corpus, against: [FuzzyQuery](), limit: 5).isEmpty)
+    #expect(matcher.topMatches(corpus, against: [matcher.prepare("user")], limit: 0) == [[]])
+    #expect(matcher.topMatches(FuzzyCorpus([String]()), against: [matcher.prepare("user")]) == [[]])
+}
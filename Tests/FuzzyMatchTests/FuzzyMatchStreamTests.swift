@@ -0,0 +1,122 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+@testable import FuzzyMatch
+import Testing
+
+// MARK: - Fixtures
+
+private let streamLines: [String] = {
+    let stems = [
+        "GET /api/users 200", "POST /api/login 401 timeout", "user session expired",
+        "config reloaded", "Café Müller order 17", "worker timed out", "",
+    ]
+    return (0..<5_000).map { "\(stems[$0 % stems.count]) #\($0)" }
+}()
+
+/// Emits the lines of an array, optionally throwing after `failAfter` lines.
+private struct LineSource: AsyncSequence, Sendable {
+    typealias Element = String
+    struct Failure: Error, Equatable {}
+
+    let lines: [String]
+    var failAfter: Int?
+
+    struct AsyncIterator: AsyncIteratorProtocol {
+        let lines: [String]
+        let failAfter: Int?
+        var position = 0
+
+        mutating func next() async throws -> String? {
+            if position == failAfter { throw Failure() }
+            guard position < lines.count else { return nil }
+            defer { position += 1 }
+            return lines[position]
+        }
+    }
+
+    func makeAsyncIterator() -> AsyncIterator {
+        AsyncIterator(lines: lines, failAfter: failAfter)
+    }
+}
+
+private func sequentialMatches(_ matcher: FuzzyMatcher, _ query: FuzzyQuery, _ lines: [String]) -> [MatchResult] {
+    var buffer = matcher.makeBuffer()
+    return lines.compactMap { line in
+        matcher.score(line, against: query, buffer: &buffer).map { MatchResult(candidate: line, match: $0) }
+    }
+}
+
+// MARK: - Ordering
+
+@Test(arguments: [1, 7, 256, 4_096, 10_000], [1, 3, 8])
+func matchStreamPreservesInputOrder(chunkSize: Int, concurrency: Int) async throws {
+    let matcher = FuzzyMatcher()
+    for text in ["timeout", "user", "cafe", "zzzz"] {
+        let query = matcher.prepare(text)
+        var streamed: [MatchResult] = []
+        let stream = matcher.matchStream(
+            LineSource(lines: streamLines), against: query, chunkSize: chunkSize, concurrency: concurrency
+        )
+        for try await result in stream {
+            streamed.append(result)
+        }
+        #expect(streamed == sequentialMatches(matcher, query, streamLines), "query '\(text)'")
+    }
+}
+
+@Test func matchStreamOverEmptySequenceEnds() async throws {
+    let matcher = FuzzyMatcher()
+    var iterator = matcher.matchStream(LineSource(lines: []), against: matcher.prepare("user"), concurrency: 4)
+        .makeAsyncIterator()
+    #expect(try await iterator.next() == nil)
+    #expect(try await iterator.next() == nil)
+}
+
+@Test func matchStreamDeliversChunksBeforeSlowBaseEnds() async throws {
+    let matcher = FuzzyMatcher()
+    let (lines, continuation) = AsyncStream.makeStream(of: String.self)
+    var iterator = matcher.matchStream(lines, against: matcher.prepare("timeout"), chunkSize: 2, concurrency: 8)
+        .makeAsyncIterator()
+
+    // One full chunk, far fewer lines than `concurrency` chunks, and the base stays open
+    continuation.yield("request timeout")
+    continuation.yield("1234 5678")
+    #expect(try await iterator.next()?.candidate == "request timeout")
+
+    continuation.yield("login timeout")
+    continuation.finish()
+    #expect(try await iterator.next()?.candidate == "login timeout")
+    #expect(try await iterator.next() == nil)
+}
+
+// MARK: - Errors and Early Exit
+
+@Test func matchStreamRethrowsUpstreamErrors() async {
+    let matcher = FuzzyMatcher()
+    let source = LineSource(lines: streamLines, failAfter: 1_000)
+    await #expect(throws: LineSource.Failure()) {
+        for try await _ in matcher.matchStream(source, against: matcher.prepare("user"), chunkSize: 64, concurrency: 4) {}
+    }
+}
+
+@Test func matchStreamStopsEarly() async throws {
+    let matcher = FuzzyMatcher()
+    let query = matcher.prepare("timeout")
+    var firstResults: [MatchResult] = []
+    for try await result in matcher.matchStream(LineSource(lines: streamLines), against: query, chunkSize: 32, concurrency: 4) {
+        firstResults.append(result)
+        if firstResults.count == 5 { break }
+    }
+    #expect(firstResults == Array(sequentialMatches(matcher, query, streamLines).prefix(5)))
+}
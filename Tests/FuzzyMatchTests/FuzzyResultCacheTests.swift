@@ -0,0 +1,155 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+import FuzzyMatch
+import Testing
+
+// MARK: - Fixtures
+
+private let cacheCandidates: [String] = [
+    "getUserById", "get_user_name", "getUserByIdentifier", "UserManager", "user_manager",
+    "setUser", "fetchData", "XMLHttpRequest", "International Business Machines",
+    "Goldman Sachs Group", "Bank of America", "Apple Inc.", "Applied Materials",
+]
+
+// MARK: - Query Hashing
+
+@Test func equalQueriesHashAlike() {
+    let matcher = FuzzyMatcher()
+    let first = matcher.prepare("getUser")
+    let second = matcher.prepare("getUser")
+    #expect(first == second)
+    #expect(first.hashValue == second.hashValue)
+    #expect(Set([first, second]).count == 1)
+    #expect(first != FuzzyMatcher(config: .smithWaterman).prepare("getUser"))
+}
+
+@Test func corpusGenerationsAreDistinct() throws {
+    let corpus = FuzzyCorpus(cacheCandidates)
+    let copy = corpus
+    let rebuilt = FuzzyCorpus(cacheCandidates)
+    let loaded = try FuzzyCorpus(snapshot: corpus.snapshot())
+    #expect(copy.generation == corpus.generation)
+    #expect(rebuilt.generation > corpus.generation)
+    #expect(loaded.generation > rebuilt.generation)
+}
+
+// MARK: - Caching
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman])
+func cachedResultsMatchUncached(config: MatchConfig) {
+    let corpus = FuzzyCorpus(cacheCandidates)
+    let matcher = FuzzyMatcher(config: config)
+    let cache = FuzzyResultCache(capacity: 64)
+
+    for text in ["user", "appl", "bank", "user", "xyz", "appl"] {
+        let query = matcher.prepare(text)
+        #expect(matcher.topMatches(corpus, against: query, limit: 5, cache: cache) == matcher.topMatches(corpus, against: query, limit: 5))
+    }
+    #expect(cache.statistics.hits == 2)
+    #expect(cache.statistics.misses == 4)
+    #expect(cache.count == 4)
+}
+
+@Test func limitAndGenerationAreSeparateKeys() {
+    let matcher = FuzzyMatcher()
+    let query = matcher.prepare("user")
+    let cache = FuzzyResultCache()
+    let corpus = FuzzyCorpus(cacheCandidates)
+
+    _ = matcher.topMatches(corpus, against: query, limit: 5, cache: cache)
+    #expect(matcher.topMatches(corpus, against: query, limit: 2, cache: cache).count <= 2)
+    #expect(cache.statistics.misses == 2)
+
+    // A rebuilt corpus with other contents must not see the old results
+    let updated = FuzzyCorpus(cacheCandidates + ["userProfile"])
+    let results = matcher.topMatches(updated, against: query, limit: 5, cache: cache)
+    #expect(results == matcher.topMatches(updated, against: query, limit: 5))
+    #expect(cache.statistics.misses == 3)
+    #expect(cache.statistics.hits == 0)
+}
+
+@Test func leastRecentlyUsedEntryIsEvicted() {
+    let matcher = FuzzyMatcher()
+    let corpus = FuzzyCorpus(cacheCandidates)
+    let cache = FuzzyResultCache(capacity: 2, shardCount: 1)
+    let queries = ["user", "bank", "appl"].map { matcher.prepare($0) }
+
+    _ = matcher.topMatches(corpus, against: queries[0], cache: cache)
+    _ = matcher.topMatches(corpus, against: queries[1], cache: cache)
+    _ = matcher.topMatches(corpus, against: queries[0], cache: cache) // "user" is now the most recent
+    _ = matcher.topMatches(corpus, against: queries[2], cache: cache) // evicts "bank"
+    #expect(cache.count == 2)
+    #expect(cache.statistics.evictions == 1)
+
+    _ = matcher.topMatches(corpus, against: queries[0], cache: cache)
+    #expect(cache.statistics.hits == 2)
+    _ = matcher.topMatches(corpus, against: queries[1], cache: cache)
+    #expect(cache.statistics.misses == 4)
+
+    cache.removeAll()
+    #expect(cache.count == 0)
+}
+
+@Test(arguments: [false, true])
+func sessionsShareCacheEntries(buildTrigramIndex: Bool) {
+    // The last candidate reaches the trigram threshold of "abcdefghij" but not of "abcdefghi"
+    let corpus = FuzzyCorpus(cacheCandidates + ["a_b_c_d_e_f_g_hij_hij"], buildTrigramIndex: buildTrigramIndex)
+    let matcher = FuzzyMatcher()
+    let cache = FuzzyResultCache()
+    var first = FuzzySearchSession(corpus: corpus, matcher: matcher)
+    var second = FuzzySearchSession(corpus: corpus, matcher: matcher)
+    let typed = ["g", "ge", "get", "getu", "getus", "getuser", "abcdefghi", "abcdefghij"]
+
+    for text in typed {
+        first.update(text)
+        let expected = matcher.topMatches(corpus, against: matcher.prepare(text), limit: 5)
+        #expect(first.topMatches(limit: 5, cache: cache) == expected, "query '\(text)'")
+    }
+    let misses = cache.statistics.misses
+    for text in typed {
+        second.update(text)
+        #expect(second.topMatches(limit: 5, cache: cache) == second.topMatches(limit: 5))
+    }
+    #expect(cache.statistics.misses == misses)
+    for text in typed {
+        let query = matcher.prepare(text)
+        #expect(matcher.topMatches(corpus, against: query, limit: 5, cache: cache) == matcher.topMatches(corpus, against: query, limit: 5))
+    }
+    #expect(cache.statistics.misses == misses)
+}
+
+@Test func concurrentLookupsReturnConsistentResults() async {
+    let corpus = FuzzyCorpus(cacheCandidates)
+    let matcher = FuzzyMatcher()
+    let cache = FuzzyResultCache(capacity: 8, shardCount: 4)
+    let texts = ["user", "bank", "appl", "getu", "xml", "gold", "sachs", "data", "fetch", "manager"]
+    let expected = texts.map { matcher.topMatches(corpus, against: matcher.prepare($0), limit: 3) }
+
+    let allMatched = await withTaskGroup(of: Bool.self) { group in
+        for task in 0..<8 {
+            group.addTask {
+                var matched = true
+                for round in 0..<50 {
+                    let index = (task + round) % texts.count
+                    let results = matcher.topMatches(corpus, against: matcher.prepare(texts[index]), limit: 3, cache: cache)
+                    matched = matched && results == expected[index]
+                }
+                return matched
+            }
+        }
+        return await group.allSatisfy { $0 }
+    }
+    #expect(allMatched)
+    #expect(cache.count <= cache.capacity)
+}
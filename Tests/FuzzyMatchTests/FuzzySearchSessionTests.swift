@@ -0,0 +1,97 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+@testable import FuzzyMatch
+import Testing
+
+// MARK: - Fixtures
+
+private let sessionCandidates: [String] = [
+    "getUserById", "get_user_name", "getUserByIdentifier", "UserManager", "user_manager",
+    "setUser", "fetchData", "XMLHttpRequest", "International Business Machines",
+    "Goldman Sachs Group", "Bank of America", "Café Müller", "", "g", "gu", "gub",
+    "the_quick_brown_fox_jumps_over_the_lazy_dog", "abcdefghijklmnopqrstuvwxyz",
+]
+
+/// Successive query texts: typing, a backspace, an edit, and a multi-word query.
+private let typedQueries: [String] = [
+    "", "g", "ge", "get", "getu", "getus", "getuse", "getuser", "getuserb", "getuserby",
+    "getuserbyid", "getuserbyi", "getuserbyx", "goldman", "goldman s", "goldman sachs",
+    "bank", "bank of", "xml", "xmlh", "xmlhttp", "",
+]
+
+// MARK: - Equivalence
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman], [false, true])
+func sessionMatchesFullSearch(config: MatchConfig, buildTrigramIndex: Bool) {
+    let corpus = FuzzyCorpus(sessionCandidates, buildTrigramIndex: buildTrigramIndex)
+    let matcher = FuzzyMatcher(config: config)
+    var session = FuzzySearchSession(corpus: corpus, matcher: matcher)
+
+    for text in typedQueries {
+        session.update(text)
+        let query = matcher.prepare(text)
+        #expect(session.query == query)
+        #expect(session.topMatches(limit: 5) == matcher.topMatches(corpus, against: query, limit: 5), "query '\(text)'")
+        #expect(session.matches() == matcher.matches(corpus, against: query), "query '\(text)'")
+    }
+}
+
+// MARK: - Refinement
+
+@Test func sessionNarrowsOnAppend() {
+    let corpus = FuzzyCorpus(sessionCandidates)
+    var session = FuzzySearchSession(corpus: corpus, matcher: FuzzyMatcher(config: .smithWaterman))
+
+    session.update("get")
+    #expect(!session.lastUpdateWasIncremental)
+    let before = session.candidateCount
+    session.update("getuser")
+    #expect(session.lastUpdateWasIncremental)
+    #expect(session.candidateCount <= before)
+}
+
+@Test func sessionSweepsOnBackspaceAndEdit() {
+    let corpus = FuzzyCorpus(sessionCandidates)
+    var session = FuzzySearchSession(corpus: corpus, matcher: FuzzyMatcher(config: .smithWaterman))
+
+    session.update("getuser")
+    session.update("getuse")
+    #expect(!session.lastUpdateWasIncremental)
+    session.update("getusx")
+    #expect(!session.lastUpdateWasIncremental)
+}
+
+@Test func sessionSweepsWhenEditBudgetGrows() {
+    let matcher = FuzzyMatcher()
+    // "abc" allows no missing characters; "abcd" tolerates one
+    #expect(!matcher.prepare("abcd").narrows(matcher.prepare("abc")))
+    #expect(matcher.prepare("abcdef").narrows(matcher.prepare("abcde")))
+    #expect(!matcher.prepare("abcdef").narrows(FuzzyMatcher(config: .smithWaterman).prepare("abcde")))
+}
+
+@Test func sessionReselectsThroughTrigramIndex() {
+    // Shares no trigram with "abcdefghi" but two with "abcdefghij"
+    let candidates = sessionCandidates + ["a_b_c_d_e_f_g_hij_hij"]
+    let corpus = FuzzyCorpus(candidates, buildTrigramIndex: true)
+    let matcher = FuzzyMatcher()
+    var session = FuzzySearchSession(corpus: corpus, matcher: matcher)
+
+    session.update("abcdefghi")
+    #expect(session.topMatches(limit: 10) == matcher.topMatches(corpus, against: matcher.prepare("abcdefghi"), limit: 10))
+    session.update("abcdefghij")
+    #expect(!session.lastUpdateWasIncremental)
+    let query = matcher.prepare("abcdefghij")
+    #expect(session.topMatches(limit: 10) == matcher.topMatches(corpus, against: query, limit: 10))
+    #expect(session.matches() == matcher.matches(corpus, against: query))
+}
@@ -0,0 +1,113 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+@testable import FuzzyMatch
+import Testing
+
+// MARK: - Fixtures
+
+private let interruptibleCandidates: [String] = {
+    let stems = [
+        "getUser", "setUser", "fetchData", "userService", "configManager",
+        "appConfig", "Bank of America", "Apple Inc.", "Café Müller", "XMLHttpRequest",
+    ]
+    return (0..<10_000).map { i in i % 9 == 0 ? stems[i % stems.count] : "\(stems[i % stems.count])\(i)" }
+}()
+
+// MARK: - Completed Searches
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman])
+func uninterruptedSearchEqualsTopMatches(config: MatchConfig) async {
+    let matcher = FuzzyMatcher(config: config)
+    let corpus = FuzzyCorpus(interruptibleCandidates)
+    for text in ["user", "u", "bank america", "cafe", "zzzz"] {
+        let query = matcher.prepare(text)
+        let expected = matcher.topMatches(corpus, against: query, limit: 30)
+        for (chunkSize, concurrency) in [(4_096, 1), (100, 1), (257, 4), (1, 3)] {
+            let search = await matcher.interruptibleTopMatches(
+                corpus,
+                against: query,
+                limit: 30,
+                chunkSize: chunkSize,
+                concurrency: concurrency
+            )
+            #expect(search.isComplete)
+            #expect(search.scoredCount == search.candidateCount)
+            #expect(search.results == expected, "query '\(text)', chunk \(chunkSize), \(concurrency) workers")
+        }
+    }
+}
+
+@Test func distantDeadlineCompletes() async {
+    let matcher = FuzzyMatcher()
+    let corpus = FuzzyCorpus(interruptibleCandidates)
+    let query = matcher.prepare("config")
+    let search = await matcher.interruptibleTopMatches(corpus, against: query, deadline: .now + .seconds(3_600), concurrency: 2)
+    #expect(search.isComplete)
+    #expect(search.results == matcher.topMatches(corpus, against: query))
+}
+
+@Test func zeroLimitIsComplete() async {
+    let matcher = FuzzyMatcher()
+    let search = await matcher.interruptibleTopMatches(FuzzyCorpus(interruptibleCandidates), against: matcher.prepare("user"), limit: 0)
+    #expect(search.isComplete)
+    #expect(search.results.isEmpty)
+}
+
+// MARK: - Interrupted Searches
+
+@Test func passedDeadlineScoresNothing() async {
+    let matcher = FuzzyMatcher()
+    let corpus = FuzzyCorpus(interruptibleCandidates)
+    let search = await matcher.interruptibleTopMatches(corpus, against: matcher.prepare("user"), deadline: .now - .seconds(1))
+    #expect(!search.isComplete)
+    #expect(search.scoredCount == 0)
+    #expect(search.candidateCount > 0)
+    #expect(search.results.isEmpty)
+}
+
+@Test func cancelledSearchStops() async {
+    let matcher = FuzzyMatcher()
+    let corpus = FuzzyCorpus(interruptibleCandidates)
+    let search = await Task {
+        withUnsafeCurrentTask { $0?.cancel() }
+        return await matcher.interruptibleTopMatches(corpus, against: matcher.prepare("user"), concurrency: 4)
+    }.value
+    #expect(!search.isComplete)
+    #expect(search.scoredCount == 0)
+    #expect(search.results.isEmpty)
+}
+
+@Test func stoppedSearchReturnsBestOfScoredChunks() async {
+    let matcher = FuzzyMatcher()
+    let corpus = FuzzyCorpus(interruptibleCandidates)
+    let query = matcher.prepare("user")
+    var survivors: [UInt32] = []
+    corpus.collectPrefilterSurvivors(for: query, into: &survivors)
+
+    // Whether or not the deadline hits, one worker scores a prefix of the survivors
+    let search = await matcher.interruptibleTopMatches(
+        corpus,
+        against: query,
+        limit: 15,
+        deadline: .now + .microseconds(200),
+        chunkSize: 64
+    )
+    #expect(search.candidateCount == survivors.count)
+    #expect(search.isComplete == (search.scoredCount == survivors.count))
+    #expect(search.scoredCount % 64 == 0 || search.isComplete)
+
+    var expected = TopKCollector<MatchResult>(limit: 15)
+    matcher.collectTopMatches(corpus, indices: survivors.prefix(search.scoredCount), against: query, into: &expected)
+    #expect(search.results == expected.sortedElements())
+}
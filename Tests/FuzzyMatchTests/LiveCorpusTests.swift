@@ -0,0 +1,194 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+import FuzzyMatch
+import Testing
+
+// MARK: - Fixtures
+
+private let liveCandidates: [String] = [
+    "getUserById", "get_user_name", "getUserByIdentifier", "UserManager", "user_manager",
+    "setUser", "fetchData", "XMLHttpRequest", "International Business Machines",
+    "Goldman Sachs Group", "Bank of America", "Apple Inc.", "Applied Materials",
+]
+
+private let liveQueries = ["user", "getuser", "appl", "bank", "xml", "u", "", "sachs", "data"]
+
+/// Expects every query to rank `view` exactly like a corpus rebuilt from its live candidates.
+private func expectMatchesRebuilt(_ view: SegmentedCorpus, matcher: FuzzyMatcher) {
+    let rebuilt = FuzzyCorpus(view.candidates)
+    let ids = view.ids
+    for text in liveQueries {
+        let query = matcher.prepare(text)
+        #expect(matcher.topMatches(view, against: query, limit: 50) == matcher.topMatches(rebuilt, against: query, limit: 50))
+        #expect(matcher.topMatches(view, against: query, limit: 3) == matcher.topMatches(rebuilt, against: query, limit: 3))
+        let byID = matcher.topMatchIDs(view, against: query, limit: 50).map(\.item)
+        let byIndex = matcher.topMatchIndices(rebuilt, against: query, limit: 50).map { ids[$0.item] }
+        #expect(byID == byIndex)
+    }
+}
+
+// MARK: - Views
+
+@Test func initialViewHoldsCandidatesInIDOrder() {
+    let live = LiveCorpus(liveCandidates)
+    let view = live.current
+    #expect(view.count == liveCandidates.count)
+    #expect(view.ids == Array(liveCandidates.indices))
+    #expect(view.candidates == liveCandidates)
+    #expect(view[id: 3] == "UserManager")
+    #expect(view[id: liveCandidates.count] == nil)
+    #expect(view.deltaCount == 0)
+    #expect(view.deletedCount == 0)
+}
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman])
+func appendsAndRemovalsMatchRebuiltCorpus(config: MatchConfig) {
+    let matcher = FuzzyMatcher(config: config)
+    let live = LiveCorpus(liveCandidates, compactionThreshold: .max)
+    expectMatchesRebuilt(live.current, matcher: matcher)
+
+    let userID = live.append("userProfile")
+    #expect(userID == liveCandidates.count)
+    let added = live.append(contentsOf: ["Applebee's", "getUserById", "BankUnited"])
+    #expect(added == userID + 1..<userID + 4)
+    expectMatchesRebuilt(live.current, matcher: matcher)
+
+    #expect(live.remove(id: 0))
+    #expect(!live.remove(id: 0))
+    #expect(live.remove(id: added.lowerBound))
+    #expect(live.remove(ids: [5, 9, added.upperBound - 1, 1_000]) == 3)
+    #expect(live.current.deletedCount == 3)
+    #expect(live.current.deltaCount == 2)
+    #expect(live.current.count == liveCandidates.count + 4 - 6)
+    #expect(!live.current.contains(id: 5))
+    #expect(live.current[id: userID] == "userProfile")
+    expectMatchesRebuilt(live.current, matcher: matcher)
+
+    #expect(live.compact())
+    #expect(live.current.deltaCount == 0)
+    #expect(live.current.deletedCount == 0)
+    #expect(live.current[id: userID] == "userProfile")
+    expectMatchesRebuilt(live.current, matcher: matcher)
+
+    live.append("getUser")
+    live.remove(id: userID)
+    expectMatchesRebuilt(live.current, matcher: matcher)
+}
+
+@Test func compactionKeepsIDs() {
+    let live = LiveCorpus(liveCandidates, buildTrigramIndex: true, compactionThreshold: .max)
+    live.append(contentsOf: ["userProfile", "userSettings"])
+    live.remove(ids: [1, 2, 14])
+    let before = live.current
+    #expect(live.needsCompaction == false)
+
+    live.compact()
+    let after = live.current
+    #expect(after.ids == before.ids)
+    #expect(after.candidates == before.candidates)
+    #expect(after.generation != before.generation)
+    expectMatchesRebuilt(after, matcher: FuzzyMatcher())
+}
+
+@Test func viewsAreIsolatedFromLaterWrites() {
+    let matcher = FuzzyMatcher()
+    let query = matcher.prepare("user")
+    let live = LiveCorpus(liveCandidates, compactionThreshold: .max)
+    let view = live.current
+    let results = matcher.topMatches(view, against: query)
+
+    live.append("userProfile")
+    live.remove(ids: [0, 1, 3])
+    live.compact()
+
+    #expect(view.candidates == liveCandidates)
+    #expect(matcher.topMatches(view, against: query) == results)
+    #expect(matcher.topMatches(live.current, against: query) != results)
+}
+
+@Test func compactionThresholdCountsDeltaAndDeletions() {
+    let live = LiveCorpus(liveCandidates, compactionThreshold: 3)
+    #expect(!live.compactIfNeeded())
+    live.append("one")
+    live.remove(id: 0)
+    #expect(!live.needsCompaction)
+    #expect(live.current.deltaCount + live.current.deletedCount == 2)
+}
+
+@Test func reachingThresholdCompactsInBackground() async throws {
+    let live = LiveCorpus(liveCandidates, compactionThreshold: 3)
+    live.append(contentsOf: ["userProfile", "userSettings"])
+    live.remove(id: 0)
+
+    // Two delta candidates and one deletion reach the threshold
+    let deadline = ContinuousClock.now + .seconds(10)
+    while live.current.deltaCount + live.current.deletedCount > 0, ContinuousClock.now < deadline {
+        try await Task.sleep(for: .milliseconds(1))
+    }
+    #expect(live.current.deltaCount == 0)
+    #expect(live.current.deletedCount == 0)
+    #expect(live.current.candidates == Array(liveCandidates.dropFirst()) + ["userProfile", "userSettings"])
+    #expect(!live.needsCompaction)
+}
+
+@Test func cacheDistinguishesViews() {
+    let matcher = FuzzyMatcher()
+    let query = matcher.prepare("user")
+    let cache = FuzzyResultCache()
+    let live = LiveCorpus(liveCandidates, compactionThreshold: .max)
+
+    _ = matcher.topMatches(live.current, against: query, cache: cache)
+    _ = matcher.topMatches(live.current, against: query, cache: cache)
+    #expect(cache.statistics.hits == 1)
+
+    live.append("userProfile")
+    let results = matcher.topMatches(live.current, against: query, cache: cache)
+    #expect(results == matcher.topMatches(live.current, against: query))
+    #expect(results.contains { $0.candidate == "userProfile" })
+    #expect(cache.statistics.misses == 2)
+}
+
+// MARK: - Concurrency
+
+@Test func concurrentWritesAndSearchesStayConsistent() async {
+    let matcher = FuzzyMatcher()
+    let live = LiveCorpus(liveCandidates, compactionThreshold: 8)
+    let added = (0..<200).map { "userRecord\($0)" }
+
+    await withTaskGroup(of: Void.self) { group in
+        group.addTask {
+            for (offset, candidate) in added.enumerated() {
+                let id = live.append(candidate)
+                if offset % 3 == 0 {
+                    live.remove(id: id)
+                }
+            }
+        }
+        for _ in 0..<4 {
+            group.addTask {
+                for _ in 0..<50 {
+                    let view = live.current
+                    let query = matcher.prepare("userrecord")
+                    let rebuilt = FuzzyCorpus(view.candidates)
+                    #expect(matcher.topMatches(view, against: query, limit: 20) == matcher.topMatches(rebuilt, against: query, limit: 20))
+                }
+            }
+        }
+    }
+
+    live.compact()
+    let expected = liveCandidates + added.enumerated().filter { $0.offset % 3 != 0 }.map(\.element)
+    #expect(live.current.candidates == expected)
+    expectMatchesRebuilt(live.current, matcher: matcher)
+}
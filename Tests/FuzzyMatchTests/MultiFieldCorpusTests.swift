@@ -0,0 +1,125 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+@testable import FuzzyMatch
+import Testing
+
+// MARK: - Fixtures
+
+private struct Instrument {
+    let symbol: String
+    let name: String
+    let isin: String
+}
+
+private let instruments: [Instrument] = [
+    Instrument(symbol: "AAPL", name: "Apple Inc.", isin: "US0378331005"),
+    Instrument(symbol: "MSFT", name: "Microsoft Corporation", isin: "US5949181045"),
+    Instrument(symbol: "GOOGL", name: "Alphabet Inc. Class A", isin: "US02079K3059"),
+    Instrument(symbol: "GS", name: "Goldman Sachs Group", isin: "US38141G1040"),
+    Instrument(symbol: "BAC", name: "Bank of America", isin: "US0605051046"),
+    Instrument(symbol: "IAG", name: "International Consolidated Airlines Group", isin: "ES0177542018"),
+    Instrument(symbol: "IBM", name: "International Business Machines", isin: "US4592001014"),
+    Instrument(symbol: "NESN", name: "Nestlé S.A.", isin: "CH0038863350"),
+    Instrument(symbol: "", name: "", isin: ""),
+    Instrument(symbol: "APP", name: "AppLovin", isin: "US03831W1080"),
+]
+
+private let fieldQueries = ["", "aapl", "apple", "app", "us0378", "goldman", "icag", "ibm", "nestle", "inc", "zzz", "a"]
+
+private let fieldWeights: [[Double]?] = [nil, [1.0, 0.9, 1.0], [0.5, 1.0, 0.0], [2.0, 1.0, 1.5]]
+
+/// Reference: score every field of every record with the string API and keep the
+/// first field with the best weighted score.
+private func referenceMatches(
+    _ matcher: FuzzyMatcher,
+    query: FuzzyQuery,
+    weights: [Double]?
+) -> [MultiFieldMatchResult] {
+    let weights = weights ?? [1.0, 1.0, 1.0]
+    var buffer = matcher.makeBuffer()
+    var results: [MultiFieldMatchResult] = []
+    for (record, instrument) in instruments.enumerated() {
+        var best: MultiFieldMatchResult?
+        for (field, text) in [instrument.symbol, instrument.name, instrument.isin].enumerated() where weights[field] > 0 {
+            guard let match = matcher.score(text, against: query, buffer: &buffer) else { continue }
+            let weighted = match.score * weights[field]
+            if weighted > best?.score ?? -.infinity {
+                best = MultiFieldMatchResult(record: record, field: field, match: match, score: weighted)
+            }
+        }
+        if let best {
+            results.append(best)
+        }
+    }
+    return results.sorted { $0.score != $1.score ? $0.score > $1.score : $0.record < $1.record }
+}
+
+// MARK: - Construction
+
+@Test func multiFieldCorpusKeepsRecordsAndFields() {
+    let corpus = MultiFieldCorpus(instruments, fields: [\.symbol, \.name, \.isin])
+    #expect(corpus.recordCount == instruments.count)
+    #expect(corpus.fieldCount == 3)
+    for (record, instrument) in instruments.enumerated() {
+        #expect(corpus[record, 0] == instrument.symbol)
+        #expect(corpus[record, 1] == instrument.name)
+        #expect(corpus[record, 2] == instrument.isin)
+    }
+
+    let fromColumns = MultiFieldCorpus(columns: [instruments.map(\.symbol), instruments.map(\.name), instruments.map(\.isin)])
+    #expect(fromColumns.recordCount == corpus.recordCount)
+    #expect(fromColumns[3, 1] == "Goldman Sachs Group")
+}
+
+// MARK: - Equivalence
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman], [false, true])
+func multiFieldSearchMatchesReference(config: MatchConfig, buildTrigramIndex: Bool) {
+    let matcher = FuzzyMatcher(config: config)
+    let corpus = MultiFieldCorpus(instruments, fields: [\.symbol, \.name, \.isin], buildTrigramIndex: buildTrigramIndex)
+
+    for text in fieldQueries {
+        let query = matcher.prepare(text)
+        for weights in fieldWeights {
+            let expected = referenceMatches(matcher, query: query, weights: weights)
+            #expect(matcher.matches(corpus, against: query, weights: weights) == expected, "query '\(text)'")
+            for limit in [1, 3, 20] {
+                let top = matcher.topMatches(corpus, against: query, weights: weights, limit: limit)
+                #expect(top == Array(expected.prefix(limit)), "query '\(text)' limit \(limit)")
+            }
+        }
+    }
+}
+
+@Test func multiFieldSearchPicksBestWeightedField() {
+    let matcher = FuzzyMatcher()
+    let corpus = MultiFieldCorpus(instruments, fields: [\.symbol, \.name, \.isin])
+
+    let bySymbol = matcher.topMatches(corpus, against: matcher.prepare("aapl"), limit: 1)
+    #expect(bySymbol.first?.record == 0)
+    #expect(bySymbol.first?.field == 0)
+
+    let byISIN = matcher.topMatches(corpus, against: matcher.prepare("us0378331005"), limit: 1)
+    #expect(byISIN.first?.record == 0)
+    #expect(byISIN.first?.field == 2)
+
+    // With the name field switched off, "apple" can only match through the other fields
+    let withoutNames = matcher.matches(corpus, against: matcher.prepare("apple"), weights: [1.0, 0.0, 1.0])
+    #expect(withoutNames.allSatisfy { $0.field != 1 })
+}
+
+@Test func multiFieldTopMatchesWithZeroLimit() {
+    let corpus = MultiFieldCorpus(instruments, fields: [\.symbol, \.name])
+    #expect(FuzzyMatcher().topMatches(corpus, against: FuzzyMatcher().prepare("apple"), limit: 0).isEmpty)
+}
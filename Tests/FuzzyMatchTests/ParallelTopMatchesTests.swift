@@ -0,0 +1,86 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+@testable import FuzzyMatch
+import Testing
+
+// MARK: - Fixtures
+
+/// Enough candidates to split across several workers (minimum chunk is 2,048).
+private let parallelCandidates: [String] = {
+    let stems = [
+        "getUser", "setUser", "fetchData", "userService", "configManager",
+        "appConfig", "Bank of America", "Apple Inc.", "Café Müller", "XMLHttpRequest",
+    ]
+    var result: [String] = []
+    for i in 0..<12_000 {
+        result.append("\(stems[i % stems.count])\(i)")
+    }
+    return result
+}()
+
+// MARK: - Parallel topMatches
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman])
+func parallelTopMatchesEqualSequential(config: MatchConfig) async {
+    let matcher = FuzzyMatcher(config: config)
+    for text in ["user", "config", "bank america", "cafe", "zzzz"] {
+        let query = matcher.prepare(text)
+        let sequential = matcher.topMatches(parallelCandidates, against: query, limit: 25)
+        let parallel = await matcher.topMatches(parallelCandidates, against: query, limit: 25, concurrency: 4)
+        #expect(parallel == sequential, "query '\(text)'")
+    }
+}
+
+@Test func parallelCorpusTopMatchesEqualSequential() async {
+    let matcher = FuzzyMatcher()
+    let corpus = FuzzyCorpus(parallelCandidates)
+    for text in ["u", "user", "fetchdata", "apple"] {
+        let query = matcher.prepare(text)
+        let sequential = matcher.topMatches(corpus, against: query, limit: 50)
+        let parallel = await matcher.topMatches(corpus, against: query, limit: 50, concurrency: 6)
+        #expect(parallel == sequential, "query '\(text)'")
+    }
+}
+
+@Test func parallelTopMatchesSmallInputRunsInline() async {
+    let matcher = FuzzyMatcher()
+    let candidates = ["getUserById", "setUser", "fetchData"]
+    let query = matcher.prepare("user")
+    let parallel = await matcher.topMatches(candidates, against: query, limit: 2, concurrency: 8)
+    let sequential = matcher.topMatches(candidates, against: query, limit: 2)
+    #expect(parallel == sequential)
+}
+
+@Test func parallelTopMatchesResultsAreSortedAndBounded() async {
+    let matcher = FuzzyMatcher()
+    let query = matcher.prepare("user")
+    let results = await matcher.topMatches(parallelCandidates, against: query, limit: 7, concurrency: 3)
+    #expect(results.count == 7)
+    for i in 1..<results.count {
+        #expect(results[i - 1].match.score >= results[i].match.score)
+    }
+}
+
+@Test func parallelTopMatchesZeroLimit() async {
+    let matcher = FuzzyMatcher()
+    let query = matcher.prepare("user")
+    #expect(await matcher.topMatches(parallelCandidates, against: query, limit: 0, concurrency: 4).isEmpty)
+}
+
+@Test func workerCountRespectsMinimumChunk() {
+    #expect(FuzzyMatcher.workerCount(forCandidates: 100, concurrency: 8) == 1)
+    #expect(FuzzyMatcher.workerCount(forCandidates: 2_048 * 3, concurrency: 8) == 3)
+    #expect(FuzzyMatcher.workerCount(forCandidates: 1_000_000, concurrency: 8) == 8)
+    #expect(FuzzyMatcher.workerCount(forCandidates: 1_000_000, concurrency: 0) == 1)
+}
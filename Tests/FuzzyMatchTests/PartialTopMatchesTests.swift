@@ -0,0 +1,160 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+import FuzzyMatch
+import Testing
+
+// MARK: - Fixtures
+
+/// Many repeated stems, so there are plenty of equal scores for tie-breaking to settle.
+private let shardedCandidates: [String] = {
+    let stems = [
+        "getUser", "setUser", "fetchData", "userService", "Bank of America",
+        "Apple Inc.", "Café Müller", "XMLHttpRequest", "user", "USER",
+    ]
+    return (0..<6_000).map { i in i % 7 == 0 ? stems[i % stems.count] : "\(stems[i % stems.count])\(i % 97)" }
+}()
+
+/// Splits the candidates into `count` contiguous shards.
+private func shards(_ count: Int) -> [(corpus: FuzzyCorpus, firstOrdinal: Int)] {
+    let size = (shardedCandidates.count + count - 1) / count
+    return stride(from: 0, to: shardedCandidates.count, by: size).map { start in
+        let end = min(start + size, shardedCandidates.count)
+        return (FuzzyCorpus(shardedCandidates[start..<end]), start)
+    }
+}
+
+private func entry(_ candidate: String, _ score: Double, _ kind: MatchKind, ordinal: Int) -> PartialTopMatches.Entry {
+    PartialTopMatches.Entry(result: MatchResult(candidate: candidate, match: ScoredMatch(score: score, kind: kind)), ordinal: ordinal)
+}
+
+// MARK: - Sharded Search
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman])
+func shardedTopMatchesEqualUnsharded(config: MatchConfig) async throws {
+    let matcher = FuzzyMatcher(config: config)
+    let corpus = FuzzyCorpus(shardedCandidates)
+    for text in ["user", "u", "bank america", "cafe", "zzzz"] {
+        let query = matcher.prepare(text)
+        let unsharded = matcher.topMatches(corpus, against: query, limit: 40)
+        for shardCount in [1, 3, 7] {
+            var partials: [PartialTopMatches] = []
+            for shard in shards(shardCount) {
+                let partial = await matcher.partialTopMatches(
+                    shard.corpus,
+                    against: query,
+                    limit: 40,
+                    firstOrdinal: shard.firstOrdinal,
+                    concurrency: 2
+                )
+                #expect(partial == matcher.partialTopMatches(shard.corpus, against: query, limit: 40, firstOrdinal: shard.firstOrdinal))
+                partials.append(try PartialTopMatches(encoded: partial.encoded()))
+            }
+            let merged = PartialTopMatches.merged(partials, limit: 40)
+            let reversed = PartialTopMatches.merged(partials.reversed(), limit: 40)
+            #expect(merged.results == unsharded, "query '\(text)', \(shardCount) shards")
+            #expect(reversed == merged)
+        }
+    }
+}
+
+@Test func partialOrdinalsArePositionsInUnshardedList() {
+    let matcher = FuzzyMatcher()
+    let query = matcher.prepare("user")
+    let partial = matcher.partialTopMatches(FuzzyCorpus(["fetchData", "user", "getUser"]), against: query, firstOrdinal: 100)
+    #expect(partial.entries.map(\.ordinal) == [101, 102])
+    #expect(partial.results.map(\.candidate) == ["user", "getUser"])
+}
+
+// MARK: - Merging
+
+@Test func mergeBreaksTiesByOrdinal() {
+    let first = PartialTopMatches(limit: 3, entries: [
+        entry("b", 0.8, .prefix, ordinal: 4),
+        entry("top", 1.0, .exact, ordinal: 9),
+    ])
+    let second = PartialTopMatches(limit: 3, entries: [
+        entry("a", 0.8, .prefix, ordinal: 2),
+        entry("c", 0.8, .prefix, ordinal: 7),
+    ])
+    var merged = first
+    merged.merge(second)
+    #expect(merged.results.map(\.candidate) == ["top", "a", "b"])
+    #expect(PartialTopMatches.merged([second, first], limit: 3) == merged)
+    #expect(PartialTopMatches.merged([first, second], limit: 0).isEmpty)
+}
+
+// MARK: - Wire Encoding
+
+@Test func encodingRoundTripsExactly() throws {
+    let partial = PartialTopMatches(limit: 5, entries: [
+        entry("Café Müller", 0.1 + 0.2, .alignment, ordinal: 1 << 40),
+        entry("", 1.0, .exact, ordinal: 0),
+        entry("getUser", 0.75, .acronym, ordinal: -3),
+    ])
+    let encoded = partial.encoded()
+    let decoded = try PartialTopMatches(encoded: encoded)
+    #expect(decoded == partial)
+    #expect(decoded.entries[2].result.match.score.bitPattern == (0.1 + 0.2).bitPattern)
+    #expect(decoded.encoded() == encoded)
+    #expect(try PartialTopMatches(encoded: PartialTopMatches(limit: 7).encoded()) == PartialTopMatches(limit: 7))
+}
+
+@Test func decodingRejectsDamagedData() {
+    let partial = PartialTopMatches(limit: 2, entries: [
+        entry("user", 0.9, .prefix, ordinal: 1),
+    ])
+    let encoded = partial.encoded()
+
+    #expect(throws: PartialTopMatches.DecodingError.notPartialTopMatches) {
+        try PartialTopMatches(encoded: [UInt8](repeating: 0, count: 16))
+    }
+    #expect(throws: PartialTopMatches.DecodingError.truncated) {
+        try PartialTopMatches(encoded: Array(encoded.dropLast()))
+    }
+    #expect(throws: PartialTopMatches.DecodingError.corrupted) {
+        try PartialTopMatches(encoded: encoded + [0])
+    }
+
+    var badVersion = encoded
+    badVersion[8] = 9
+    #expect(throws: PartialTopMatches.DecodingError.unsupportedVersion(9)) {
+        try PartialTopMatches(encoded: badVersion)
+    }
+
+    // Magic (8), version (4), limit (1), count (1), score (8), then the kind byte
+    var badKind = encoded
+    badKind[22] = 0xFF
+    #expect(throws: PartialTopMatches.DecodingError.corrupted) {
+        try PartialTopMatches(encoded: badKind)
+    }
+
+    var badUTF8 = encoded
+    badUTF8[badUTF8.count - 1] = 0xFF
+    #expect(throws: PartialTopMatches.DecodingError.corrupted) {
+        try PartialTopMatches(encoded: badUTF8)
+    }
+}
+
+@Test func decodingWideOrdinalsDependsOnIntWidth() throws {
+    var encoded = PartialTopMatches(limit: 1, entries: [entry("user", 0.9, .prefix, ordinal: 0)]).encoded()
+    // Replace the one-byte ordinal after magic, version, limit, count, score and kind with 2^40
+    encoded.replaceSubrange(23...23, with: [0x80, 0x80, 0x80, 0x80, 0x80, 0x20])
+    if Int.bitWidth == 64 {
+        #expect(Int64(try PartialTopMatches(encoded: encoded).entries[0].ordinal) == Int64(1) << 40)
+    } else {
+        #expect(throws: PartialTopMatches.DecodingError.corrupted) {
+            try PartialTopMatches(encoded: encoded)
+        }
+    }
+}
@@ -431,3 +431,234 @@ import Testing
     let result = matcher.score("Åäö Test", against: query, buffer: &buffer)
     #expect(result != nil)
 }
+
+// MARK: - Column Prefilter Sweep
+
+/// Scalar reference for `sweepPrefilters`.
+private func scalarSurvivors(
+    masks: [UInt64],
+    lengths: [UInt32],
+    queryMask: UInt64,
+    tolerance: Int,
+    minLength: Int
+) -> [UInt32] {
+    var result: [UInt32] = []
+    for i in 0..<masks.count
+    where passesCharBitmask(queryMask: queryMask, candidateMask: masks[i], maxEditDistance: tolerance)
+        && Int(lengths[i]) >= minLength {
+        result.append(UInt32(i))
+    }
+    return result
+}
+
+@Test func prefilterSweepMatchesScalarPredicates() {
+    // Deterministic pseudo-random columns; counts exercise full blocks and the scalar tail
+    var state: UInt64 = 0x9E37_79B9_7F4A_7C15
+    func next() -> UInt64 {
+        state ^= state << 13
+        state ^= state >> 7
+        state ^= state << 17
+        return state
+    }
+
+    for count in [0, 1, 7, 8, 9, 31, 64, 1_003] {
+        var masks: [UInt64] = []
+        var lengths: [UInt32] = []
+        for _ in 0..<count {
+            masks.append(next() & next())
+            lengths.append(UInt32(next() % 40))
+        }
+        for (queryMask, tolerance, minLength) in [
+            (UInt64(0b1011), 0, 0),
+            (UInt64(0b1011_0110), 1, 5),
+            (next() & next() & next(), 2, 12),
+            (UInt64(0), 0, 39),
+        ] {
+            var survivors: [UInt32] = [42]
+            sweepPrefilters(
+                charBitmasks: masks,
+                lengths: lengths,
+                queryMask: queryMask,
+                maxMissingCharacters: tolerance,
+                minCandidateLength: minLength,
+                into: &survivors
+            )
+            let expected = scalarSurvivors(
+                masks: masks,
+                lengths: lengths,
+                queryMask: queryMask,
+                tolerance: tolerance,
+                minLength: minLength
+            )
+            #expect(survivors == expected, "count \(count) tolerance \(tolerance) minLength \(minLength)")
+        }
+    }
+}
+
+@Test func corpusPrefilterSurvivorsCoverEveryMatch() {
+    let candidates = [
+        "getUserById", "setUser", "fetchData", "userService", "Café Müller",
+        "XMLHttpRequest", "u", "", "configManager", "appConfig", "database",
+    ]
+    let corpus = FuzzyCorpus(candidates)
+    for config in [MatchConfig.editDistance, MatchConfig.smithWaterman] {
+        let matcher = FuzzyMatcher(config: config)
+        var buffer = matcher.makeBuffer()
+        for text in ["", "u", "usr", "config", "cafe", "xmlhttp"] {
+            let query = matcher.prepare(text)
+            var survivors: [UInt32] = []
+            corpus.collectPrefilterSurvivors(for: query, into: &survivors)
+            for (index, candidate) in candidates.enumerated()
+            where matcher.score(candidate, against: query, buffer: &buffer) != nil {
+                #expect(survivors.contains(UInt32(index)), "query '\(text)' candidate '\(candidate)'")
+            }
+        }
+    }
+}
+
+// MARK: - Length Buckets
+
+@Test func lengthOrderedSweepMatchesScalarPredicates() {
+    var state: UInt64 = 0xD1B5_4A32_D192_ED03
+    func next() -> UInt64 {
+        state ^= state << 13
+        state ^= state >> 7
+        state ^= state << 17
+        return state
+    }
+
+    for count in [0, 1, 7, 8, 9, 31, 64, 65, 1_003] {
+        var masks: [UInt64] = []
+        var lengths: [UInt32] = []
+        for _ in 0..<count {
+            masks.append(next() & next())
+            lengths.append(UInt32(next() % 40))
+        }
+        let order = lengths.indices.sorted { lengths[$0] != lengths[$1] ? lengths[$0] < lengths[$1] : $0 < $1 }
+        let orderedMasks = order.map { masks[$0] }
+        for (queryMask, tolerance, minLength) in [
+            (UInt64(0b1011), 0, 0),
+            (UInt64(0b1011_0110), 1, 5),
+            (next() & next() & next(), 2, 12),
+            (UInt64(0), 0, 39),
+            (UInt64(0), 0, 40),
+        ] {
+            var survivors: [UInt32] = [42]
+            sweepLengthOrderedPrefilters(
+                charBitmasks: orderedMasks,
+                order: order.map { UInt32($0) },
+                from: order.firstIndex { Int(lengths[$0]) >= minLength } ?? count,
+                queryMask: queryMask,
+                maxMissingCharacters: tolerance,
+                into: &survivors
+            )
+            let expected = scalarSurvivors(
+                masks: masks,
+                lengths: lengths,
+                queryMask: queryMask,
+                tolerance: tolerance,
+                minLength: minLength
+            )
+            #expect(survivors == expected, "count \(count) tolerance \(tolerance) minLength \(minLength)")
+        }
+    }
+}
+
+@Test func corpusLengthBucketsAreSortedAndComplete() {
+    let candidates = ["ccc", "a", "", "bb", "ddd", "e", "Café", "ffff", "gg"]
+    let corpus = FuzzyCorpus(candidates)
+
+    #expect(corpus.bucketLengths == [0, 1, 2, 3, 4, 5])
+    #expect(corpus.bucketStarts == [0, 1, 3, 5, 7, 8, 9])
+    #expect(corpus.lengthOrder == [2, 1, 5, 3, 8, 0, 4, 7, 6])
+    #expect(corpus.lengthOrderedCharBitmasks == corpus.lengthOrder.map { corpus.charBitmasks[Int($0)] })
+    #expect(corpus.lengthOrderStart(minLength: 0) == 0)
+    #expect(corpus.lengthOrderStart(minLength: 3) == 5)
+    #expect(corpus.lengthOrderStart(minLength: 6) == candidates.count)
+    #expect(FuzzyCorpus([String]()).lengthOrderStart(minLength: 1) == 0)
+}
+
+@Test(arguments: [MatchConfig.editDistance, MatchConfig.smithWaterman])
+func bucketedSurvivorsMatchFlatSweep(config: MatchConfig) {
+    // Mostly short candidates so longer queries skip most buckets
+    var candidates = ["a", "ab", "u", "us", "usr", "id", "x1", "db", "io", "ui", "k", "v"]
+    candidates += ["getUserById", "userService", "fetchUserData", "Café Müller", "XMLHttpRequest", "user_manager"]
+    let corpus = FuzzyCorpus(candidates)
+    let matcher = FuzzyMatcher(config: config)
+
+    for text in ["us", "usr", "user", "userserv", "xmlhttp", "cafe", "getuserbyid", "zzzz"] {
+        let query = matcher.prepare(text)
+        var survivors: [UInt32] = []
+        corpus.collectPrefilterSurvivors(for: query, into: &survivors)
+
+        var expected: [UInt32] = []
+        let (tolerance, minLength) = query.monotonePrefilterBounds
+        sweepPrefilters(
+            charBitmasks: corpus.charBitmasks,
+            lengths: corpus.lengths,
+            queryMask: query.charBitmask,
+            maxMissingCharacters: tolerance,
+            minCandidateLength: minLength,
+            into: &expected
+        )
+        #expect(survivors == expected, "query '\(text)'")
+        #expect(matcher.topMatches(corpus, against: query, limit: 5) == matcher.topMatches(candidates, against: query, limit: 5))
+    }
+}
+
+// MARK: - Vectorized Lowercasing and Bitmask
+
+/// Lowercases with a destination sized like the scoring buffers.
+private func lowercased(_ bytes: [UInt8], isASCII: Bool) -> [UInt8] {
+    var destination = [UInt8](repeating: 0, count: bytes.count)
+    let length = lowercaseUTF8(from: bytes.span, into: &destination, isASCII: isASCII)
+    return Array(destination[0..<length])
+}
+
+/// Mixed-case ASCII with digits, underscore and the bytes next to each letter range.
+private func asciiText(length: Int, offset: Int = 0) -> [UInt8] {
+    let alphabet = Array("AbZz09_-@[`{ ~Mq".utf8)
+    return (0..<length).map { alphabet[($0 + offset) % alphabet.count] }
+}
+
+@Test func lowercaseASCIIBlockMatchesScalarForEveryByte() {
+    for start in stride(from: 0, to: 256, by: 16) {
+        let bytes = (start..<start + 16).map { UInt8($0) }
+        let block = bytes.withUnsafeBytes { $0.loadUnaligned(as: SIMD16<UInt8>.self) }
+        let lowered = lowercaseASCIIBlock(block)
+        for lane in 0..<16 {
+            #expect(lowered[lane] == lowercaseASCII(bytes[lane]), "byte \(bytes[lane])")
+        }
+    }
+}
+
+@Test func blockLowercasingMatchesScalarForASCII() {
+    for length in 0..<70 {
+        let bytes = asciiText(length: length, offset: length)
+        let expected = Array(String(decoding: bytes, as: UTF8.self).lowercased().utf8)
+        #expect(lowercased(bytes, isASCII: true) == expected, "length \(length)")
+        #expect(lowercased(bytes, isASCII: false) == expected, "length \(length)")
+        let (mask, isASCII) = computeCharBitmaskWithASCIICheck(bytes.span)
+        #expect(isASCII)
+        #expect(mask == computeCharBitmaskCaseInsensitive(bytes.span), "length \(length)")
+    }
+}
+
+@Test func blockLowercasingFallsBackAroundMultiByteCharacters() {
+    // Latin-1 folded to ASCII, Latin-1 kept, Greek, Cyrillic, and a combining mark
+    let pieces = ["É", "Æ", "Σ", "Ж", "\u{0301}"].map { Array($0.utf8) }
+    for piece in pieces {
+        for position in [0, 1, 14, 15, 16, 17, 31, 32, 40] {
+            let prefix = asciiText(length: position)
+            let suffix = asciiText(length: 43 - position, offset: 5)
+            let bytes = prefix + piece + suffix
+            let expected = lowercased(prefix, isASCII: true) + lowercased(piece, isASCII: false)
+                + lowercased(suffix, isASCII: true)
+            #expect(lowercased(bytes, isASCII: false) == expected, "piece \(piece) at \(position)")
+
+            let (mask, isASCII) = computeCharBitmaskWithASCIICheck(bytes.span)
+            #expect(!isASCII)
+            #expect(mask == computeCharBitmaskCaseInsensitive(bytes.span), "piece \(piece) at \(position)")
+        }
+    }
+}
@@ -0,0 +1,109 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+@testable import FuzzyMatch
+import Testing
+
+// MARK: - Fixtures
+
+private let boundCandidates: [String] = [
+    "getUserById", "get_user_name", "getUserByIdentifier", "UserManager", "user_manager",
+    "setUser", "fetchUserData", "XMLHttpRequest", "International Business Machines",
+    "International Consolidated Airlines Group", "Goldman Sachs Group", "Bank of America",
+    "Café Müller", "usr", "user", "users", "uesr", "the_quick_brown_fox_jumps_over_the_lazy_dog",
+    "src/FuzzyMatch/FuzzyMatcher+Corpus.swift", "abcdefghijklmnopqrstuvwxyz", "a-b-c-d-e-f",
+    String(repeating: "user_", count: 20) + "manager", "userManagerFactoryProviderImpl",
+]
+
+private let boundQueries: [String] = [
+    "user", "usr", "uesr", "getuser", "gubi", "usermanager", "usermanagr", "xmlhttp",
+    "international", "internatinal", "goldman sachs", "bank america", "abc", "fox lazy",
+    "managerfactory", "ibm", "us",
+]
+
+private let boundConfigs: [EditDistanceConfig] = [
+    EditDistanceConfig(),
+    EditDistanceConfig(wordBoundaryBonus: 0, consecutiveBonus: 0, gapPenalty: .none, firstMatchBonus: 0),
+    EditDistanceConfig(gapPenalty: .linear(perCharacter: 0.02), lengthPenalty: 0.01),
+    EditDistanceConfig(maxEditDistance: 3, prefixWeight: 3.0, substringWeight: 0.8, acronymWeight: 1.2),
+]
+
+// MARK: - Bound
+
+@Test func edScoreUpperBoundIsNeverBelowScore() {
+    let corpus = FuzzyCorpus(boundCandidates)
+    for edConfig in boundConfigs {
+        let matcher = FuzzyMatcher(config: MatchConfig(minScore: 0.0, algorithm: .editDistance(edConfig)))
+        var buffer = matcher.makeBuffer()
+
+        for text in boundQueries {
+            let query = matcher.prepare(text)
+            for index in corpus.indices {
+                guard let match = matcher.score(corpus, at: index, against: query, buffer: &buffer),
+                    match.kind != .exact else {
+                    continue
+                }
+                var state = EditDistanceState(maxQueryLength: query.lowercased.count)
+                let bound = matcher.edScoreUpperBound(
+                    querySpan: query.lowercased.span,
+                    candidateSpan: corpus.lowercased.span.extracting(corpus.lowercasedRange(at: index)),
+                    boundaryMask: corpus.boundaryMasks[index],
+                    query: query,
+                    edConfig: edConfig,
+                    editDistanceState: &state
+                )
+                #expect(bound >= match.score, "query '\(text)' candidate '\(corpus[index])'")
+            }
+        }
+    }
+}
+
+@Test func scoreFloorOnlyRejectsCandidatesBelowIt() {
+    let matcher = FuzzyMatcher()
+    var buffer = matcher.makeBuffer()
+    for text in boundQueries {
+        let query = matcher.prepare(text)
+        for candidate in boundCandidates {
+            let unbounded = matcher.score(candidate, against: query, buffer: &buffer)
+            for floor in [0.0, 0.5, 0.8, 0.9, 0.95, 1.0] {
+                let bounded = matcher.score(candidate, against: query, buffer: &buffer, scoreFloor: floor)
+                if let bounded {
+                    #expect(bounded == unbounded)
+                } else if let unbounded {
+                    #expect(unbounded.score < floor, "query '\(text)' candidate '\(candidate)' floor \(floor)")
+                }
+            }
+        }
+    }
+}
+
+// MARK: - Top-K Equivalence
+
+@Test(arguments: [1, 3, 10])
+func boundedTopMatchesMatchSortedMatches(limit: Int) {
+    let matcher = FuzzyMatcher()
+    let corpus = FuzzyCorpus(boundCandidates)
+    for text in boundQueries {
+        let query = matcher.prepare(text)
+        var buffer = matcher.makeBuffer()
+        let scored = boundCandidates.enumerated().compactMap { index, candidate in
+            matcher.score(candidate, against: query, buffer: &buffer).map { (index, MatchResult(candidate: candidate, match: $0)) }
+        }
+        let expected = scored
+            .sorted { $0.1.match.score != $1.1.match.score ? $0.1.match.score > $1.1.match.score : $0.0 < $1.0 }
+            .prefix(limit)
+            .map(\.1)
+        #expect(matcher.topMatches(boundCandidates, against: query, limit: limit) == expected, "query '\(text)'")
+        #expect(matcher.topMatches(corpus, against: query, limit: limit) == expected, "query '\(text)'")
+    }
+}
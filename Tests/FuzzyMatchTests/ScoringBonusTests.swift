@@ -528,6 +528,42 @@ import Testing
     #expect(abs(bonus - (-0.04)) < 0.001)
 }
 
+@Test func linearGapPenaltyScalesWithGapLength() {
+    // Gaps of 1 and 3 characters, charged per character
+    let positions = [0, 2, 6]
+    let candidate = Array("aXbXXXc".utf8)
+    let config = EditDistanceConfig(
+        wordBoundaryBonus: 0.0,
+        consecutiveBonus: 0.0,
+        gapPenalty: .linear(perCharacter: 0.01),
+        firstMatchBonus: 0.0
+    )
+
+    let bonus = calculateBonuses(
+        matchPositions: positions,
+        positionCount: positions.count,
+        candidateBytes: candidate.span,
+        boundaryMask: 0b1,
+        config: config
+    )
+
+    #expect(abs(bonus - (-0.04)) < 0.001)
+}
+
+@Test func preparedQueryResolvesAlignmentNeeds() {
+    let plain = EditDistanceConfig(wordBoundaryBonus: 0.0, consecutiveBonus: 0.0, gapPenalty: .none, firstMatchBonus: 0.0)
+    #expect(!FuzzyMatcher(config: MatchConfig(algorithm: .editDistance(plain))).prepare("user").needsAlignment)
+    #expect(FuzzyMatcher().prepare("user").needsAlignment)
+    #expect(!FuzzyMatcher().prepare("user").hasNegativeGapPenalty)
+
+    var rewardingGaps = plain
+    rewardingGaps.gapPenalty = .affine(open: -0.01, extend: 0.0)
+    let query = FuzzyMatcher(config: MatchConfig(algorithm: .editDistance(rewardingGaps))).prepare("user")
+    #expect(query.needsAlignment)
+    #expect(query.hasNegativeGapPenalty)
+    #expect(!FuzzyMatcher(config: .smithWaterman).prepare("user").needsAlignment)
+}
+
 @Test func affineGapVsLinearGap() {
     // Compare affine and linear gap models for a gap of 3
     let positions = [0, 4]  // Gap of 3
@@ -0,0 +1,171 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+import FuzzyMatch
+import Testing
+
+// MARK: - Scoring Statistics Tests
+
+private let statisticsCandidates = [
+    "getUserById", "setUser", "fetchData", "user", "xyz", "u", "userNameFormatter",
+    "UserService", "deleteUser", "configuration", "usr", "abcdefghijklmnop"
+]
+
+@Test func statisticsDoNotChangeScores() {
+    for config in [MatchConfig.editDistance, MatchConfig.smithWaterman] {
+        let matcher = FuzzyMatcher(config: config)
+        let query = matcher.prepare("user")
+        var plain = matcher.makeBuffer()
+        var timed = matcher.makeBuffer()
+        timed.statistics.timingSampleInterval = 1
+
+        for candidate in statisticsCandidates {
+            #expect(matcher.score(candidate, against: query, buffer: &plain) == matcher.score(candidate, against: query, buffer: &timed))
+        }
+    }
+}
+
+#if ScoringStatistics
+
+@Test func statisticsCountEditDistanceStages() {
+    let matcher = FuzzyMatcher()
+    let query = matcher.prepare("user")
+    var buffer = matcher.makeBuffer()
+
+    var expectedMatches = 0
+    for candidate in statisticsCandidates where matcher.score(candidate, against: query, buffer: &buffer) != nil {
+        expectedMatches += 1
+    }
+
+    let statistics = buffer.statistics
+    #expect(statistics.candidates == statisticsCandidates.count)
+    #expect(statistics.matches == expectedMatches)
+
+    // Every stage passes on what the next one receives
+    #expect(statistics[.lengthBounds].entered == statisticsCandidates.count)
+    #expect(statistics[.bitmask].entered == statistics[.lengthBounds].passed)
+    #expect(statistics[.lowercase].entered == statistics[.bitmask].passed)
+    #expect(statistics[.trigram].entered == statistics[.lowercase].passed)
+    #expect(statistics[.exactMatch].entered == statistics[.trigram].passed)
+    #expect(statistics[.editDistance].entered == statistics[.exactMatch].passed)
+    #expect(statistics[.exactMatch].rejected + statistics[.editDistance].passed == expectedMatches)
+    #expect(statistics[.lengthBounds].rejected > 0)
+    #expect(statistics[.bitmask].rejected > 0)
+    #expect(statistics[.smithWaterman].entered == 0)
+    #expect(statistics[.scoreBound].entered == 0)
+    #expect(statistics[.lengthBounds].timedCount == 0)
+}
+
+@Test func statisticsCountSmithWatermanStages() {
+    let matcher = FuzzyMatcher(config: .smithWaterman)
+    let query = matcher.prepare("user")
+    var buffer = matcher.makeBuffer()
+
+    var expectedMatches = 0
+    for candidate in statisticsCandidates where matcher.score(candidate, against: query, buffer: &buffer) != nil {
+        expectedMatches += 1
+    }
+
+    let statistics = buffer.statistics
+    #expect(statistics.matches == expectedMatches)
+    #expect(statistics[.smithWaterman].entered == statistics[.exactMatch].passed)
+    #expect(statistics[.exactMatch].rejected + statistics[.smithWaterman].passed == expectedMatches)
+    #expect(statistics[.editDistance].entered == 0)
+    #expect(statistics[.trigram].entered == 0)
+}
+
+@Test func corpusAndBatchPathsCountLikeStringScoring() {
+    for config in [MatchConfig.editDistance, MatchConfig.smithWaterman] {
+        let matcher = FuzzyMatcher(config: config)
+        let query = matcher.prepare("user")
+        let corpus = FuzzyCorpus(statisticsCandidates)
+
+        var strings = matcher.makeBuffer()
+        var indexed = matcher.makeBuffer()
+        for index in corpus.indices {
+            _ = matcher.score(statisticsCandidates[index], against: query, buffer: &strings)
+            _ = matcher.score(corpus, at: index, against: query, buffer: &indexed)
+        }
+        #expect(indexed.statistics.candidates == strings.statistics.candidates)
+        #expect(indexed.statistics.matches == strings.statistics.matches)
+        #expect(indexed.statistics[.bitmask].rejected == strings.statistics[.bitmask].rejected)
+
+        var batched = matcher.makeBuffer()
+        _ = matcher.scoreBatch(statisticsCandidates.span, against: query, buffer: &batched)
+        #expect(batched.statistics.candidates == strings.statistics.candidates)
+        #expect(batched.statistics.matches == strings.statistics.matches)
+    }
+}
+
+@Test func statisticsSampleTimings() {
+    let matcher = FuzzyMatcher()
+    let query = matcher.prepare("userservice")
+    var buffer = matcher.makeBuffer()
+    buffer.statistics.timingSampleInterval = 2
+
+    for _ in 0..<10 {
+        _ = matcher.score("UserServiceFactory", against: query, buffer: &buffer)
+    }
+
+    let statistics = buffer.statistics
+    #expect(statistics[.lengthBounds].entered == 10)
+    #expect(statistics[.lengthBounds].timedCount == 5)
+    #expect(statistics[.editDistance].timedCount == 5)
+    #expect(statistics[.alignment].entered > 0)
+    #expect(statistics[.editDistance].meanNanoseconds != nil)
+}
+
+@Test func statisticsResetAndMerge() {
+    let matcher = FuzzyMatcher()
+    let query = matcher.prepare("user")
+    var first = matcher.makeBuffer()
+    var second = matcher.makeBuffer()
+    first.statistics.timingSampleInterval = 8
+
+    for candidate in statisticsCandidates {
+        _ = matcher.score(candidate, against: query, buffer: &first)
+        _ = matcher.score(candidate, against: query, buffer: &second)
+    }
+
+    var merged = first.statistics
+    merged.merge(second.statistics)
+    #expect(merged.candidates == 2 * statisticsCandidates.count)
+    #expect(merged[.bitmask].passed == 2 * second.statistics[.bitmask].passed)
+
+    first.statistics.reset()
+    #expect(first.statistics.candidates == 0)
+    #expect(first.statistics[.lengthBounds].entered == 0)
+    #expect(first.statistics.timingSampleInterval == 8)
+}
+
+#else
+
+@Test func statisticsStayEmptyWhenCompiledOut() {
+    let matcher = FuzzyMatcher()
+    let query = matcher.prepare("user")
+    var buffer = matcher.makeBuffer()
+    buffer.statistics.timingSampleInterval = 1
+
+    for candidate in statisticsCandidates {
+        _ = matcher.score(candidate, against: query, buffer: &buffer)
+    }
+
+    #expect(!ScoringStatistics.isEnabled)
+    #expect(buffer.statistics.candidates == 0)
+    #expect(buffer.statistics.matches == 0)
+    for stage in ScoringStatistics.Stage.allCases {
+        #expect(buffer.statistics[stage] == ScoringStatistics.StageCounts())
+    }
+}
+
+#endif
@@ -1334,3 +1334,53 @@ import Testing
     #expect(exact != nil, "Exact match should pass any minScore threshold")
     #expect(exact?.score == 1.0)
 }
+
+// MARK: - Vectorized Kernel
+
+@Test func swSIMDKernelMatchesScalarKernel() {
+    let configs = [
+        SmithWatermanConfig.default,
+        SmithWatermanConfig(penaltyGapStart: 0, penaltyGapExtend: 0, bonusFirstCharMultiplier: 1),
+    ]
+    let bonusValues: [Int32] = [0, 4, 5, 8, 9, 10]
+    var seed: UInt64 = 0xC0FFEE
+    func next() -> Int {
+        seed = seed &* 6_364_136_223_846_793_005 &+ 1_442_695_040_888_963_407
+        return Int(seed >> 33)
+    }
+
+    var state = SmithWatermanState()
+    for iteration in 0..<20_000 {
+        let config = configs[iteration % configs.count]
+        let alphabet = 1 + iteration % 4
+        let query = (0..<(1 + next() % 40)).map { _ in UInt8(0x61 + next() % alphabet) }
+        let candidate = (0..<(1 + next() % 60)).map { _ in UInt8(0x61 + next() % alphabet) }
+        let bonus = candidate.indices.map { _ in bonusValues[next() % bonusValues.count] }
+
+        let scalar = smithWatermanScoreScalar(
+            query: query.span, candidate: candidate.span, bonus: bonus.span, state: &state, config: config
+        )
+        let simd = smithWatermanScoreSIMD(
+            query: query.span, candidate: candidate.span, bonus: bonus.span, state: &state, config: config
+        )
+        #expect(scalar == simd, "query \(query) candidate \(candidate)")
+    }
+}
+
+@Test func swSIMDKernelHandlesLaneBoundaries() {
+    // Query lengths around multiples of 8 exercise the padding lanes
+    var state = SmithWatermanState()
+    for length in [7, 8, 9, 15, 16, 17, 33] {
+        let query = (0..<length).map { UInt8(0x61 + $0 % 26) }
+        let candidate = [UInt8](repeating: 0x7A, count: 3) + query + [0x7A]
+        let bonus = [Int32](repeating: 0, count: candidate.count)
+        let scalar = smithWatermanScoreScalar(
+            query: query.span, candidate: candidate.span, bonus: bonus.span, state: &state, config: .default
+        )
+        let simd = smithWatermanScoreSIMD(
+            query: query.span, candidate: candidate.span, bonus: bonus.span, state: &state, config: .default
+        )
+        #expect(simd == scalar, "length \(length)")
+        #expect(simd > 0)
+    }
+}
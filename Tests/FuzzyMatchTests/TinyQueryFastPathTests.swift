@@ -36,7 +36,8 @@ struct TinyQueryFastPathTests {
             editDistanceState: &buffer.editDistanceState,
             matchPositions: &buffer.matchPositions,
             alignmentState: &buffer.alignmentState,
-            wordInitials: &buffer.wordInitials
+            wordInitials: &buffer.wordInitials,
+            statistics: &buffer.statistics
         )
     }
 
@@ -0,0 +1,147 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+@testable import FuzzyMatch
+import Testing
+
+// MARK: - Helpers
+
+/// Reference top-K: stable sort by score descending, then take the prefix.
+private func referenceTopK(_ scores: [Double], limit: Int) -> [Int] {
+    let ranked = scores.indices.sorted { lhs, rhs in
+        scores[lhs] != scores[rhs] ? scores[lhs] > scores[rhs] : lhs < rhs
+    }
+    return Array(ranked.prefix(limit))
+}
+
+/// Deterministic pseudo-random scores with many ties.
+private func generatedScores(count: Int, seed: UInt64) -> [Double] {
+    var state = seed
+    var scores: [Double] = []
+    scores.reserveCapacity(count)
+    for _ in 0..<count {
+        state = state &* 6_364_136_223_846_793_005 &+ 1_442_695_040_888_963_407
+        scores.append(Double((state >> 33) % 50) / 50.0)
+    }
+    return scores
+}
+
+// MARK: - Basic Behavior
+
+@Test func topKCollectorKeepsHighestScores() {
+    var top = TopKCollector<String>(limit: 3)
+    top.insert("a", score: 0.2)
+    top.insert("b", score: 0.9)
+    top.insert("c", score: 0.5)
+    top.insert("d", score: 0.7)
+    top.insert("e", score: 0.1)
+    #expect(top.count == 3)
+    #expect(top.isFull)
+    #expect(top.sortedElements() == ["b", "d", "c"])
+    #expect(top.minimumScore == 0.5)
+}
+
+@Test func topKCollectorUnderfilled() {
+    var top = TopKCollector<Int>(limit: 10)
+    top.insert(1, score: 0.3)
+    top.insert(2, score: 0.6)
+    #expect(top.count == 2)
+    #expect(!top.isFull)
+    #expect(top.minimumScore == nil)
+    #expect(top.sortedElements() == [2, 1])
+}
+
+@Test func topKCollectorZeroLimit() {
+    var top = TopKCollector<Int>(limit: 0)
+    #expect(!top.insert(1, score: 1.0))
+    #expect(!top.wouldAccept(score: 1.0, ordinal: 0))
+    #expect(top.isEmpty)
+    #expect(top.sortedElements().isEmpty)
+
+    let negative = TopKCollector<Int>(limit: -5)
+    #expect(negative.limit == 0)
+}
+
+// MARK: - Tie-Breaking
+
+@Test func topKCollectorBreaksTiesByInsertionOrder() {
+    var top = TopKCollector<String>(limit: 2)
+    top.insert("first", score: 0.5)
+    top.insert("second", score: 0.5)
+    top.insert("third", score: 0.5)
+    #expect(top.sortedElements() == ["first", "second"])
+}
+
+@Test func topKCollectorBreaksTiesByExplicitOrdinal() {
+    var top = TopKCollector<String>(limit: 2)
+    top.insert("late", score: 0.5, ordinal: 30)
+    top.insert("early", score: 0.5, ordinal: 10)
+    top.insert("middle", score: 0.5, ordinal: 20)
+    #expect(top.sortedElements() == ["early", "middle"])
+    let scored = top.sortedScoredElements()
+    #expect(scored.map(\.ordinal) == [10, 20])
+    #expect(scored.map(\.score) == [0.5, 0.5])
+}
+
+@Test func topKCollectorWouldAccept() {
+    var top = TopKCollector<Int>(limit: 2)
+    #expect(top.wouldAccept(score: 0.0, ordinal: 0))
+    top.insert(0, score: 0.4, ordinal: 5)
+    top.insert(1, score: 0.8, ordinal: 6)
+    #expect(!top.wouldAccept(score: 0.3, ordinal: 0))
+    #expect(top.wouldAccept(score: 0.4, ordinal: 4))
+    #expect(!top.wouldAccept(score: 0.4, ordinal: 7))
+    #expect(top.wouldAccept(score: 0.5, ordinal: 100))
+}
+
+// MARK: - Equivalence
+
+@Test(arguments: [1, 7, 100, 5_000])
+func topKCollectorMatchesSortReference(limit: Int) {
+    let scores = generatedScores(count: 2_000, seed: UInt64(limit))
+    var top = TopKCollector<Int>(limit: limit)
+    for (index, score) in scores.enumerated() {
+        top.insert(index, score: score)
+    }
+    #expect(top.sortedElements() == referenceTopK(scores, limit: limit))
+}
+
+@Test func topKCollectorMergeMatchesSequential() {
+    let scores = generatedScores(count: 3_000, seed: 42)
+    var sequential = TopKCollector<Int>(limit: 64)
+    for (index, score) in scores.enumerated() {
+        sequential.insert(index, score: score, ordinal: index)
+    }
+
+    // Interleaved partitions, merged in reverse order
+    var partials = (0..<4).map { _ in TopKCollector<Int>(limit: 64) }
+    for (index, score) in scores.enumerated() {
+        partials[index % 4].insert(index, score: score, ordinal: index)
+    }
+    var merged = TopKCollector<Int>(limit: 64)
+    for partial in partials.reversed() {
+        merged.merge(partial)
+    }
+
+    #expect(merged.sortedElements() == sequential.sortedElements())
+    #expect(merged.sortedElements() == referenceTopK(scores, limit: 64))
+}
+
+// MARK: - Convenience API Integration
+
+@Test func topMatchesTieOrderFollowsInputOrder() {
+    let matcher = FuzzyMatcher()
+    let candidates = ["user1", "user2", "user3", "user4"]
+    let results = matcher.topMatches(candidates, against: matcher.prepare("user"), limit: 2)
+    #expect(results.map(\.candidate) == ["user1", "user2"])
+}
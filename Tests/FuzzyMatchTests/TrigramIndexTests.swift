@@ -0,0 +1,101 @@
+// ===----------------------------------------------------------------------===//
+//
+// This source file is part of the FuzzyMatch open source project
+//
+// Copyright (c) 2026 Ordo One, AB. and the FuzzyMatch project authors
+// Licensed under Apache License v2.0
+//
+// See LICENSE for license information
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// ===----------------------------------------------------------------------===//
+
+@testable import FuzzyMatch
+import Testing
+
+// MARK: - Fixtures
+
+private let indexCandidates: [String] = [
+    "International Consolidated Airlines Group", "International Business Machines",
+    "Goldman Sachs Group", "Goldman Sachs BDC", "Bank of America", "Bank of Montreal",
+    "getUserById", "get_user_name", "UserManager", "XMLHttpRequest",
+    "Café Müller", "Crème Brûlée", "aaaaaaaaaaaa", "abcabcabcabc", "ab", "", "a b c d",
+    "the_quick_brown_fox_jumps_over_the_lazy_dog_and_keeps_running_far_away_from_home",
+]
+
+private let indexQueries: [String] = [
+    "international", "internatinal", "goldman sachs", "goldamn", "bank of america",
+    "getuserbyid", "usermanager", "xmlhttprequest", "cafe muller", "aaaaaaaa",
+    "abcabc", "lazy dog running", "user", "zzzzzzzz",
+]
+
+// MARK: - Postings
+
+@Test func trigramIndexCountsMatchCountSharedTrigrams() throws {
+    let corpus = FuzzyCorpus(indexCandidates, buildTrigramIndex: true)
+    let index = try #require(corpus.trigramIndex)
+    let matcher = FuzzyMatcher()
+
+    for text in indexQueries {
+        let query = matcher.prepare(text)
+        guard !query.trigrams.isEmpty else { continue }
+        for minShared in 1...query.trigrams.count {
+            var survivors: [UInt32] = []
+            index.collectCandidates(sharingAtLeast: minShared, of: query.trigrams, into: &survivors)
+
+            let expected = corpus.indices.filter { candidate in
+                let span = corpus.lowercased.span.extracting(corpus.lowercasedRange(at: candidate))
+                return countSharedTrigrams(candidateBytes: span, queryTrigrams: query.trigrams) >= minShared
+            }
+            #expect(survivors.map { Int($0) } == expected, "query '\(text)' minShared \(minShared)")
+        }
+    }
+}
+
+@Test func corpusWithoutIndexHasNoIndex() {
+    #expect(!FuzzyCorpus(indexCandidates).hasTrigramIndex)
+    #expect(FuzzyCorpus(indexCandidates, buildTrigramIndex: true).hasTrigramIndex)
+}
+
+@Test func emptyCorpusWithTrigramIndex() {
+    let corpus = FuzzyCorpus([String](), buildTrigramIndex: true)
+    let matcher = FuzzyMatcher()
+    #expect(matcher.topMatches(corpus, against: "international").isEmpty)
+}
+
+// MARK: - Equivalence
+
+@Test func indexedCorpusMatchesUnindexedCorpus() {
+    let plain = FuzzyCorpus(indexCandidates)
+    let indexed = FuzzyCorpus(indexCandidates, buildTrigramIndex: true)
+    let matcher = FuzzyMatcher()
+
+    for text in indexQueries {
+        let query = matcher.prepare(text)
+        #expect(matcher.matches(indexed, against: query) == matcher.matches(plain, against: query), "query '\(text)'")
+        #expect(
+            matcher.topMatches(indexed, against: query, limit: 5) == matcher.topMatches(plain, against: query, limit: 5),
+            "query '\(text)'"
+        )
+    }
+}
+
+@Test func indexedSurvivorsCoverEveryMatch() {
+    let corpus = FuzzyCorpus(indexCandidates, buildTrigramIndex: true)
+    let matcher = FuzzyMatcher()
+    var buffer = matcher.makeBuffer()
+
+    for text in indexQueries {
+        let query = matcher.prepare(text)
+        var survivors: [UInt32] = []
+        corpus.collectPrefilterSurvivors(for: query, into: &survivors)
+        let surviving = Set(survivors.map { Int($0) })
+        #expect(survivors == survivors.sorted())
+
+        for (index, candidate) in indexCandidates.enumerated()
+        where matcher.score(candidate, against: query, buffer: &buffer) != nil {
+            #expect(surviving.contains(index), "query '\(text)' dropped '\(candidate)'")
+        }
+    }
+}
@@ -311,6 +311,65 @@ import Testing
     #expect(passes)
 }
 
+// MARK: - Trigram Table
+
+@Test func trigramTableContainsExactlyTheSetMembers() {
+    let texts = ["", "abcd", "hello world", "internationalconsolidatedairlines", "café müller", String(repeating: "xyz", count: 40)]
+    for text in texts {
+        let trigrams = computeTrigrams(Array(text.utf8))
+        let table = TrigramTable(trigrams)
+        #expect(table.count == trigrams.count)
+        for hash in trigrams {
+            #expect(table.contains(hash), "'\(text)' missing \(hash)")
+        }
+        // Probe every trigram of a different text, hits and misses alike
+        let probes = Array("the quick brown fox jumps over the lazy international dog".utf8)
+        for i in 0..<(probes.count - 2) {
+            let hash = trigramHash(probes[i], probes[i + 1], probes[i + 2])
+            #expect(table.contains(hash) == trigrams.contains(hash))
+        }
+    }
+}
+
+@Test func trigramTableStaysAtMostHalfFull() {
+    var bytes: [UInt8] = []
+    for i in 0..<200 {
+        bytes.append(UInt8(0x61 + i % 26))
+        bytes.append(UInt8(0x30 + i % 10))
+    }
+    let trigrams = computeTrigrams(bytes)
+    let table = TrigramTable(trigrams)
+    #expect(table.slots.count >= 2 * trigrams.count)
+    #expect(table.slots.count & (table.slots.count - 1) == 0)
+}
+
+@Test func trigramTableCountMatchesSetCount() {
+    let queries = ["hello", "getuserbyid", "goldman sachs", "aaaaaa"]
+    let candidates = ["hello world", "getUserById", "goldman_sachs_group", "aaaaaaaaaa", "xyz", ""]
+    for query in queries {
+        let trigrams = computeTrigrams(Array(query.utf8))
+        let table = TrigramTable(trigrams)
+        for candidate in candidates {
+            let bytes = Array(candidate.lowercased().utf8)
+            #expect(
+                countSharedTrigrams(candidateBytes: bytes.span, queryTrigrams: table)
+                    == countSharedTrigrams(candidateBytes: bytes.span, queryTrigrams: trigrams)
+            )
+            #expect(
+                passesTrigramFilter(candidateBytes: bytes.span, queryTrigrams: table, maxEditDistance: 1)
+                    == passesTrigramFilter(candidateBytes: bytes.span, queryTrigrams: trigrams, maxEditDistance: 1)
+            )
+        }
+    }
+}
+
+@Test func emptyTrigramTableContainsNothing() {
+    let table = TrigramTable([])
+    #expect(table.isEmpty)
+    #expect(!table.contains(trigramHash(0x61, 0x62, 0x63)))
+    #expect(passesTrigramFilter(candidateBytes: Array("abc".utf8).span, queryTrigrams: table, maxEditDistance: 0))
+}
+
 // MARK: - Trigram Integration with FuzzyMatcher
 
 @Test func trigramIntegrationLongQuery() {